@@ -0,0 +1,36 @@
+/**
+ ** @file src/computation/broadcast.hh
+ ** @brief Declaration of ml::computation::broadcast functions
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace ml::computation::broadcast
+{
+    /** @brief Compute result = operation(lhs, rhs) element-wise on row-major buffers, broadcasting implemented
+     ** @details Same shapes run as one flat loop. Otherwise each row of the result is computed with a contiguous
+     ** loop, an operand of width one being read once per row, so row vectors, column vectors and scalars stream.
+     ** Every dimension of the operands must be either the dimension of the result or one.
+     ** @param lhs The data of the operand at the left of the operation
+     ** @param lhs_height The height of lhs
+     ** @param lhs_width The width of lhs
+     ** @param rhs The data of the operand at the right of the operation
+     ** @param rhs_height The height of rhs
+     ** @param rhs_width The width of rhs
+     ** @param result The data of the result, of the largest height and width of the operands
+     ** @param operation The element-wise operation
+     */
+    template <typename DATA_TYPE, class Operation>
+    void apply(const DATA_TYPE* lhs,
+               size_t lhs_height,
+               size_t lhs_width,
+               const DATA_TYPE* rhs,
+               size_t rhs_height,
+               size_t rhs_width,
+               DATA_TYPE* result,
+               const Operation& operation);
+} // namespace ml::computation::broadcast
+
+#include "computation/broadcast.hxx"
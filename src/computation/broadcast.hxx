@@ -0,0 +1,122 @@
+/**
+ ** @file src/computation/broadcast.hxx
+ ** @brief Implementation of ml::computation::broadcast templated functions
+ */
+
+#include <algorithm>
+
+#include "computation/simd.hh"
+
+namespace ml::computation::broadcast
+{
+    /// Broadcasting loops of any operation, auto-vectorised for the instruction set of the CPU
+    template <typename DATA_TYPE, class Operation>
+    static void apply_loops(const DATA_TYPE* lhs,
+                            size_t lhs_height,
+                            size_t lhs_width,
+                            const DATA_TYPE* rhs,
+                            size_t rhs_height,
+                            size_t rhs_width,
+                            DATA_TYPE* result,
+                            const Operation& operation)
+    {
+        const size_t height = std::max(lhs_height, rhs_height);
+        const size_t width = std::max(lhs_width, rhs_width);
+
+        if (lhs_height == rhs_height && lhs_width == rhs_width)
+        {
+            for (size_t i = 0; i < height * width; i++)
+                result[i] = operation(lhs[i], rhs[i]);
+
+            return;
+        }
+
+        // A row vector operand is the same row for every row of the result, a column vector one value per row
+        const size_t lhs_row_step = lhs_height == 1 ? 0 : lhs_width;
+        const size_t rhs_row_step = rhs_height == 1 ? 0 : rhs_width;
+
+        for (size_t i = 0; i < height; i++)
+        {
+            const DATA_TYPE* lhs_row = lhs + i * lhs_row_step;
+            const DATA_TYPE* rhs_row = rhs + i * rhs_row_step;
+            DATA_TYPE* result_row = result + i * width;
+
+            if (lhs_width == rhs_width)
+            {
+                for (size_t j = 0; j < width; j++)
+                    result_row[j] = operation(lhs_row[j], rhs_row[j]);
+            }
+            else if (rhs_width == 1)
+            {
+                const DATA_TYPE rhs_value = rhs_row[0];
+                for (size_t j = 0; j < width; j++)
+                    result_row[j] = operation(lhs_row[j], rhs_value);
+            }
+            else
+            {
+                const DATA_TYPE lhs_value = lhs_row[0];
+                for (size_t j = 0; j < width; j++)
+                    result_row[j] = operation(lhs_value, rhs_row[j]);
+            }
+        }
+    }
+
+    /// Same loops as apply_loops, each row being computed by a hand-vectorised kernel
+    template <typename DATA_TYPE>
+    static void apply_simd(const DATA_TYPE* lhs,
+                           size_t lhs_height,
+                           size_t lhs_width,
+                           const DATA_TYPE* rhs,
+                           size_t rhs_height,
+                           size_t rhs_width,
+                           DATA_TYPE* result,
+                           ml::computation::simd::Operation operation)
+    {
+        const size_t height = std::max(lhs_height, rhs_height);
+        const size_t width = std::max(lhs_width, rhs_width);
+
+        if (lhs_height == rhs_height && lhs_width == rhs_width)
+            return ml::computation::simd::apply(operation, lhs, rhs, result, height * width);
+
+        const size_t lhs_row_step = lhs_height == 1 ? 0 : lhs_width;
+        const size_t rhs_row_step = rhs_height == 1 ? 0 : rhs_width;
+
+        for (size_t i = 0; i < height; i++)
+        {
+            const DATA_TYPE* lhs_row = lhs + i * lhs_row_step;
+            const DATA_TYPE* rhs_row = rhs + i * rhs_row_step;
+            DATA_TYPE* result_row = result + i * width;
+
+            if (lhs_width == rhs_width)
+                ml::computation::simd::apply(operation, lhs_row, rhs_row, result_row, width);
+            else if (rhs_width == 1)
+                ml::computation::simd::apply(operation, lhs_row, rhs_row[0], result_row, width);
+            else
+                ml::computation::simd::apply(operation, lhs_row[0], rhs_row, result_row, width);
+        }
+    }
+
+    template <typename DATA_TYPE, class Operation>
+    void apply(const DATA_TYPE* lhs,
+               size_t lhs_height,
+               size_t lhs_width,
+               const DATA_TYPE* rhs,
+               size_t rhs_height,
+               size_t rhs_width,
+               DATA_TYPE* result,
+               const Operation& operation)
+    {
+        using operation_of_t = ml::computation::simd::operation_of<DATA_TYPE, Operation>;
+
+        if constexpr (operation_of_t::value)
+        {
+            apply_simd(lhs, lhs_height, lhs_width, rhs, rhs_height, rhs_width, result, operation_of_t::operation);
+        }
+        else
+        {
+            ml::computation::simd::dispatch([&]() {
+                apply_loops(lhs, lhs_height, lhs_width, rhs, rhs_height, rhs_width, result, operation);
+            });
+        }
+    }
+} // namespace ml::computation::broadcast
@@ -0,0 +1,210 @@
+/**
+ ** @file src/computation/gemm.hh
+ ** @brief Declaration of ml::computation::gemm functions
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "computation/simd.hh"
+
+namespace ml::computation::gemm
+{
+    /// Number of vector registers the accumulator of a register tile may use, out of the 16 of SSE2 and AVX2: the
+    /// others hold the rhs row and the broadcast lhs value
+    constexpr size_t ACCUMULATOR_REGISTERS = 12;
+
+    /** @brief Default compile-time blocking sizes of the multiplication kernel for an instruction set
+     ** @details The register tile is MR rows of two vector registers, 12 registers for its accumulator, and the cache
+     ** blocks are sized from it
+     */
+    template <typename DATA_TYPE, ml::computation::simd::InstructionSet INSTRUCTION_SET>
+    struct DefaultBlocking
+    {
+        /// Size in bytes of the vector registers of the instruction set
+        static constexpr size_t VECTOR_SIZE =
+            INSTRUCTION_SET == ml::computation::simd::InstructionSet::AVX512 ? 64
+            : INSTRUCTION_SET == ml::computation::simd::InstructionSet::AVX2 ? 32
+                                                                              : 16;
+        /// Height of the register tile, number of result rows computed by one micro-kernel call
+        static constexpr size_t MR = 6;
+        /// Width of the register tile, the elements of two vector registers
+        static constexpr size_t NR = 2 * VECTOR_SIZE / sizeof(DATA_TYPE);
+        /// Height of the packed lhs block, sized to stay in the L2 cache with KC
+        static constexpr size_t MC = 24 * MR;
+        /// Depth of the packed blocks, a KC x NR rhs sliver is 16 KiB so it stays in the L1 cache with a lhs sliver
+        static constexpr size_t KC = 16384 / (NR * sizeof(DATA_TYPE));
+        /// Width of the packed rhs panel, sized to stay in the L3 cache with KC
+        static constexpr size_t NC = 64 * NR;
+    };
+
+    /// Below this number of multiply-adds the packing overhead outweighs the blocking gain
+    constexpr size_t SMALL_MULTIPLICATION_SIZE = 32 * 32 * 32;
+
+    /// Below this number of multiply-adds dispatching to the thread pool costs more than it saves
+    constexpr size_t PARALLEL_MULTIPLICATION_SIZE = 128 * 128 * 128;
+
+    /** @brief Compute result = lhs * rhs with the straightforward i-k-j loop
+     ** @param m The height of lhs and result
+     ** @param n The width of lhs and height of rhs
+     ** @param p The width of rhs and result
+     ** @param lhs The first element of lhs
+     ** @param lhs_row_stride The distance between two rows of lhs
+     ** @param lhs_column_stride The distance between two columns of lhs
+     ** @param rhs The first element of rhs
+     ** @param rhs_row_stride The distance between two rows of rhs
+     ** @param rhs_column_stride The distance between two columns of rhs
+     ** @param result The first element of the row-major result, overwritten
+     ** @param result_row_stride The distance between two rows of result
+     */
+    template <typename DATA_TYPE>
+    void multiply_simple(size_t m,
+                         size_t n,
+                         size_t p,
+                         const DATA_TYPE* lhs,
+                         ptrdiff_t lhs_row_stride,
+                         ptrdiff_t lhs_column_stride,
+                         const DATA_TYPE* rhs,
+                         ptrdiff_t rhs_row_stride,
+                         ptrdiff_t rhs_column_stride,
+                         DATA_TYPE* result,
+                         ptrdiff_t result_row_stride);
+
+    /** @brief Compute result = lhs * rhs with the packed, cache-blocked and register-tiled kernel
+     ** @tparam Blocking The compile-time blocking sizes, see DefaultBlocking
+     ** @param m The height of lhs and result
+     ** @param n The width of lhs and height of rhs
+     ** @param p The width of rhs and result
+     ** @param lhs The first element of lhs
+     ** @param lhs_row_stride The distance between two rows of lhs
+     ** @param lhs_column_stride The distance between two columns of lhs
+     ** @param rhs The first element of rhs
+     ** @param rhs_row_stride The distance between two rows of rhs
+     ** @param rhs_column_stride The distance between two columns of rhs
+     ** @param result The first element of the row-major result, overwritten
+     ** @param result_row_stride The distance between two rows of result
+     */
+    template <typename DATA_TYPE, class Blocking>
+    void multiply_blocked(size_t m,
+                          size_t n,
+                          size_t p,
+                          const DATA_TYPE* lhs,
+                          ptrdiff_t lhs_row_stride,
+                          ptrdiff_t lhs_column_stride,
+                          const DATA_TYPE* rhs,
+                          ptrdiff_t rhs_row_stride,
+                          ptrdiff_t rhs_column_stride,
+                          DATA_TYPE* result,
+                          ptrdiff_t result_row_stride);
+
+    /** @brief Compute result = lhs * rhs with the blocked kernel and the DefaultBlocking of the instruction set the
+     ** kernels run with
+     ** @param m The height of lhs and result
+     ** @param n The width of lhs and height of rhs
+     ** @param p The width of rhs and result
+     ** @param lhs The first element of lhs
+     ** @param lhs_row_stride The distance between two rows of lhs
+     ** @param lhs_column_stride The distance between two columns of lhs
+     ** @param rhs The first element of rhs
+     ** @param rhs_row_stride The distance between two rows of rhs
+     ** @param rhs_column_stride The distance between two columns of rhs
+     ** @param result The first element of the row-major result, overwritten
+     ** @param result_row_stride The distance between two rows of result
+     */
+    template <typename DATA_TYPE>
+    void multiply_blocked(size_t m,
+                          size_t n,
+                          size_t p,
+                          const DATA_TYPE* lhs,
+                          ptrdiff_t lhs_row_stride,
+                          ptrdiff_t lhs_column_stride,
+                          const DATA_TYPE* rhs,
+                          ptrdiff_t rhs_row_stride,
+                          ptrdiff_t rhs_column_stride,
+                          DATA_TYPE* result,
+                          ptrdiff_t result_row_stride);
+
+    /** @brief Compute result = lhs * rhs with the blocked kernel on panels of the result run by the thread pool
+     ** @details The result is split in row panels, or in column panels when it is wider than tall
+     ** @tparam Blocking The compile-time blocking sizes, see DefaultBlocking
+     ** @param m The height of lhs and result
+     ** @param n The width of lhs and height of rhs
+     ** @param p The width of rhs and result
+     ** @param lhs The first element of lhs
+     ** @param lhs_row_stride The distance between two rows of lhs
+     ** @param lhs_column_stride The distance between two columns of lhs
+     ** @param rhs The first element of rhs
+     ** @param rhs_row_stride The distance between two rows of rhs
+     ** @param rhs_column_stride The distance between two columns of rhs
+     ** @param result The first element of the row-major result, overwritten
+     ** @param result_row_stride The distance between two rows of result
+     */
+    template <typename DATA_TYPE, class Blocking>
+    void multiply_parallel(size_t m,
+                           size_t n,
+                           size_t p,
+                           const DATA_TYPE* lhs,
+                           ptrdiff_t lhs_row_stride,
+                           ptrdiff_t lhs_column_stride,
+                           const DATA_TYPE* rhs,
+                           ptrdiff_t rhs_row_stride,
+                           ptrdiff_t rhs_column_stride,
+                           DATA_TYPE* result,
+                           ptrdiff_t result_row_stride);
+
+    /** @brief Compute result = lhs * rhs with the parallel kernel and the DefaultBlocking of the instruction set the
+     ** kernels run with
+     ** @param m The height of lhs and result
+     ** @param n The width of lhs and height of rhs
+     ** @param p The width of rhs and result
+     ** @param lhs The first element of lhs
+     ** @param lhs_row_stride The distance between two rows of lhs
+     ** @param lhs_column_stride The distance between two columns of lhs
+     ** @param rhs The first element of rhs
+     ** @param rhs_row_stride The distance between two rows of rhs
+     ** @param rhs_column_stride The distance between two columns of rhs
+     ** @param result The first element of the row-major result, overwritten
+     ** @param result_row_stride The distance between two rows of result
+     */
+    template <typename DATA_TYPE>
+    void multiply_parallel(size_t m,
+                           size_t n,
+                           size_t p,
+                           const DATA_TYPE* lhs,
+                           ptrdiff_t lhs_row_stride,
+                           ptrdiff_t lhs_column_stride,
+                           const DATA_TYPE* rhs,
+                           ptrdiff_t rhs_row_stride,
+                           ptrdiff_t rhs_column_stride,
+                           DATA_TYPE* result,
+                           ptrdiff_t result_row_stride);
+
+    /** @brief Compute result = lhs * rhs, choosing the kernel from the shape of the problem
+     ** @param m The height of lhs and result
+     ** @param n The width of lhs and height of rhs
+     ** @param p The width of rhs and result
+     ** @param lhs The first element of lhs
+     ** @param lhs_row_stride The distance between two rows of lhs
+     ** @param lhs_column_stride The distance between two columns of lhs
+     ** @param rhs The first element of rhs
+     ** @param rhs_row_stride The distance between two rows of rhs
+     ** @param rhs_column_stride The distance between two columns of rhs
+     ** @param result The first element of the row-major result, overwritten
+     ** @param result_row_stride The distance between two rows of result
+     */
+    template <typename DATA_TYPE>
+    void multiply(size_t m,
+                  size_t n,
+                  size_t p,
+                  const DATA_TYPE* lhs,
+                  ptrdiff_t lhs_row_stride,
+                  ptrdiff_t lhs_column_stride,
+                  const DATA_TYPE* rhs,
+                  ptrdiff_t rhs_row_stride,
+                  ptrdiff_t rhs_column_stride,
+                  DATA_TYPE* result,
+                  ptrdiff_t result_row_stride);
+} // namespace ml::computation::gemm
+
+#include "computation/gemm.hxx"
@@ -0,0 +1,453 @@
+/**
+ ** @file src/computation/gemm.hxx
+ ** @brief Implementation of ml::computation::gemm templated functions
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "computation/simd.hh"
+#include "data_structure/memory/aligned_allocator.hh"
+#include "parallel/thread_pool.hh"
+
+namespace ml::computation::gemm
+{
+    template <typename DATA_TYPE>
+    void multiply_simple(size_t m,
+                         size_t n,
+                         size_t p,
+                         const DATA_TYPE* lhs,
+                         ptrdiff_t lhs_row_stride,
+                         ptrdiff_t lhs_column_stride,
+                         const DATA_TYPE* rhs,
+                         ptrdiff_t rhs_row_stride,
+                         ptrdiff_t rhs_column_stride,
+                         DATA_TYPE* result,
+                         ptrdiff_t result_row_stride)
+    {
+        ml::computation::simd::dispatch([&]() {
+            // A single result column is a dot product per row, accumulating in a register instead of in the result
+            if (p == 1)
+            {
+                for (size_t i = 0; i < m; i++)
+                {
+                    DATA_TYPE value = 0;
+                    for (size_t k = 0; k < n; k++)
+                        value += lhs[i * lhs_row_stride + k * lhs_column_stride] * rhs[k * rhs_row_stride];
+
+                    result[i * result_row_stride] = value;
+                }
+
+                return;
+            }
+
+            for (size_t i = 0; i < m; i++)
+            {
+                DATA_TYPE* result_row = result + i * result_row_stride;
+                std::fill(result_row, result_row + p, DATA_TYPE(0));
+
+                for (size_t k = 0; k < n; k++)
+                {
+                    const DATA_TYPE lhs_value = lhs[i * lhs_row_stride + k * lhs_column_stride];
+                    const DATA_TYPE* rhs_row = rhs + k * rhs_row_stride;
+
+                    for (size_t j = 0; j < p; j++)
+                        result_row[j] += lhs_value * rhs_row[j * rhs_column_stride];
+                }
+            }
+        });
+    }
+
+    /** @brief Copy a mc x kc block of lhs into MR-tall slivers, each stored column after column
+     ** @details The last sliver is padded with zeros so the micro-kernel never needs a bound check
+     */
+    template <typename DATA_TYPE, size_t MR>
+    static void pack_lhs(size_t mc,
+                         size_t kc,
+                         const DATA_TYPE* lhs,
+                         ptrdiff_t lhs_row_stride,
+                         ptrdiff_t lhs_column_stride,
+                         DATA_TYPE* packed)
+    {
+        for (size_t ir = 0; ir < mc; ir += MR)
+        {
+            const size_t mr = std::min(MR, mc - ir);
+
+            for (size_t k = 0; k < kc; k++)
+            {
+                const DATA_TYPE* column = lhs + ir * lhs_row_stride + k * lhs_column_stride;
+
+                for (size_t i = 0; i < mr; i++)
+                    packed[i] = column[i * lhs_row_stride];
+                for (size_t i = mr; i < MR; i++)
+                    packed[i] = 0;
+
+                packed += MR;
+            }
+        }
+    }
+
+    /** @brief Copy a kc x nc panel of rhs into NR-wide slivers, each stored row after row
+     ** @details The last sliver is padded with zeros so the micro-kernel never needs a bound check
+     */
+    template <typename DATA_TYPE, size_t NR>
+    static void pack_rhs(size_t kc,
+                         size_t nc,
+                         const DATA_TYPE* rhs,
+                         ptrdiff_t rhs_row_stride,
+                         ptrdiff_t rhs_column_stride,
+                         DATA_TYPE* packed)
+    {
+        for (size_t jr = 0; jr < nc; jr += NR)
+        {
+            const size_t nr = std::min(NR, nc - jr);
+
+            for (size_t k = 0; k < kc; k++)
+            {
+                const DATA_TYPE* row = rhs + k * rhs_row_stride + jr * rhs_column_stride;
+
+                for (size_t j = 0; j < nr; j++)
+                    packed[j] = row[j * rhs_column_stride];
+                for (size_t j = nr; j < NR; j++)
+                    packed[j] = 0;
+
+                packed += NR;
+            }
+        }
+    }
+
+    /// Vector of SIZE elements with the element-wise operators, read and written at any address of its elements
+    template <typename DATA_TYPE, size_t SIZE>
+    struct register_vector
+    {
+        typedef DATA_TYPE type
+            __attribute__((vector_size(SIZE * sizeof(DATA_TYPE)), aligned(alignof(DATA_TYPE)), may_alias));
+    };
+
+    /** @brief Accumulate the product of a packed lhs sliver and a packed rhs sliver into a mr x nr tile
+     ** @details Each row of the MR x NR accumulator is NR / LANES vectors of the size of a vector register. The
+     ** bounds are compile-time constants and the accumulator is only read and written as whole vectors, so the loops
+     ** are unrolled and the whole tile is kept in registers.
+     */
+    template <typename DATA_TYPE, size_t MR, size_t NR, size_t VECTOR_SIZE>
+    static void micro_kernel(size_t kc,
+                             const DATA_TYPE* packed_lhs,
+                             const DATA_TYPE* packed_rhs,
+                             DATA_TYPE* result,
+                             ptrdiff_t result_row_stride,
+                             size_t mr,
+                             size_t nr)
+    {
+        constexpr size_t LANES = VECTOR_SIZE / sizeof(DATA_TYPE);
+        constexpr size_t VECTORS = NR / LANES;
+        static_assert(LANES > 0 && NR % LANES == 0, "NR must be a multiple of the elements of a vector register");
+
+        using vector_t = typename register_vector<DATA_TYPE, LANES>::type;
+
+        vector_t accumulator[MR][VECTORS] = {};
+
+        for (size_t k = 0; k < kc; k++)
+        {
+            vector_t rhs_row[VECTORS];
+            for (size_t v = 0; v < VECTORS; v++)
+                rhs_row[v] = *reinterpret_cast<const vector_t*>(packed_rhs + v * LANES);
+
+            for (size_t i = 0; i < MR; i++)
+            {
+                const DATA_TYPE lhs_value = packed_lhs[i];
+                for (size_t v = 0; v < VECTORS; v++)
+                    accumulator[i][v] += lhs_value * rhs_row[v];
+            }
+
+            packed_lhs += MR;
+            packed_rhs += NR;
+        }
+
+        if (mr == MR && nr == NR)
+        {
+            for (size_t i = 0; i < MR; i++)
+            {
+                for (size_t v = 0; v < VECTORS; v++)
+                    *reinterpret_cast<vector_t*>(result + i * result_row_stride + v * LANES) += accumulator[i][v];
+            }
+
+            return;
+        }
+
+        // The edge tiles go through a buffer, the accumulator is still only written as whole vectors
+        DATA_TYPE tile[MR][NR];
+        for (size_t i = 0; i < MR; i++)
+        {
+            for (size_t v = 0; v < VECTORS; v++)
+                *reinterpret_cast<vector_t*>(tile[i] + v * LANES) = accumulator[i][v];
+        }
+
+        for (size_t i = 0; i < mr; i++)
+        {
+            DATA_TYPE* result_row = result + i * result_row_stride;
+            for (size_t j = 0; j < nr; j++)
+                result_row[j] += tile[i][j];
+        }
+    }
+
+    /** @brief Call a function with the DefaultBlocking of the instruction set the kernels run with
+     ** @param function The function called as function(blocking) with a DefaultBlocking object
+     */
+    template <typename DATA_TYPE, class Function>
+    static void dispatch_blocking(const Function& function)
+    {
+        switch (ml::computation::simd::get_instruction_set())
+        {
+            case ml::computation::simd::InstructionSet::AVX512:
+                return function(DefaultBlocking<DATA_TYPE, ml::computation::simd::InstructionSet::AVX512>());
+            case ml::computation::simd::InstructionSet::AVX2:
+                return function(DefaultBlocking<DATA_TYPE, ml::computation::simd::InstructionSet::AVX2>());
+            default:
+                return function(DefaultBlocking<DATA_TYPE, ml::computation::simd::InstructionSet::SSE2>());
+        }
+    }
+
+    template <typename DATA_TYPE, class Blocking>
+    void multiply_blocked(size_t m,
+                          size_t n,
+                          size_t p,
+                          const DATA_TYPE* lhs,
+                          ptrdiff_t lhs_row_stride,
+                          ptrdiff_t lhs_column_stride,
+                          const DATA_TYPE* rhs,
+                          ptrdiff_t rhs_row_stride,
+                          ptrdiff_t rhs_column_stride,
+                          DATA_TYPE* result,
+                          ptrdiff_t result_row_stride)
+    {
+        constexpr size_t MR = Blocking::MR;
+        constexpr size_t NR = Blocking::NR;
+        constexpr size_t MC = Blocking::MC;
+        constexpr size_t KC = Blocking::KC;
+        constexpr size_t NC = Blocking::NC;
+        constexpr size_t VECTOR_SIZE = Blocking::VECTOR_SIZE;
+
+        static_assert(MC % MR == 0, "MC must be a multiple of MR");
+        static_assert(NC % NR == 0, "NC must be a multiple of NR");
+        static_assert(MR * NR * sizeof(DATA_TYPE) <= ACCUMULATOR_REGISTERS * VECTOR_SIZE,
+                      "The accumulator of the register tile must fit in the vector registers");
+
+        for (size_t i = 0; i < m; i++)
+            std::fill(result + i * result_row_stride, result + i * result_row_stride + p, DATA_TYPE(0));
+
+        if (n == 0)
+            return;
+
+        using buffer_t = std::vector<DATA_TYPE, ml::data_structure::memory::AlignedAllocator<DATA_TYPE>>;
+
+        // Round the buffers down to the problem size so small products do not allocate the full blocks
+        const size_t round_m = std::min(MC, (m + MR - 1) / MR * MR);
+        const size_t round_p = std::min(NC, (p + NR - 1) / NR * NR);
+        buffer_t packed_lhs(round_m * std::min(KC, n));
+        buffer_t packed_rhs(std::min(KC, n) * round_p);
+
+        for (size_t jc = 0; jc < p; jc += NC)
+        {
+            const size_t nc = std::min(NC, p - jc);
+
+            for (size_t pc = 0; pc < n; pc += KC)
+            {
+                const size_t kc = std::min(KC, n - pc);
+
+                pack_rhs<DATA_TYPE, NR>(kc,
+                                        nc,
+                                        rhs + pc * rhs_row_stride + jc * rhs_column_stride,
+                                        rhs_row_stride,
+                                        rhs_column_stride,
+                                        packed_rhs.data());
+
+                for (size_t ic = 0; ic < m; ic += MC)
+                {
+                    const size_t mc = std::min(MC, m - ic);
+
+                    pack_lhs<DATA_TYPE, MR>(mc,
+                                            kc,
+                                            lhs + ic * lhs_row_stride + pc * lhs_column_stride,
+                                            lhs_row_stride,
+                                            lhs_column_stride,
+                                            packed_lhs.data());
+
+                    ml::computation::simd::dispatch([&]() {
+                        for (size_t jr = 0; jr < nc; jr += NR)
+                        {
+                            for (size_t ir = 0; ir < mc; ir += MR)
+                            {
+                                DATA_TYPE* result_tile = result + (ic + ir) * result_row_stride + jc + jr;
+                                micro_kernel<DATA_TYPE, MR, NR, VECTOR_SIZE>(kc,
+                                                                             packed_lhs.data() + ir * kc,
+                                                                             packed_rhs.data() + jr * kc,
+                                                                             result_tile,
+                                                                             result_row_stride,
+                                                                             std::min(MR, mc - ir),
+                                                                             std::min(NR, nc - jr));
+                            }
+                        }
+                    });
+                }
+            }
+        }
+    }
+
+    template <typename DATA_TYPE>
+    void multiply_blocked(size_t m,
+                          size_t n,
+                          size_t p,
+                          const DATA_TYPE* lhs,
+                          ptrdiff_t lhs_row_stride,
+                          ptrdiff_t lhs_column_stride,
+                          const DATA_TYPE* rhs,
+                          ptrdiff_t rhs_row_stride,
+                          ptrdiff_t rhs_column_stride,
+                          DATA_TYPE* result,
+                          ptrdiff_t result_row_stride)
+    {
+        dispatch_blocking<DATA_TYPE>([&](auto blocking) {
+            multiply_blocked<DATA_TYPE, decltype(blocking)>(m,
+                                                            n,
+                                                            p,
+                                                            lhs,
+                                                            lhs_row_stride,
+                                                            lhs_column_stride,
+                                                            rhs,
+                                                            rhs_row_stride,
+                                                            rhs_column_stride,
+                                                            result,
+                                                            result_row_stride);
+        });
+    }
+
+    template <typename DATA_TYPE, class Blocking>
+    void multiply_parallel(size_t m,
+                           size_t n,
+                           size_t p,
+                           const DATA_TYPE* lhs,
+                           ptrdiff_t lhs_row_stride,
+                           ptrdiff_t lhs_column_stride,
+                           const DATA_TYPE* rhs,
+                           ptrdiff_t rhs_row_stride,
+                           ptrdiff_t rhs_column_stride,
+                           DATA_TYPE* result,
+                           ptrdiff_t result_row_stride)
+    {
+        auto& thread_pool = ml::parallel::get_thread_pool();
+
+        // Panels are whole register tiles so that only the last one has padded edges
+        if (m >= p)
+        {
+            thread_pool.parallel_for(0, m, Blocking::MR, [&](size_t row_begin, size_t row_end) {
+                multiply_blocked<DATA_TYPE, Blocking>(row_end - row_begin,
+                                                      n,
+                                                      p,
+                                                      lhs + row_begin * lhs_row_stride,
+                                                      lhs_row_stride,
+                                                      lhs_column_stride,
+                                                      rhs,
+                                                      rhs_row_stride,
+                                                      rhs_column_stride,
+                                                      result + row_begin * result_row_stride,
+                                                      result_row_stride);
+            });
+        }
+        else
+        {
+            thread_pool.parallel_for(0, p, Blocking::NR, [&](size_t column_begin, size_t column_end) {
+                multiply_blocked<DATA_TYPE, Blocking>(m,
+                                                      n,
+                                                      column_end - column_begin,
+                                                      lhs,
+                                                      lhs_row_stride,
+                                                      lhs_column_stride,
+                                                      rhs + column_begin * rhs_column_stride,
+                                                      rhs_row_stride,
+                                                      rhs_column_stride,
+                                                      result + column_begin,
+                                                      result_row_stride);
+            });
+        }
+    }
+
+    template <typename DATA_TYPE>
+    void multiply_parallel(size_t m,
+                           size_t n,
+                           size_t p,
+                           const DATA_TYPE* lhs,
+                           ptrdiff_t lhs_row_stride,
+                           ptrdiff_t lhs_column_stride,
+                           const DATA_TYPE* rhs,
+                           ptrdiff_t rhs_row_stride,
+                           ptrdiff_t rhs_column_stride,
+                           DATA_TYPE* result,
+                           ptrdiff_t result_row_stride)
+    {
+        dispatch_blocking<DATA_TYPE>([&](auto blocking) {
+            multiply_parallel<DATA_TYPE, decltype(blocking)>(m,
+                                                             n,
+                                                             p,
+                                                             lhs,
+                                                             lhs_row_stride,
+                                                             lhs_column_stride,
+                                                             rhs,
+                                                             rhs_row_stride,
+                                                             rhs_column_stride,
+                                                             result,
+                                                             result_row_stride);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    void multiply(size_t m,
+                  size_t n,
+                  size_t p,
+                  const DATA_TYPE* lhs,
+                  ptrdiff_t lhs_row_stride,
+                  ptrdiff_t lhs_column_stride,
+                  const DATA_TYPE* rhs,
+                  ptrdiff_t rhs_row_stride,
+                  ptrdiff_t rhs_column_stride,
+                  DATA_TYPE* result,
+                  ptrdiff_t result_row_stride)
+    {
+        // A single result column is a matrix-vector product, faster with the dot products of the simple kernel
+        if (m * n * p <= SMALL_MULTIPLICATION_SIZE || p == 1)
+            multiply_simple(m,
+                            n,
+                            p,
+                            lhs,
+                            lhs_row_stride,
+                            lhs_column_stride,
+                            rhs,
+                            rhs_row_stride,
+                            rhs_column_stride,
+                            result,
+                            result_row_stride);
+        else if (m * n * p >= PARALLEL_MULTIPLICATION_SIZE && ml::parallel::get_thread_count() > 1)
+            multiply_parallel(m,
+                              n,
+                              p,
+                              lhs,
+                              lhs_row_stride,
+                              lhs_column_stride,
+                              rhs,
+                              rhs_row_stride,
+                              rhs_column_stride,
+                              result,
+                              result_row_stride);
+        else
+            multiply_blocked(m,
+                             n,
+                             p,
+                             lhs,
+                             lhs_row_stride,
+                             lhs_column_stride,
+                             rhs,
+                             rhs_row_stride,
+                             rhs_column_stride,
+                             result,
+                             result_row_stride);
+    }
+} // namespace ml::computation::gemm
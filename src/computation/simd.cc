@@ -0,0 +1,510 @@
+/**
+ ** @file src/computation/simd.cc
+ ** @brief Implementation of ml::computation::simd functions
+ */
+
+#include "computation/simd.hh"
+
+#include <atomic>
+#include <stdexcept>
+
+#if ML_SIMD_X86
+#    include <immintrin.h>
+#endif
+
+namespace ml::computation::simd
+{
+    static InstructionSet detect_instruction_set()
+    {
+#if ML_SIMD_X86
+        __builtin_cpu_init();
+
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq"))
+            return InstructionSet::AVX512;
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+            return InstructionSet::AVX2;
+        if (__builtin_cpu_supports("sse2"))
+            return InstructionSet::SSE2;
+#endif
+
+        return InstructionSet::SCALAR;
+    }
+
+    InstructionSet get_supported_instruction_set()
+    {
+        static const InstructionSet supported_instruction_set = detect_instruction_set();
+        return supported_instruction_set;
+    }
+
+    static std::atomic<InstructionSet>& current_instruction_set()
+    {
+        static std::atomic<InstructionSet> instruction_set(get_supported_instruction_set());
+        return instruction_set;
+    }
+
+    InstructionSet get_instruction_set()
+    {
+        return current_instruction_set().load(std::memory_order_relaxed);
+    }
+
+    void set_instruction_set(InstructionSet instruction_set)
+    {
+        if (instruction_set > get_supported_instruction_set())
+            throw std::invalid_argument("The instruction set is not supported by the CPU");
+
+        current_instruction_set().store(instruction_set, std::memory_order_relaxed);
+    }
+
+    template <Operation OPERATION, typename DATA_TYPE>
+    static DATA_TYPE compute(DATA_TYPE lhs, DATA_TYPE rhs)
+    {
+        if constexpr (OPERATION == Operation::PLUS)
+            return lhs + rhs;
+        else if constexpr (OPERATION == Operation::MINUS)
+            return lhs - rhs;
+        else if constexpr (OPERATION == Operation::MULTIPLIES)
+            return lhs * rhs;
+        else
+            return lhs / rhs;
+    }
+
+    /// Scalar loop, also computing the elements after the last full vector of the vectorised loops
+    template <Operation OPERATION, bool LHS_SCALAR, bool RHS_SCALAR, typename DATA_TYPE>
+    static void apply_scalar(const DATA_TYPE* lhs, const DATA_TYPE* rhs, DATA_TYPE* result, size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+            result[i] = compute<OPERATION>(LHS_SCALAR ? lhs[0] : lhs[i], RHS_SCALAR ? rhs[0] : rhs[i]);
+    }
+
+#if ML_SIMD_X86
+    /// Intrinsics of each instruction set, one vector of result being computed by each call of compute and one square
+    /// tile of TILE x TILE elements being transposed by each call of transpose_tile
+    template <typename DATA_TYPE>
+    struct Sse2;
+
+    template <>
+    struct Sse2<float>
+    {
+        static constexpr size_t WIDTH = 4;
+
+        template <Operation OPERATION, bool LHS_SCALAR, bool RHS_SCALAR>
+        static void compute(const float* lhs, const float* rhs, float* result)
+        {
+            const __m128 lhs_vector = LHS_SCALAR ? _mm_set1_ps(*lhs) : _mm_loadu_ps(lhs);
+            const __m128 rhs_vector = RHS_SCALAR ? _mm_set1_ps(*rhs) : _mm_loadu_ps(rhs);
+
+            if constexpr (OPERATION == Operation::PLUS)
+                _mm_storeu_ps(result, _mm_add_ps(lhs_vector, rhs_vector));
+            else if constexpr (OPERATION == Operation::MINUS)
+                _mm_storeu_ps(result, _mm_sub_ps(lhs_vector, rhs_vector));
+            else if constexpr (OPERATION == Operation::MULTIPLIES)
+                _mm_storeu_ps(result, _mm_mul_ps(lhs_vector, rhs_vector));
+            else
+                _mm_storeu_ps(result, _mm_div_ps(lhs_vector, rhs_vector));
+        }
+
+        static constexpr size_t TILE = 4;
+
+        static void
+        transpose_tile(const float* source, size_t source_stride, float* destination, size_t destination_stride)
+        {
+            __m128 row_0 = _mm_loadu_ps(source);
+            __m128 row_1 = _mm_loadu_ps(source + source_stride);
+            __m128 row_2 = _mm_loadu_ps(source + 2 * source_stride);
+            __m128 row_3 = _mm_loadu_ps(source + 3 * source_stride);
+
+            _MM_TRANSPOSE4_PS(row_0, row_1, row_2, row_3);
+
+            _mm_storeu_ps(destination, row_0);
+            _mm_storeu_ps(destination + destination_stride, row_1);
+            _mm_storeu_ps(destination + 2 * destination_stride, row_2);
+            _mm_storeu_ps(destination + 3 * destination_stride, row_3);
+        }
+    };
+
+    template <>
+    struct Sse2<double>
+    {
+        static constexpr size_t WIDTH = 2;
+
+        template <Operation OPERATION, bool LHS_SCALAR, bool RHS_SCALAR>
+        static void compute(const double* lhs, const double* rhs, double* result)
+        {
+            const __m128d lhs_vector = LHS_SCALAR ? _mm_set1_pd(*lhs) : _mm_loadu_pd(lhs);
+            const __m128d rhs_vector = RHS_SCALAR ? _mm_set1_pd(*rhs) : _mm_loadu_pd(rhs);
+
+            if constexpr (OPERATION == Operation::PLUS)
+                _mm_storeu_pd(result, _mm_add_pd(lhs_vector, rhs_vector));
+            else if constexpr (OPERATION == Operation::MINUS)
+                _mm_storeu_pd(result, _mm_sub_pd(lhs_vector, rhs_vector));
+            else if constexpr (OPERATION == Operation::MULTIPLIES)
+                _mm_storeu_pd(result, _mm_mul_pd(lhs_vector, rhs_vector));
+            else
+                _mm_storeu_pd(result, _mm_div_pd(lhs_vector, rhs_vector));
+        }
+
+        static constexpr size_t TILE = 2;
+
+        static void
+        transpose_tile(const double* source, size_t source_stride, double* destination, size_t destination_stride)
+        {
+            const __m128d row_0 = _mm_loadu_pd(source);
+            const __m128d row_1 = _mm_loadu_pd(source + source_stride);
+
+            _mm_storeu_pd(destination, _mm_unpacklo_pd(row_0, row_1));
+            _mm_storeu_pd(destination + destination_stride, _mm_unpackhi_pd(row_0, row_1));
+        }
+    };
+
+    template <typename DATA_TYPE>
+    struct Avx2;
+
+    template <>
+    struct Avx2<float>
+    {
+        static constexpr size_t WIDTH = 8;
+
+        template <Operation OPERATION, bool LHS_SCALAR, bool RHS_SCALAR>
+        ML_SIMD_TARGET_AVX2 static void compute(const float* lhs, const float* rhs, float* result)
+        {
+            const __m256 lhs_vector = LHS_SCALAR ? _mm256_set1_ps(*lhs) : _mm256_loadu_ps(lhs);
+            const __m256 rhs_vector = RHS_SCALAR ? _mm256_set1_ps(*rhs) : _mm256_loadu_ps(rhs);
+
+            if constexpr (OPERATION == Operation::PLUS)
+                _mm256_storeu_ps(result, _mm256_add_ps(lhs_vector, rhs_vector));
+            else if constexpr (OPERATION == Operation::MINUS)
+                _mm256_storeu_ps(result, _mm256_sub_ps(lhs_vector, rhs_vector));
+            else if constexpr (OPERATION == Operation::MULTIPLIES)
+                _mm256_storeu_ps(result, _mm256_mul_ps(lhs_vector, rhs_vector));
+            else
+                _mm256_storeu_ps(result, _mm256_div_ps(lhs_vector, rhs_vector));
+        }
+
+        static constexpr size_t TILE = 8;
+
+        ML_SIMD_TARGET_AVX2 static void
+        transpose_tile(const float* source, size_t source_stride, float* destination, size_t destination_stride)
+        {
+            __m256 rows[8];
+            for (size_t i = 0; i < 8; i++)
+                rows[i] = _mm256_loadu_ps(source + i * source_stride);
+
+            // Interleave pairs of rows, then pairs of pairs, then exchange the 128-bit lanes
+            __m256 pairs[8];
+            for (size_t i = 0; i < 8; i += 2)
+            {
+                pairs[i] = _mm256_unpacklo_ps(rows[i], rows[i + 1]);
+                pairs[i + 1] = _mm256_unpackhi_ps(rows[i], rows[i + 1]);
+            }
+
+            __m256 quads[8];
+            for (size_t i = 0; i < 8; i += 4)
+            {
+                quads[i] = _mm256_shuffle_ps(pairs[i], pairs[i + 2], _MM_SHUFFLE(1, 0, 1, 0));
+                quads[i + 1] = _mm256_shuffle_ps(pairs[i], pairs[i + 2], _MM_SHUFFLE(3, 2, 3, 2));
+                quads[i + 2] = _mm256_shuffle_ps(pairs[i + 1], pairs[i + 3], _MM_SHUFFLE(1, 0, 1, 0));
+                quads[i + 3] = _mm256_shuffle_ps(pairs[i + 1], pairs[i + 3], _MM_SHUFFLE(3, 2, 3, 2));
+            }
+
+            for (size_t i = 0; i < 4; i++)
+            {
+                _mm256_storeu_ps(destination + i * destination_stride,
+                                 _mm256_permute2f128_ps(quads[i], quads[i + 4], 0x20));
+                _mm256_storeu_ps(destination + (i + 4) * destination_stride,
+                                 _mm256_permute2f128_ps(quads[i], quads[i + 4], 0x31));
+            }
+        }
+    };
+
+    template <>
+    struct Avx2<double>
+    {
+        static constexpr size_t WIDTH = 4;
+
+        template <Operation OPERATION, bool LHS_SCALAR, bool RHS_SCALAR>
+        ML_SIMD_TARGET_AVX2 static void compute(const double* lhs, const double* rhs, double* result)
+        {
+            const __m256d lhs_vector = LHS_SCALAR ? _mm256_set1_pd(*lhs) : _mm256_loadu_pd(lhs);
+            const __m256d rhs_vector = RHS_SCALAR ? _mm256_set1_pd(*rhs) : _mm256_loadu_pd(rhs);
+
+            if constexpr (OPERATION == Operation::PLUS)
+                _mm256_storeu_pd(result, _mm256_add_pd(lhs_vector, rhs_vector));
+            else if constexpr (OPERATION == Operation::MINUS)
+                _mm256_storeu_pd(result, _mm256_sub_pd(lhs_vector, rhs_vector));
+            else if constexpr (OPERATION == Operation::MULTIPLIES)
+                _mm256_storeu_pd(result, _mm256_mul_pd(lhs_vector, rhs_vector));
+            else
+                _mm256_storeu_pd(result, _mm256_div_pd(lhs_vector, rhs_vector));
+        }
+
+        static constexpr size_t TILE = 4;
+
+        ML_SIMD_TARGET_AVX2 static void
+        transpose_tile(const double* source, size_t source_stride, double* destination, size_t destination_stride)
+        {
+            const __m256d row_0 = _mm256_loadu_pd(source);
+            const __m256d row_1 = _mm256_loadu_pd(source + source_stride);
+            const __m256d row_2 = _mm256_loadu_pd(source + 2 * source_stride);
+            const __m256d row_3 = _mm256_loadu_pd(source + 3 * source_stride);
+
+            // Interleave pairs of rows, then exchange the 128-bit lanes
+            const __m256d low_01 = _mm256_unpacklo_pd(row_0, row_1);
+            const __m256d high_01 = _mm256_unpackhi_pd(row_0, row_1);
+            const __m256d low_23 = _mm256_unpacklo_pd(row_2, row_3);
+            const __m256d high_23 = _mm256_unpackhi_pd(row_2, row_3);
+
+            _mm256_storeu_pd(destination, _mm256_permute2f128_pd(low_01, low_23, 0x20));
+            _mm256_storeu_pd(destination + destination_stride, _mm256_permute2f128_pd(high_01, high_23, 0x20));
+            _mm256_storeu_pd(destination + 2 * destination_stride, _mm256_permute2f128_pd(low_01, low_23, 0x31));
+            _mm256_storeu_pd(destination + 3 * destination_stride, _mm256_permute2f128_pd(high_01, high_23, 0x31));
+        }
+    };
+
+    template <typename DATA_TYPE>
+    struct Avx512;
+
+    template <>
+    struct Avx512<float>
+    {
+        static constexpr size_t WIDTH = 16;
+
+        template <Operation OPERATION, bool LHS_SCALAR, bool RHS_SCALAR>
+        ML_SIMD_TARGET_AVX512 static void compute(const float* lhs, const float* rhs, float* result)
+        {
+            const __m512 lhs_vector = LHS_SCALAR ? _mm512_set1_ps(*lhs) : _mm512_loadu_ps(lhs);
+            const __m512 rhs_vector = RHS_SCALAR ? _mm512_set1_ps(*rhs) : _mm512_loadu_ps(rhs);
+
+            if constexpr (OPERATION == Operation::PLUS)
+                _mm512_storeu_ps(result, _mm512_add_ps(lhs_vector, rhs_vector));
+            else if constexpr (OPERATION == Operation::MINUS)
+                _mm512_storeu_ps(result, _mm512_sub_ps(lhs_vector, rhs_vector));
+            else if constexpr (OPERATION == Operation::MULTIPLIES)
+                _mm512_storeu_ps(result, _mm512_mul_ps(lhs_vector, rhs_vector));
+            else
+                _mm512_storeu_ps(result, _mm512_div_ps(lhs_vector, rhs_vector));
+        }
+    };
+
+    template <>
+    struct Avx512<double>
+    {
+        static constexpr size_t WIDTH = 8;
+
+        template <Operation OPERATION, bool LHS_SCALAR, bool RHS_SCALAR>
+        ML_SIMD_TARGET_AVX512 static void compute(const double* lhs, const double* rhs, double* result)
+        {
+            const __m512d lhs_vector = LHS_SCALAR ? _mm512_set1_pd(*lhs) : _mm512_loadu_pd(lhs);
+            const __m512d rhs_vector = RHS_SCALAR ? _mm512_set1_pd(*rhs) : _mm512_loadu_pd(rhs);
+
+            if constexpr (OPERATION == Operation::PLUS)
+                _mm512_storeu_pd(result, _mm512_add_pd(lhs_vector, rhs_vector));
+            else if constexpr (OPERATION == Operation::MINUS)
+                _mm512_storeu_pd(result, _mm512_sub_pd(lhs_vector, rhs_vector));
+            else if constexpr (OPERATION == Operation::MULTIPLIES)
+                _mm512_storeu_pd(result, _mm512_mul_pd(lhs_vector, rhs_vector));
+            else
+                _mm512_storeu_pd(result, _mm512_div_pd(lhs_vector, rhs_vector));
+        }
+    };
+
+    /// Vectorised loop, inlined with the intrinsics in a function compiled for the instruction set of Vector
+    template <class Vector, Operation OPERATION, bool LHS_SCALAR, bool RHS_SCALAR, typename DATA_TYPE>
+    static void apply_vector(const DATA_TYPE* lhs, const DATA_TYPE* rhs, DATA_TYPE* result, size_t size)
+    {
+        size_t i = 0;
+        for (; i + Vector::WIDTH <= size; i += Vector::WIDTH)
+        {
+            Vector::template compute<OPERATION, LHS_SCALAR, RHS_SCALAR>(
+                LHS_SCALAR ? lhs : lhs + i, RHS_SCALAR ? rhs : rhs + i, result + i);
+        }
+
+        apply_scalar<OPERATION, LHS_SCALAR, RHS_SCALAR>(lhs, rhs, result, i, size);
+    }
+
+    template <Operation OPERATION, bool LHS_SCALAR, bool RHS_SCALAR, typename DATA_TYPE>
+    ML_SIMD_TARGET_AVX512 __attribute__((flatten)) static void
+    apply_avx512(const DATA_TYPE* lhs, const DATA_TYPE* rhs, DATA_TYPE* result, size_t size)
+    {
+        apply_vector<Avx512<DATA_TYPE>, OPERATION, LHS_SCALAR, RHS_SCALAR>(lhs, rhs, result, size);
+    }
+
+    template <Operation OPERATION, bool LHS_SCALAR, bool RHS_SCALAR, typename DATA_TYPE>
+    ML_SIMD_TARGET_AVX2 __attribute__((flatten)) static void
+    apply_avx2(const DATA_TYPE* lhs, const DATA_TYPE* rhs, DATA_TYPE* result, size_t size)
+    {
+        apply_vector<Avx2<DATA_TYPE>, OPERATION, LHS_SCALAR, RHS_SCALAR>(lhs, rhs, result, size);
+    }
+#endif
+
+    template <Operation OPERATION, bool LHS_SCALAR, bool RHS_SCALAR, typename DATA_TYPE>
+    static void apply_instruction_set(const DATA_TYPE* lhs, const DATA_TYPE* rhs, DATA_TYPE* result, size_t size)
+    {
+#if ML_SIMD_X86
+        switch (get_instruction_set())
+        {
+            case InstructionSet::AVX512:
+                return apply_avx512<OPERATION, LHS_SCALAR, RHS_SCALAR>(lhs, rhs, result, size);
+            case InstructionSet::AVX2:
+                return apply_avx2<OPERATION, LHS_SCALAR, RHS_SCALAR>(lhs, rhs, result, size);
+            case InstructionSet::SSE2:
+                return apply_vector<Sse2<DATA_TYPE>, OPERATION, LHS_SCALAR, RHS_SCALAR>(lhs, rhs, result, size);
+            default:
+                break;
+        }
+#endif
+
+        apply_scalar<OPERATION, LHS_SCALAR, RHS_SCALAR>(lhs, rhs, result, 0, size);
+    }
+
+    template <bool LHS_SCALAR, bool RHS_SCALAR, typename DATA_TYPE>
+    static void
+    apply_operation(Operation operation, const DATA_TYPE* lhs, const DATA_TYPE* rhs, DATA_TYPE* result, size_t size)
+    {
+        switch (operation)
+        {
+            case Operation::PLUS:
+                return apply_instruction_set<Operation::PLUS, LHS_SCALAR, RHS_SCALAR>(lhs, rhs, result, size);
+            case Operation::MINUS:
+                return apply_instruction_set<Operation::MINUS, LHS_SCALAR, RHS_SCALAR>(lhs, rhs, result, size);
+            case Operation::MULTIPLIES:
+                return apply_instruction_set<Operation::MULTIPLIES, LHS_SCALAR, RHS_SCALAR>(lhs, rhs, result, size);
+            case Operation::DIVIDES:
+                return apply_instruction_set<Operation::DIVIDES, LHS_SCALAR, RHS_SCALAR>(lhs, rhs, result, size);
+        }
+    }
+
+    void apply(Operation operation, const float* lhs, const float* rhs, float* result, size_t size)
+    {
+        apply_operation<false, false>(operation, lhs, rhs, result, size);
+    }
+
+    void apply(Operation operation, const double* lhs, const double* rhs, double* result, size_t size)
+    {
+        apply_operation<false, false>(operation, lhs, rhs, result, size);
+    }
+
+    void apply(Operation operation, const float* lhs, float rhs, float* result, size_t size)
+    {
+        apply_operation<false, true>(operation, lhs, &rhs, result, size);
+    }
+
+    void apply(Operation operation, const double* lhs, double rhs, double* result, size_t size)
+    {
+        apply_operation<false, true>(operation, lhs, &rhs, result, size);
+    }
+
+    void apply(Operation operation, float lhs, const float* rhs, float* result, size_t size)
+    {
+        apply_operation<true, false>(operation, &lhs, rhs, result, size);
+    }
+
+    void apply(Operation operation, double lhs, const double* rhs, double* result, size_t size)
+    {
+        apply_operation<true, false>(operation, &lhs, rhs, result, size);
+    }
+
+    /// Transpose element by element, also copying the edges left by the tiles of the vectorised loops
+    template <typename DATA_TYPE>
+    static void transpose_scalar(size_t row_begin,
+                                 size_t height,
+                                 size_t column_begin,
+                                 size_t width,
+                                 const DATA_TYPE* source,
+                                 size_t source_stride,
+                                 DATA_TYPE* destination,
+                                 size_t destination_stride)
+    {
+        for (size_t i = row_begin; i < height; i++)
+        {
+            for (size_t j = column_begin; j < width; j++)
+                destination[j * destination_stride + i] = source[i * source_stride + j];
+        }
+    }
+
+#if ML_SIMD_X86
+    template <class Vector, typename DATA_TYPE>
+    static void transpose_vector(size_t height,
+                                 size_t width,
+                                 const DATA_TYPE* source,
+                                 size_t source_stride,
+                                 DATA_TYPE* destination,
+                                 size_t destination_stride)
+    {
+        constexpr size_t TILE = Vector::TILE;
+
+        const size_t tiled_height = height / TILE * TILE;
+        const size_t tiled_width = width / TILE * TILE;
+
+        for (size_t i = 0; i < tiled_height; i += TILE)
+        {
+            for (size_t j = 0; j < tiled_width; j += TILE)
+            {
+                Vector::transpose_tile(source + i * source_stride + j,
+                                       source_stride,
+                                       destination + j * destination_stride + i,
+                                       destination_stride);
+            }
+        }
+
+        transpose_scalar(0, tiled_height, tiled_width, width, source, source_stride, destination, destination_stride);
+        transpose_scalar(tiled_height, height, 0, width, source, source_stride, destination, destination_stride);
+    }
+
+    template <typename DATA_TYPE>
+    ML_SIMD_TARGET_AVX2 __attribute__((flatten)) static void transpose_avx2(size_t height,
+                                                                           size_t width,
+                                                                           const DATA_TYPE* source,
+                                                                           size_t source_stride,
+                                                                           DATA_TYPE* destination,
+                                                                           size_t destination_stride)
+    {
+        transpose_vector<Avx2<DATA_TYPE>>(height, width, source, source_stride, destination, destination_stride);
+    }
+#endif
+
+    template <typename DATA_TYPE>
+    static void transpose_instruction_set(size_t height,
+                                          size_t width,
+                                          const DATA_TYPE* source,
+                                          size_t source_stride,
+                                          DATA_TYPE* destination,
+                                          size_t destination_stride)
+    {
+#if ML_SIMD_X86
+        // The AVX2 tiles are already as wide as a cache line of the destination, AVX-512 ones would not move less
+        switch (get_instruction_set())
+        {
+            case InstructionSet::AVX512:
+            case InstructionSet::AVX2:
+                return transpose_avx2(height, width, source, source_stride, destination, destination_stride);
+            case InstructionSet::SSE2:
+                return transpose_vector<Sse2<DATA_TYPE>>(
+                    height, width, source, source_stride, destination, destination_stride);
+            default:
+                break;
+        }
+#endif
+
+        transpose_scalar(0, height, 0, width, source, source_stride, destination, destination_stride);
+    }
+
+    void transpose(size_t height,
+                   size_t width,
+                   const float* source,
+                   size_t source_stride,
+                   float* destination,
+                   size_t destination_stride)
+    {
+        transpose_instruction_set(height, width, source, source_stride, destination, destination_stride);
+    }
+
+    void transpose(size_t height,
+                   size_t width,
+                   const double* source,
+                   size_t source_stride,
+                   double* destination,
+                   size_t destination_stride)
+    {
+        transpose_instruction_set(height, width, source, source_stride, destination, destination_stride);
+    }
+} // namespace ml::computation::simd
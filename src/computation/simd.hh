@@ -0,0 +1,123 @@
+/**
+ ** @file src/computation/simd.hh
+ ** @brief Declaration of ml::computation::simd functions
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#    define ML_SIMD_X86 1
+/// Compile a function for AVX2 whatever the flags of the build
+#    define ML_SIMD_TARGET_AVX2 __attribute__((target("avx2,fma")))
+/// Compile a function for AVX-512 whatever the flags of the build
+#    define ML_SIMD_TARGET_AVX512 __attribute__((target("avx512f,avx512dq,avx2,fma")))
+#else
+#    define ML_SIMD_X86 0
+#endif
+
+namespace ml::computation::simd
+{
+    /// Instruction sets the kernels are compiled for, from the oldest to the newest
+    enum class InstructionSet
+    {
+        SCALAR,
+        SSE2,
+        AVX2,
+        AVX512
+    };
+
+    /// Element-wise operations of the hand-vectorised kernels
+    enum class Operation
+    {
+        PLUS,
+        MINUS,
+        MULTIPLIES,
+        DIVIDES
+    };
+
+    /** @brief Get the newest instruction set supported by the CPU running the program
+     ** @return The instruction set, detected on the first call
+     */
+    InstructionSet get_supported_instruction_set();
+
+    /** @brief Get the instruction set the kernels currently run with
+     ** @return The instruction set, the supported one unless set_instruction_set was called
+     */
+    InstructionSet get_instruction_set();
+
+    /** @brief Set the instruction set the kernels run with
+     ** @param instruction_set The instruction set, not newer than the supported one
+     */
+    void set_instruction_set(InstructionSet instruction_set);
+
+    /** @brief Compute result[i] = lhs[i] operation rhs[i]
+     ** @param operation The operation
+     ** @param lhs The operand at the left of the operation
+     ** @param rhs The operand at the right of the operation
+     ** @param result The result, that can be lhs or rhs
+     ** @param size The number of elements
+     */
+    void apply(Operation operation, const float* lhs, const float* rhs, float* result, size_t size);
+    void apply(Operation operation, const double* lhs, const double* rhs, double* result, size_t size);
+
+    /** @brief Compute result[i] = lhs[i] operation rhs
+     ** @param operation The operation
+     ** @param lhs The operand at the left of the operation
+     ** @param rhs The scalar at the right of the operation
+     ** @param result The result, that can be lhs
+     ** @param size The number of elements
+     */
+    void apply(Operation operation, const float* lhs, float rhs, float* result, size_t size);
+    void apply(Operation operation, const double* lhs, double rhs, double* result, size_t size);
+
+    /** @brief Compute result[i] = lhs operation rhs[i]
+     ** @param operation The operation
+     ** @param lhs The scalar at the left of the operation
+     ** @param rhs The operand at the right of the operation
+     ** @param result The result, that can be rhs
+     ** @param size The number of elements
+     */
+    void apply(Operation operation, float lhs, const float* rhs, float* result, size_t size);
+    void apply(Operation operation, double lhs, const double* rhs, double* result, size_t size);
+
+    /** @brief Write the transpose of a height x width block of source into destination
+     ** @details The block is cut into square tiles transposed in registers with shuffles, the edges left by the
+     ** tiles being copied element by element. Source and destination must not overlap.
+     ** @param height The height of the block of source
+     ** @param width The width of the block of source
+     ** @param source The first element of the block of source
+     ** @param source_stride The distance between two rows of source
+     ** @param destination The first element of the width x height block of destination
+     ** @param destination_stride The distance between two rows of destination
+     */
+    void transpose(size_t height,
+                   size_t width,
+                   const float* source,
+                   size_t source_stride,
+                   float* destination,
+                   size_t destination_stride);
+    void transpose(size_t height,
+                   size_t width,
+                   const double* source,
+                   size_t source_stride,
+                   double* destination,
+                   size_t destination_stride);
+
+    /** @brief Get the hand-vectorised operation matching a function object of <functional>
+     ** @details value is true for std::plus, std::minus, std::multiplies and std::divides on float and double
+     */
+    template <typename DATA_TYPE, class Function>
+    struct operation_of;
+
+    /** @brief Run kernel compiled for the instruction set the kernels currently run with
+     ** @details kernel and everything it calls is inlined in a copy compiled for each instruction set, so that the
+     ** loops it contains are auto-vectorised for the CPU running the program.
+     ** @param kernel The function object to call without arguments
+     */
+    template <class Kernel>
+    void dispatch(const Kernel& kernel);
+} // namespace ml::computation::simd
+
+#include "computation/simd.hxx"
@@ -0,0 +1,71 @@
+/**
+ ** @file src/computation/simd.hxx
+ ** @brief Implementation of ml::computation::simd templated functions
+ */
+
+#include <functional>
+#include <type_traits>
+
+namespace ml::computation::simd
+{
+    template <typename DATA_TYPE, class Function>
+    struct operation_of
+    {
+        static constexpr bool value = false;
+    };
+
+    template <typename DATA_TYPE, Operation OPERATION>
+    struct simd_operation
+    {
+        static constexpr bool value = std::is_same_v<DATA_TYPE, float> || std::is_same_v<DATA_TYPE, double>;
+        static constexpr Operation operation = OPERATION;
+    };
+
+    template <typename DATA_TYPE, typename FUNCTION_TYPE>
+    struct operation_of<DATA_TYPE, std::plus<FUNCTION_TYPE>> : simd_operation<DATA_TYPE, Operation::PLUS>
+    {};
+
+    template <typename DATA_TYPE, typename FUNCTION_TYPE>
+    struct operation_of<DATA_TYPE, std::minus<FUNCTION_TYPE>> : simd_operation<DATA_TYPE, Operation::MINUS>
+    {};
+
+    template <typename DATA_TYPE, typename FUNCTION_TYPE>
+    struct operation_of<DATA_TYPE, std::multiplies<FUNCTION_TYPE>> : simd_operation<DATA_TYPE, Operation::MULTIPLIES>
+    {};
+
+    template <typename DATA_TYPE, typename FUNCTION_TYPE>
+    struct operation_of<DATA_TYPE, std::divides<FUNCTION_TYPE>> : simd_operation<DATA_TYPE, Operation::DIVIDES>
+    {};
+
+#if ML_SIMD_X86
+    template <class Kernel>
+    ML_SIMD_TARGET_AVX512 __attribute__((flatten)) static void dispatch_avx512(const Kernel& kernel)
+    {
+        kernel();
+    }
+
+    template <class Kernel>
+    ML_SIMD_TARGET_AVX2 __attribute__((flatten)) static void dispatch_avx2(const Kernel& kernel)
+    {
+        kernel();
+    }
+#endif
+
+    template <class Kernel>
+    void dispatch(const Kernel& kernel)
+    {
+#if ML_SIMD_X86
+        switch (get_instruction_set())
+        {
+            case InstructionSet::AVX512:
+                return dispatch_avx512(kernel);
+            case InstructionSet::AVX2:
+                return dispatch_avx2(kernel);
+            default:
+                break;
+        }
+#endif
+
+        kernel();
+    }
+} // namespace ml::computation::simd
@@ -0,0 +1,212 @@
+/**
+ ** @file src/computation/sort.hh
+ ** @brief Declaration of ml::computation::sort functions
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+namespace ml::computation::sort
+{
+    /// Up to this size in bytes of a row, the columns are sorted in place: a column shares its cache lines with the
+    /// other columns, which the gather would only copy back and forth
+    constexpr size_t IN_PLACE_ROW_SIZE = 8;
+
+    /// The number of elements of the scratch buffer a block of columns is gathered in
+    constexpr size_t GATHER_SIZE = 1 << 16;
+
+    /// Below this number of elements the columns are sorted sequentially, the pool would cost more than it saves
+    constexpr size_t PARALLEL_SORT_SIZE = 1 << 16;
+
+    /// From this number of elements, an arithmetic range is sorted with radix_sort instead of std::sort
+    constexpr size_t RADIX_SORT_SIZE = 1 << 10;
+
+    /// Whether the elements of DATA_TYPE are sorted by the bytes of a key, integers and IEEE 754 float and double
+    template <typename DATA_TYPE>
+    struct is_radix_key
+        : std::bool_constant<(std::is_integral_v<DATA_TYPE> && !std::is_same_v<DATA_TYPE, bool>)
+                             || std::is_same_v<DATA_TYPE, float> || std::is_same_v<DATA_TYPE, double>>
+    {};
+
+    /// Whether Compare is the ascending or the descending order of DATA_TYPE, which radix_sort reproduces
+    template <typename DATA_TYPE, class Compare>
+    struct is_radix_sortable
+        : std::bool_constant<is_radix_key<DATA_TYPE>::value
+                             && (std::is_same_v<Compare, std::less<DATA_TYPE>> || std::is_same_v<Compare, std::less<>>
+                                 || std::is_same_v<Compare, std::greater<DATA_TYPE>>
+                                 || std::is_same_v<Compare, std::greater<>>)>
+    {};
+
+    template <typename DATA_TYPE, class Compare>
+    constexpr bool is_radix_sortable_v = is_radix_sortable<DATA_TYPE, Compare>::value;
+
+    /** @brief Sort a range, with the backend chosen by its size and its type
+     ** @details A range of PARALLEL_SORT_SIZE elements or more is sorted with merge_sort by the threads of the shared
+     ** pool, a smaller one with sort_sequential.
+     ** @param begin The first element
+     ** @param end The element after the last one
+     ** @param compare The comparison function object
+     */
+    template <typename DATA_TYPE, class Compare>
+    void sort(DATA_TYPE* begin, DATA_TYPE* end, const Compare& compare);
+
+    /** @brief Sort a range on the calling thread
+     ** @details A range of RADIX_SORT_SIZE elements or more is sorted with radix_sort when is_radix_sortable_v holds,
+     ** any other one with std::sort.
+     ** @param begin The first element
+     ** @param end The element after the last one
+     ** @param compare The comparison function object
+     */
+    template <typename DATA_TYPE, class Compare>
+    void sort_sequential(DATA_TYPE* begin, DATA_TYPE* end, const Compare& compare);
+
+    /** @brief Sort a range with a least significant digit radix sort
+     ** @details The elements are mapped to unsigned keys ordered as the elements, then distributed byte after byte
+     ** in a scratch buffer of the size of the range. A byte equal for every key is skipped. Equivalent elements are
+     ** ordered by their bits: -0.0 comes before 0.0 in the ascending order.
+     ** @param begin The first element
+     ** @param end The element after the last one
+     ** @param compare The comparison function object, std::less or std::greater
+     */
+    template <typename DATA_TYPE, class Compare>
+    void radix_sort(DATA_TYPE* begin, DATA_TYPE* end, const Compare& compare);
+
+    /** @brief Sort a range with a parallel merge sort
+     ** @details The range is split in one chunk per thread of the shared pool, sorted with sort_sequential, then
+     ** the chunks are merged two by two. Each merge is itself split between the threads on the ranks of its output,
+     ** so that the last merges keep every thread busy.
+     ** @param begin The first element
+     ** @param end The element after the last one
+     ** @param compare The comparison function object
+     */
+    template <typename DATA_TYPE, class Compare>
+    void merge_sort(DATA_TYPE* begin, DATA_TYPE* end, const Compare& compare);
+
+    /** @brief Sort every row of a row-major matrix in place
+     ** @details For a matrix of PARALLEL_SORT_SIZE elements or more, the rows are split between the threads of the
+     ** shared pool when there are enough of them, otherwise each row is sorted with sort.
+     ** @param height The height of the matrix
+     ** @param width The width of the matrix
+     ** @param data The row-major matrix
+     ** @param row_stride The distance between two rows
+     ** @param compare The comparison function object
+     */
+    template <typename DATA_TYPE, class Compare>
+    void sort_rows(size_t height, size_t width, DATA_TYPE* data, ptrdiff_t row_stride, const Compare& compare);
+
+    /** @brief Sort every column of a row-major matrix in place
+     ** @details The columns of rows of at most IN_PLACE_ROW_SIZE bytes are sorted through a strided iterator, wider
+     ** matrices with sort_columns_gathered. The columns are split between the threads of the shared pool for a
+     ** matrix of PARALLEL_SORT_SIZE elements or more.
+     ** @param height The height of the matrix
+     ** @param width The width of the matrix
+     ** @param data The row-major matrix
+     ** @param row_stride The distance between two rows
+     ** @param compare The comparison function object
+     */
+    template <typename DATA_TYPE, class Compare>
+    void sort_columns(size_t height, size_t width, DATA_TYPE* data, ptrdiff_t row_stride, const Compare& compare);
+
+    /** @brief Sort every column of a row-major matrix in place, through a strided iterator
+     ** @param height The height of the matrix
+     ** @param width The width of the matrix
+     ** @param data The row-major matrix
+     ** @param row_stride The distance between two rows
+     ** @param compare The comparison function object
+     */
+    template <typename DATA_TYPE, class Compare>
+    void sort_columns_strided(size_t height,
+                              size_t width,
+                              DATA_TYPE* data,
+                              ptrdiff_t row_stride,
+                              const Compare& compare);
+
+    /** @brief Sort every column of a row-major matrix in place, in a contiguous scratch buffer
+     ** @details Blocks of columns of at most GATHER_SIZE elements are transposed in the scratch buffer, where each
+     ** column is a contiguous row sorted without touching a new cache line at every swap, then transposed back.
+     ** @param height The height of the matrix
+     ** @param width The width of the matrix
+     ** @param data The row-major matrix
+     ** @param row_stride The distance between two rows
+     ** @param compare The comparison function object
+     */
+    template <typename DATA_TYPE, class Compare>
+    void sort_columns_gathered(size_t height,
+                               size_t width,
+                               DATA_TYPE* data,
+                               ptrdiff_t row_stride,
+                               const Compare& compare);
+
+    /** @brief Compute the permutation that stably sorts a strided range
+     ** @details indexes[k * index_stride] is the position in the range of its k-th element once sorted. Equivalent
+     ** elements keep their order, with the radix backend from RADIX_SORT_SIZE elements as in sort_sequential.
+     ** @param size The number of elements
+     ** @param data The first element
+     ** @param stride The distance between two elements of the range
+     ** @param indexes The first index of the result
+     ** @param index_stride The distance between two indexes of the result
+     ** @param compare The comparison function object
+     */
+    template <typename DATA_TYPE, class Compare>
+    void argsort(size_t size,
+                 const DATA_TYPE* data,
+                 ptrdiff_t stride,
+                 size_t* indexes,
+                 ptrdiff_t index_stride,
+                 const Compare& compare);
+
+    /** @brief Compute the permutations that stably sort every row of a row-major matrix
+     ** @param height The height of the matrix
+     ** @param width The width of the matrix
+     ** @param data The row-major matrix
+     ** @param row_stride The distance between two rows
+     ** @param indexes The row-major height x width result, the column indexes of each sorted row
+     ** @param compare The comparison function object
+     */
+    template <typename DATA_TYPE, class Compare>
+    void argsort_rows(size_t height,
+                      size_t width,
+                      const DATA_TYPE* data,
+                      ptrdiff_t row_stride,
+                      size_t* indexes,
+                      const Compare& compare);
+
+    /** @brief Compute the permutations that stably sort every column of a row-major matrix
+     ** @param height The height of the matrix
+     ** @param width The width of the matrix
+     ** @param data The row-major matrix
+     ** @param row_stride The distance between two rows
+     ** @param indexes The row-major height x width result, the row indexes of each sorted column
+     ** @param compare The comparison function object
+     */
+    template <typename DATA_TYPE, class Compare>
+    void argsort_columns(size_t height,
+                         size_t width,
+                         const DATA_TYPE* data,
+                         ptrdiff_t row_stride,
+                         size_t* indexes,
+                         const Compare& compare);
+
+    /** @brief Copy the rows of a row-major matrix in the order of a permutation, in a single pass
+     ** @param height The height of the matrices
+     ** @param width The width of the matrices
+     ** @param source The row-major source
+     ** @param source_row_stride The distance between two rows of source
+     ** @param permutation The height indexes of the rows of source, in the order of destination
+     ** @param destination The row-major destination, not overlapping source
+     ** @param destination_row_stride The distance between two rows of destination
+     */
+    template <typename DATA_TYPE>
+    void gather_rows(size_t height,
+                     size_t width,
+                     const DATA_TYPE* source,
+                     ptrdiff_t source_row_stride,
+                     const size_t* permutation,
+                     DATA_TYPE* destination,
+                     ptrdiff_t destination_row_stride);
+} // namespace ml::computation::sort
+
+#include "computation/sort.hxx"
@@ -0,0 +1,416 @@
+/**
+ ** @file src/computation/sort.hxx
+ ** @brief Implementation of ml::computation::sort templated functions
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "computation/transpose.hh"
+#include "data_structure/iterator/strided_iterator.hh"
+#include "parallel/thread_pool.hh"
+
+namespace ml::computation::sort
+{
+    /// The unsigned integer of the same size as DATA_TYPE, holding the radix keys
+    template <typename DATA_TYPE>
+    using radix_key_t =
+        std::conditional_t<sizeof(DATA_TYPE) == 8,
+                           uint64_t,
+                           std::conditional_t<sizeof(DATA_TYPE) == 4,
+                                              uint32_t,
+                                              std::conditional_t<sizeof(DATA_TYPE) == 2, uint16_t, uint8_t>>>;
+
+    /// Map an element to an unsigned key in the same order: the sign bit of an integer is flipped, a negative float
+    /// has all its bits flipped and a positive one only its sign bit. The descending order flips the whole key.
+    template <typename DATA_TYPE, bool DESCENDING>
+    static radix_key_t<DATA_TYPE> radix_key(const DATA_TYPE& value)
+    {
+        using key_t = radix_key_t<DATA_TYPE>;
+        constexpr key_t sign = static_cast<key_t>(key_t(1) << (sizeof(key_t) * 8 - 1));
+
+        key_t key;
+        if constexpr (std::is_floating_point_v<DATA_TYPE>)
+        {
+            std::memcpy(&key, &value, sizeof(key_t));
+            key = (key & sign) ? static_cast<key_t>(~key) : static_cast<key_t>(key | sign);
+        }
+        else if constexpr (std::is_signed_v<DATA_TYPE>)
+            key = static_cast<key_t>(static_cast<key_t>(value) ^ sign);
+        else
+            key = static_cast<key_t>(value);
+
+        return DESCENDING ? static_cast<key_t>(~key) : key;
+    }
+
+    /// Sort the elements by the bytes of their unsigned key, from the least significant one. Each pass is stable, so
+    /// the elements of equal keys keep their order.
+    template <typename ELEMENT, class Key>
+    static void radix_sort_by_key(ELEMENT* begin, ELEMENT* end, const Key& key)
+    {
+        constexpr size_t digit_count = sizeof(key(*begin));
+        const auto size = static_cast<size_t>(end - begin);
+
+        // The histograms of every byte are counted in a single pass over the elements
+        std::array<std::array<size_t, 256>, digit_count> counts{};
+        for (const ELEMENT* it = begin; it != end; ++it)
+        {
+            const auto element_key = key(*it);
+            for (size_t digit = 0; digit < digit_count; digit++)
+                counts[digit][(element_key >> (digit * 8)) & 0xFF]++;
+        }
+
+        std::vector<ELEMENT> buffer(size);
+        ELEMENT* source = begin;
+        ELEMENT* destination = buffer.data();
+
+        for (size_t digit = 0; digit < digit_count; digit++)
+        {
+            auto& offsets = counts[digit];
+            if (offsets[(key(*begin) >> (digit * 8)) & 0xFF] == size)
+                continue;
+
+            size_t offset = 0;
+            for (auto& count : offsets)
+            {
+                const size_t next_offset = offset + count;
+                count = offset;
+                offset = next_offset;
+            }
+
+            for (size_t i = 0; i < size; i++)
+                destination[offsets[(key(source[i]) >> (digit * 8)) & 0xFF]++] = source[i];
+
+            std::swap(source, destination);
+        }
+
+        if (source != begin)
+            std::copy(source, source + size, begin);
+    }
+
+    /// Whether Compare is the ascending order of DATA_TYPE, the descending one otherwise for radix_sort
+    template <typename DATA_TYPE, class Compare>
+    constexpr bool is_ascending_v =
+        std::is_same_v<Compare, std::less<DATA_TYPE>> || std::is_same_v<Compare, std::less<>>;
+
+    /// The number of elements of lhs among the first rank elements of the merge of lhs and rhs, as std::merge
+    /// takes them: an element of lhs comes before an equivalent element of rhs
+    template <typename DATA_TYPE, class Compare>
+    static size_t merge_rank(size_t rank,
+                             const DATA_TYPE* lhs,
+                             size_t lhs_size,
+                             const DATA_TYPE* rhs,
+                             size_t rhs_size,
+                             const Compare& compare)
+    {
+        size_t low = rank > rhs_size ? rank - rhs_size : 0;
+        size_t high = std::min(rank, lhs_size);
+
+        while (low < high)
+        {
+            const size_t middle = low + (high - low) / 2;
+            if (compare(rhs[rank - middle - 1], lhs[middle]))
+                high = middle;
+            else
+                low = middle + 1;
+        }
+
+        return low;
+    }
+
+    /// Call function on [column_begin, column_end) ranges of columns, split between the threads of the shared pool
+    /// for a large matrix
+    template <class Function>
+    static void for_each_columns(size_t height, size_t width, size_t grain, const Function& function)
+    {
+        if (height * width < PARALLEL_SORT_SIZE || ml::parallel::get_thread_count() == 1)
+            return function(0, width);
+
+        ml::parallel::get_thread_pool().parallel_for(0, width, grain, function);
+    }
+
+    template <typename DATA_TYPE, class Compare>
+    static void sort_columns_strided_range(size_t column_begin,
+                                           size_t column_end,
+                                           size_t height,
+                                           DATA_TYPE* data,
+                                           ptrdiff_t row_stride,
+                                           const Compare& compare)
+    {
+        using iterator_t = ml::data_structure::iterator::StridedIterator<DATA_TYPE*>;
+
+        for (size_t j = column_begin; j < column_end; j++)
+        {
+            iterator_t begin(data + j, row_stride);
+            std::sort(begin, begin + static_cast<ptrdiff_t>(height), compare);
+        }
+    }
+
+    template <typename DATA_TYPE, class Compare>
+    static void sort_columns_gathered_range(size_t column_begin,
+                                            size_t column_end,
+                                            size_t height,
+                                            size_t block_width,
+                                            DATA_TYPE* data,
+                                            ptrdiff_t row_stride,
+                                            const Compare& compare)
+    {
+        // The scratch buffer is shared by the blocks of a range, so one allocation per thread
+        std::vector<DATA_TYPE> buffer(std::min(block_width, column_end - column_begin) * height);
+        const auto stride = static_cast<size_t>(row_stride);
+
+        for (size_t block_begin = column_begin; block_begin < column_end; block_begin += block_width)
+        {
+            const size_t width = std::min(block_width, column_end - block_begin);
+
+            ml::computation::transpose::copy(height, width, data + block_begin, stride, buffer.data(), height);
+            for (size_t j = 0; j < width; j++)
+                sort_sequential(buffer.data() + j * height, buffer.data() + (j + 1) * height, compare);
+            ml::computation::transpose::copy(width, height, buffer.data(), height, data + block_begin, stride);
+        }
+    }
+
+    template <typename DATA_TYPE, class Compare>
+    void sort(DATA_TYPE* begin, DATA_TYPE* end, const Compare& compare)
+    {
+        if (static_cast<size_t>(end - begin) < PARALLEL_SORT_SIZE || ml::parallel::get_thread_count() == 1)
+            sort_sequential(begin, end, compare);
+        else
+            merge_sort(begin, end, compare);
+    }
+
+    template <typename DATA_TYPE, class Compare>
+    void sort_sequential(DATA_TYPE* begin, DATA_TYPE* end, const Compare& compare)
+    {
+        if constexpr (is_radix_sortable_v<DATA_TYPE, Compare>)
+        {
+            if (static_cast<size_t>(end - begin) >= RADIX_SORT_SIZE)
+                return radix_sort(begin, end, compare);
+        }
+
+        std::sort(begin, end, compare);
+    }
+
+    template <typename DATA_TYPE, class Compare>
+    void radix_sort(DATA_TYPE* begin, DATA_TYPE* end, const Compare&)
+    {
+        static_assert(is_radix_sortable_v<DATA_TYPE, Compare>, "radix_sort needs an arithmetic type and std::less or "
+                                                               "std::greater");
+
+        if (begin == end)
+            return;
+
+        constexpr bool descending = !is_ascending_v<DATA_TYPE, Compare>;
+        radix_sort_by_key(begin, end, [](const DATA_TYPE& value) { return radix_key<DATA_TYPE, descending>(value); });
+    }
+
+    template <typename DATA_TYPE, class Compare>
+    void merge_sort(DATA_TYPE* begin, DATA_TYPE* end, const Compare& compare)
+    {
+        auto& thread_pool = ml::parallel::get_thread_pool();
+        const auto size = static_cast<size_t>(end - begin);
+        const size_t chunk_count = std::max<size_t>(1, std::min(ml::parallel::get_thread_count(), size));
+
+        std::vector<size_t> bounds(chunk_count + 1);
+        for (size_t chunk = 0; chunk <= chunk_count; chunk++)
+            bounds[chunk] = size * chunk / chunk_count;
+
+        thread_pool.parallel_for(0, chunk_count, 1, [&](size_t chunk_begin, size_t chunk_end) {
+            for (size_t chunk = chunk_begin; chunk < chunk_end; chunk++)
+                sort_sequential(begin + bounds[chunk], begin + bounds[chunk + 1], compare);
+        });
+
+        std::vector<DATA_TYPE> buffer(size);
+        DATA_TYPE* source = begin;
+        DATA_TYPE* destination = buffer.data();
+
+        // Each round merges the runs two by two, every merge split in parts of its output for the threads
+        for (size_t run = 1; run < chunk_count; run *= 2)
+        {
+            const size_t merge_count = (chunk_count + 2 * run - 1) / (2 * run);
+            const size_t part_count = (chunk_count + merge_count - 1) / merge_count;
+
+            thread_pool.parallel_for(0, merge_count * part_count, 1, [&](size_t task_begin, size_t task_end) {
+                for (size_t task = task_begin; task < task_end; task++)
+                {
+                    const size_t merge = task / part_count;
+                    const size_t part = task % part_count;
+
+                    const size_t left = bounds[2 * merge * run];
+                    const size_t middle = bounds[std::min(2 * merge * run + run, chunk_count)];
+                    const size_t right = bounds[std::min(2 * merge * run + 2 * run, chunk_count)];
+                    const size_t lhs_size = middle - left;
+                    const size_t rhs_size = right - middle;
+
+                    const size_t rank_begin = (lhs_size + rhs_size) * part / part_count;
+                    const size_t rank_end = (lhs_size + rhs_size) * (part + 1) / part_count;
+                    const size_t lhs_begin =
+                        merge_rank(rank_begin, source + left, lhs_size, source + middle, rhs_size, compare);
+                    const size_t lhs_end =
+                        merge_rank(rank_end, source + left, lhs_size, source + middle, rhs_size, compare);
+
+                    std::merge(source + left + lhs_begin,
+                               source + left + lhs_end,
+                               source + middle + (rank_begin - lhs_begin),
+                               source + middle + (rank_end - lhs_end),
+                               destination + left + rank_begin,
+                               compare);
+                }
+            });
+
+            std::swap(source, destination);
+        }
+
+        if (source != begin)
+            std::copy(source, source + size, begin);
+    }
+
+    template <typename DATA_TYPE, class Compare>
+    void sort_rows(size_t height, size_t width, DATA_TYPE* data, ptrdiff_t row_stride, const Compare& compare)
+    {
+        const size_t thread_count = ml::parallel::get_thread_count();
+
+        // A few long rows are each sorted by all the threads, many rows are split between them
+        if (height * width < PARALLEL_SORT_SIZE || thread_count == 1 || height < thread_count)
+        {
+            for (size_t i = 0; i < height; i++)
+                ml::computation::sort::sort(data + i * row_stride, data + i * row_stride + width, compare);
+
+            return;
+        }
+
+        ml::parallel::get_thread_pool().parallel_for(0, height, 1, [&](size_t row_begin, size_t row_end) {
+            for (size_t i = row_begin; i < row_end; i++)
+                sort_sequential(data + i * row_stride, data + i * row_stride + width, compare);
+        });
+    }
+
+    template <typename DATA_TYPE, class Compare>
+    void sort_columns(size_t height, size_t width, DATA_TYPE* data, ptrdiff_t row_stride, const Compare& compare)
+    {
+        if (width * sizeof(DATA_TYPE) <= IN_PLACE_ROW_SIZE)
+            sort_columns_strided(height, width, data, row_stride, compare);
+        else
+            sort_columns_gathered(height, width, data, row_stride, compare);
+    }
+
+    template <typename DATA_TYPE, class Compare>
+    void sort_columns_strided(size_t height,
+                              size_t width,
+                              DATA_TYPE* data,
+                              ptrdiff_t row_stride,
+                              const Compare& compare)
+    {
+        for_each_columns(height, width, 1, [&](size_t column_begin, size_t column_end) {
+            sort_columns_strided_range(column_begin, column_end, height, data, row_stride, compare);
+        });
+    }
+
+    template <typename DATA_TYPE, class Compare>
+    void sort_columns_gathered(size_t height,
+                               size_t width,
+                               DATA_TYPE* data,
+                               ptrdiff_t row_stride,
+                               const Compare& compare)
+    {
+        if (height == 0)
+            return;
+
+        // The threads split the columns on whole blocks, a block never crosses two threads
+        const size_t block_width = std::max<size_t>(1, GATHER_SIZE / height);
+
+        for_each_columns(height, width, block_width, [&](size_t column_begin, size_t column_end) {
+            sort_columns_gathered_range(column_begin, column_end, height, block_width, data, row_stride, compare);
+        });
+    }
+
+    template <typename DATA_TYPE, class Compare>
+    void argsort(size_t size,
+                 const DATA_TYPE* data,
+                 ptrdiff_t stride,
+                 size_t* indexes,
+                 ptrdiff_t index_stride,
+                 const Compare& compare)
+    {
+        // The values are sorted along their index, so that the comparisons read contiguous memory
+        std::vector<std::pair<DATA_TYPE, size_t>> pairs(size);
+        for (size_t i = 0; i < size; i++)
+            pairs[i] = {data[static_cast<ptrdiff_t>(i) * stride], i};
+
+        bool sorted = false;
+        if constexpr (is_radix_sortable_v<DATA_TYPE, Compare>)
+        {
+            if (size >= RADIX_SORT_SIZE)
+            {
+                constexpr bool descending = !is_ascending_v<DATA_TYPE, Compare>;
+                radix_sort_by_key(pairs.data(), pairs.data() + size, [](const std::pair<DATA_TYPE, size_t>& pair) {
+                    return radix_key<DATA_TYPE, descending>(pair.first);
+                });
+                sorted = true;
+            }
+        }
+
+        if (!sorted)
+        {
+            using pair_t = std::pair<DATA_TYPE, size_t>;
+            std::stable_sort(pairs.begin(), pairs.end(), [&compare](const pair_t& lhs, const pair_t& rhs) {
+                return compare(lhs.first, rhs.first);
+            });
+        }
+
+        for (size_t i = 0; i < size; i++)
+            indexes[static_cast<ptrdiff_t>(i) * index_stride] = pairs[i].second;
+    }
+
+    template <typename DATA_TYPE, class Compare>
+    void argsort_rows(size_t height,
+                      size_t width,
+                      const DATA_TYPE* data,
+                      ptrdiff_t row_stride,
+                      size_t* indexes,
+                      const Compare& compare)
+    {
+        const auto index_row_stride = static_cast<ptrdiff_t>(width);
+
+        for_each_columns(width, height, 1, [&](size_t row_begin, size_t row_end) {
+            for (size_t i = row_begin; i < row_end; i++)
+                argsort(width, data + i * row_stride, 1, indexes + i * index_row_stride, 1, compare);
+        });
+    }
+
+    template <typename DATA_TYPE, class Compare>
+    void argsort_columns(size_t height,
+                         size_t width,
+                         const DATA_TYPE* data,
+                         ptrdiff_t row_stride,
+                         size_t* indexes,
+                         const Compare& compare)
+    {
+        const auto index_row_stride = static_cast<ptrdiff_t>(width);
+
+        for_each_columns(height, width, 1, [&](size_t column_begin, size_t column_end) {
+            for (size_t j = column_begin; j < column_end; j++)
+                argsort(height, data + j, row_stride, indexes + j, index_row_stride, compare);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    void gather_rows(size_t height,
+                     size_t width,
+                     const DATA_TYPE* source,
+                     ptrdiff_t source_row_stride,
+                     const size_t* permutation,
+                     DATA_TYPE* destination,
+                     ptrdiff_t destination_row_stride)
+    {
+        for (size_t i = 0; i < height; i++)
+        {
+            const DATA_TYPE* row = source + static_cast<ptrdiff_t>(permutation[i]) * source_row_stride;
+            std::copy(row, row + width, destination + static_cast<ptrdiff_t>(i) * destination_row_stride);
+        }
+    }
+} // namespace ml::computation::sort
@@ -7,9 +7,52 @@
 
 #include <cstddef>
 #include <iterator>
+#include <vector>
+
+#include "computation/variance_accumulator.hh"
 
 namespace ml::computation::statistic
 {
+    /** @brief The statistics computed together by describe
+     ** @details VALUE is the type of one statistic: an element for a whole container, a pointer to one element per
+     ** row or column for the row-major kernels, a matrix for the rows or the columns of a matrix
+     */
+    template <typename VALUE>
+    struct Description
+    {
+        /// The sum
+        VALUE sum;
+        /// The min
+        VALUE min;
+        /// The max
+        VALUE max;
+        /// The mean
+        VALUE mean;
+        /// The variance
+        VALUE variance;
+        /// The standard deviation
+        VALUE standard_deviation;
+        /// The peak to peak
+        VALUE peak_to_peak;
+    };
+
+    /// How the reductions of a whole container split their work
+    enum class Execution
+    {
+        /// One pass by the calling thread
+        SEQUENTIAL,
+        /// One chunk per thread of the shared pool, the rounding of the result depends on the thread count
+        PARALLEL,
+        /// Chunks of REDUCTION_CHUNK_SIZE elements merged in order, the result is the same for any thread count
+        DETERMINISTIC
+    };
+
+    /// Below this number of elements a parallel reduction runs sequentially, the pool would cost more than it saves
+    constexpr size_t PARALLEL_REDUCTION_SIZE = 1 << 18;
+
+    /// The number of elements of the chunks of a deterministic reduction
+    constexpr size_t REDUCTION_CHUNK_SIZE = 1 << 16;
+
     /** @brief Compute the sum of the container
      ** @param begin Begin iterator of the container
      ** @param end End iterator of the container
@@ -18,6 +61,15 @@ namespace ml::computation::statistic
     template <class Iterator, typename DATA_TYPE = typename std::iterator_traits<Iterator>::value_type>
     DATA_TYPE sum(const Iterator& begin, const Iterator& end);
 
+    /** @brief Compute the sum of the container, the partial sums of the chunks being computed in parallel
+     ** @param begin Begin random access iterator of the container
+     ** @param end End random access iterator of the container
+     ** @param execution How the work is split
+     ** @return The sum
+     */
+    template <class Iterator, typename DATA_TYPE = typename std::iterator_traits<Iterator>::value_type>
+    DATA_TYPE sum(const Iterator& begin, const Iterator& end, Execution execution);
+
     /** @brief Compute the mean of the container
      ** @param begin Begin iterator of the container
      ** @param end End iterator of the container
@@ -26,6 +78,15 @@ namespace ml::computation::statistic
     template <class Iterator, typename DATA_TYPE = typename std::iterator_traits<Iterator>::value_type>
     DATA_TYPE mean(const Iterator& begin, const Iterator& end);
 
+    /** @brief Compute the mean of the container, the partial sums of the chunks being computed in parallel
+     ** @param begin Begin random access iterator of the container
+     ** @param end End random access iterator of the container
+     ** @param execution How the work is split
+     ** @return The mean
+     */
+    template <class Iterator, typename DATA_TYPE = typename std::iterator_traits<Iterator>::value_type>
+    DATA_TYPE mean(const Iterator& begin, const Iterator& end, Execution execution);
+
     /** @brief Compute the median of the container
      ** @param begin Begin iterator of the container
      ** @param end End iterator of the container
@@ -34,24 +95,233 @@ namespace ml::computation::statistic
     template <class Iterator, typename DATA_TYPE = typename std::iterator_traits<Iterator>::value_type>
     DATA_TYPE median(const Iterator& begin, const Iterator& end);
 
+    /** @brief Compute the median of the container, copied in a scratch buffer reused from one call to the next
+     ** @param begin Begin iterator of the container
+     ** @param end End iterator of the container
+     ** @param buffer The scratch buffer, resized to the size of the container
+     ** @return The median
+     */
+    template <class Iterator, typename DATA_TYPE>
+    DATA_TYPE median(const Iterator& begin, const Iterator& end, std::vector<DATA_TYPE>& buffer);
+
+    /** @brief Compute the median of the container in linear time by partially reordering it
+     ** @details The middle element is selected with std::nth_element instead of sorting the whole container
+     ** @param begin Begin iterator of the container, reordered
+     ** @param end End iterator of the container, reordered
+     ** @return The median
+     */
+    template <class Iterator, typename DATA_TYPE = typename std::iterator_traits<Iterator>::value_type>
+    DATA_TYPE median_in_place(const Iterator& begin, const Iterator& end);
+
     /** @brief Compute the variance of the container
+     ** @details One pass over the container, the blocks of VarianceAccumulator are read twice from the cache only
      ** @param begin Begin iterator of the container
      ** @param end End iterator of the container
      ** @param ddof The divisor used in the calculation is N - ddof, 0 by default
      ** @return The variance
+     ** @throw std::invalid_argument If the container has no more elements than ddof
      */
     template <class Iterator, typename DATA_TYPE = typename std::iterator_traits<Iterator>::value_type>
     DATA_TYPE variance(const Iterator& begin, const Iterator& end, size_t ddof = 0);
 
+    /** @brief Compute the variance of the container, each chunk having its own VarianceAccumulator
+     ** @param begin Begin random access iterator of the container
+     ** @param end End random access iterator of the container
+     ** @param ddof The divisor used in the calculation is N - ddof
+     ** @param execution How the work is split
+     ** @return The variance
+     ** @throw std::invalid_argument If the container has no more elements than ddof
+     */
+    template <class Iterator, typename DATA_TYPE = typename std::iterator_traits<Iterator>::value_type>
+    DATA_TYPE variance(const Iterator& begin, const Iterator& end, size_t ddof, Execution execution);
+
     /** @brief Compute the standard deviation of the container
      ** @param begin Begin iterator of the container
      ** @param end End iterator of the container
      ** @param ddof The divisor used in the calculation is N - ddof, 0 by default
      ** @return The standard deviation
+     ** @throw std::invalid_argument If the container has no more elements than ddof
      */
     template <class Iterator, typename DATA_TYPE = typename std::iterator_traits<Iterator>::value_type>
     DATA_TYPE standard_deviation(const Iterator& begin, const Iterator& end, size_t ddof = 0);
 
+    /** @brief Compute the standard deviation of the container, each chunk having its own VarianceAccumulator
+     ** @param begin Begin random access iterator of the container
+     ** @param end End random access iterator of the container
+     ** @param ddof The divisor used in the calculation is N - ddof
+     ** @param execution How the work is split
+     ** @return The standard deviation
+     ** @throw std::invalid_argument If the container has no more elements than ddof
+     */
+    template <class Iterator, typename DATA_TYPE = typename std::iterator_traits<Iterator>::value_type>
+    DATA_TYPE standard_deviation(const Iterator& begin, const Iterator& end, size_t ddof, Execution execution);
+
+    /** @brief Reduce each column of a row-major matrix in one sweep over its rows
+     ** @details The first row is copied in the result, then every following row is folded into it element-wise. The
+     ** inner loop runs along a contiguous row, so it vectorizes, where walking a column would stride through memory.
+     ** The result is left untouched when the height is zero.
+     ** @param height The height of the matrix
+     ** @param width The width of the matrix
+     ** @param data The first element of the matrix
+     ** @param row_stride The distance between two rows of the matrix
+     ** @param result The width reduced values, overwritten
+     ** @param function The binary operation, taking the value reduced so far and the element of the row
+     */
+    template <typename DATA_TYPE, class Function>
+    void reduce_columns(size_t height,
+                        size_t width,
+                        const DATA_TYPE* data,
+                        ptrdiff_t row_stride,
+                        DATA_TYPE* result,
+                        const Function& function);
+
+    /** @brief Compute the sum of each column of a row-major matrix in one sweep over its rows
+     ** @param height The height of the matrix
+     ** @param width The width of the matrix
+     ** @param data The first element of the matrix
+     ** @param row_stride The distance between two rows of the matrix
+     ** @param result The width sums, overwritten
+     */
+    template <typename DATA_TYPE>
+    void sum_columns(size_t height, size_t width, const DATA_TYPE* data, ptrdiff_t row_stride, DATA_TYPE* result);
+
+    /** @brief Compute the min of each column of a row-major matrix in one sweep over its rows
+     ** @param height The height of the matrix, not zero
+     ** @param width The width of the matrix
+     ** @param data The first element of the matrix
+     ** @param row_stride The distance between two rows of the matrix
+     ** @param result The width mins, overwritten
+     */
+    template <typename DATA_TYPE>
+    void min_columns(size_t height, size_t width, const DATA_TYPE* data, ptrdiff_t row_stride, DATA_TYPE* result);
+
+    /** @brief Compute the max of each column of a row-major matrix in one sweep over its rows
+     ** @param height The height of the matrix, not zero
+     ** @param width The width of the matrix
+     ** @param data The first element of the matrix
+     ** @param row_stride The distance between two rows of the matrix
+     ** @param result The width maxs, overwritten
+     */
+    template <typename DATA_TYPE>
+    void max_columns(size_t height, size_t width, const DATA_TYPE* data, ptrdiff_t row_stride, DATA_TYPE* result);
+
+    /** @brief Compute the mean of each column of a row-major matrix in one sweep over its rows
+     ** @param height The height of the matrix
+     ** @param width The width of the matrix
+     ** @param data The first element of the matrix
+     ** @param row_stride The distance between two rows of the matrix
+     ** @param result The width means, overwritten
+     */
+    template <typename DATA_TYPE>
+    void mean_columns(size_t height, size_t width, const DATA_TYPE* data, ptrdiff_t row_stride, DATA_TYPE* result);
+
+    /** @brief Compute the sum-product of each column of a row-major matrix in one sweep over its rows
+     ** @param height The height of the matrix
+     ** @param width The width of the matrix
+     ** @param data The first element of the matrix
+     ** @param row_stride The distance between two rows of the matrix
+     ** @param result The width sum-products, overwritten
+     */
+    template <typename DATA_TYPE>
+    void sum_product_columns(
+        size_t height, size_t width, const DATA_TYPE* data, ptrdiff_t row_stride, DATA_TYPE* result);
+
+    /** @brief Compute the variance of each column of a row-major matrix in one sweep over its rows
+     ** @details Blocks of rows are reduced into one accumulator per column, merged into the running ones. Every
+     ** loop runs along the contiguous rows, so it vectorizes and no column is walked with a stride.
+     ** @param height The height of the matrix
+     ** @param width The width of the matrix
+     ** @param data The first element of the matrix
+     ** @param row_stride The distance between two rows of the matrix
+     ** @param result The width variances, overwritten
+     ** @param ddof The divisor used in the calculation is N - ddof, 0 by default
+     ** @throw std::invalid_argument If the matrix is not empty and has no more rows than ddof
+     */
+    template <typename DATA_TYPE>
+    void variance_columns(
+        size_t height, size_t width, const DATA_TYPE* data, ptrdiff_t row_stride, DATA_TYPE* result, size_t ddof = 0);
+
+    /** @brief Merge the moments of each column of a row-major matrix into one running accumulator per column
+     ** @details The same sweep as variance_columns, so a matrix given by blocks of rows, as one read from a file
+     ** larger than the memory, gets the variances of its columns without a second pass over its rows.
+     ** @param height The height of the matrix
+     ** @param width The width of the matrix
+     ** @param data The first element of the matrix
+     ** @param row_stride The distance between two rows of the matrix
+     ** @param result The width accumulators, each merged with the elements of its column
+     ** @param sum The width sums of the columns of the matrix, overwritten, nullptr to skip the sums, the mins and the
+     ** maxs
+     ** @param min The width mins of the columns of the matrix, overwritten
+     ** @param max The width maxs of the columns of the matrix, overwritten
+     */
+    template <typename DATA_TYPE>
+    void accumulate_columns(size_t height,
+                            size_t width,
+                            const DATA_TYPE* data,
+                            ptrdiff_t row_stride,
+                            VarianceAccumulator<DATA_TYPE>* result,
+                            DATA_TYPE* sum = nullptr,
+                            DATA_TYPE* min = nullptr,
+                            DATA_TYPE* max = nullptr);
+
+    /** @brief Compute the sum, min, max, mean, variance, standard deviation and peak to peak of the container
+     ** @details One pass over the container, the same as variance, min and max come for free along the sum
+     ** @param begin Begin iterator of the container
+     ** @param end End iterator of the container
+     ** @param ddof The divisor used in the calculation of the variance is N - ddof, 0 by default
+     ** @return The statistics, all zero for an empty container
+     ** @throw std::invalid_argument If the container is not empty and has no more elements than ddof
+     */
+    template <class Iterator, typename DATA_TYPE = typename std::iterator_traits<Iterator>::value_type>
+    Description<DATA_TYPE> describe(const Iterator& begin, const Iterator& end, size_t ddof = 0);
+
+    /** @brief Compute the statistics of describe for each column of a row-major matrix in one sweep over its rows
+     ** @param height The height of the matrix
+     ** @param width The width of the matrix
+     ** @param data The first element of the matrix
+     ** @param row_stride The distance between two rows of the matrix
+     ** @param result The width statistics of each kind, overwritten
+     ** @param ddof The divisor used in the calculation of the variance is N - ddof, 0 by default
+     ** @throw std::invalid_argument If the matrix is not empty and has no more rows than ddof
+     */
+    template <typename DATA_TYPE>
+    void describe_columns(size_t height,
+                          size_t width,
+                          const DATA_TYPE* data,
+                          ptrdiff_t row_stride,
+                          const Description<DATA_TYPE*>& result,
+                          size_t ddof = 0);
+
+    /** @brief Compute the statistics of describe for each row of a row-major matrix
+     ** @param height The height of the matrix
+     ** @param width The width of the matrix
+     ** @param data The first element of the matrix
+     ** @param row_stride The distance between two rows of the matrix
+     ** @param result The height statistics of each kind, overwritten
+     ** @param ddof The divisor used in the calculation of the variance is N - ddof, 0 by default
+     */
+    template <typename DATA_TYPE>
+    void describe_rows(size_t height,
+                       size_t width,
+                       const DATA_TYPE* data,
+                       ptrdiff_t row_stride,
+                       const Description<DATA_TYPE*>& result,
+                       size_t ddof = 0);
+
+    /** @brief Instantiate a description whose statistics are all copies of one value
+     ** @param value The value, a matrix of the shape of the result for the rows or the columns of a matrix
+     ** @return The description
+     */
+    template <typename VALUE>
+    Description<VALUE> make_description(const VALUE& value);
+
+    /** @brief Get the addresses of the data of the matrices of a description, for the row-major kernels
+     ** @param description The description, each statistic is a matrix
+     ** @return The description of the addresses
+     */
+    template <class MATRIX>
+    auto get_data(Description<MATRIX>& description);
+
     /** @brief Compute the sum-product of the container
      ** @param begin Begin iterator of the container
      ** @param end End iterator of the container
@@ -6,8 +6,13 @@
 #include <algorithm>
 #include <cmath>
 #include <numeric>
+#include <stdexcept>
+#include <type_traits>
 #include <vector>
 
+#include "computation/simd.hh"
+#include "parallel/thread_pool.hh"
+
 namespace ml::computation::statistic
 {
     template <class Iterator, typename DATA_TYPE>
@@ -16,6 +21,62 @@ namespace ml::computation::statistic
         return std::accumulate<Iterator, DATA_TYPE>(begin, end, 0);
     }
 
+    /** @brief Reduce chunks of a container in parallel then merge their results in the order of the chunks
+     ** @param begin Begin random access iterator of the container
+     ** @param end End random access iterator of the container
+     ** @param execution How the work is split
+     ** @param function The function reducing the [chunk_begin, chunk_end) range of a chunk
+     ** @param merge The function merging the result of the next chunk into the result of the previous ones
+     ** @return The result of the whole container
+     */
+    template <class Iterator, class Function, class Merge>
+    static auto reduce_chunks(
+        const Iterator& begin, const Iterator& end, Execution execution, const Function& function, const Merge& merge)
+    {
+        using difference_type = typename std::iterator_traits<Iterator>::difference_type;
+
+        const auto size = static_cast<size_t>(end - begin);
+        const size_t thread_count = ml::parallel::get_thread_count();
+
+        if (execution == Execution::SEQUENTIAL || size == 0
+            || (execution == Execution::PARALLEL && (size < PARALLEL_REDUCTION_SIZE || thread_count == 1)))
+            return function(begin, end);
+
+        // The deterministic chunks do not depend on the thread count, nor on which thread runs them
+        const size_t chunk_size =
+            execution == Execution::DETERMINISTIC ? REDUCTION_CHUNK_SIZE : (size + thread_count - 1) / thread_count;
+        const size_t chunk_count = (size + chunk_size - 1) / chunk_size;
+
+        std::vector<decltype(function(begin, end))> partials(chunk_count);
+        ml::parallel::get_thread_pool().parallel_for(0, chunk_count, 1, [&](size_t chunk_begin, size_t chunk_end) {
+            for (size_t chunk = chunk_begin; chunk < chunk_end; chunk++)
+            {
+                const auto offset = static_cast<difference_type>(chunk * chunk_size);
+                const auto count = static_cast<difference_type>(std::min(chunk_size, size - chunk * chunk_size));
+                partials[chunk] = function(begin + offset, begin + offset + count);
+            }
+        });
+
+        auto result = partials[0];
+        for (size_t chunk = 1; chunk < chunk_count; chunk++)
+            result = merge(result, partials[chunk]);
+
+        return result;
+    }
+
+    template <class Iterator, typename DATA_TYPE>
+    DATA_TYPE sum(const Iterator& begin, const Iterator& end, Execution execution)
+    {
+        return reduce_chunks(
+            begin,
+            end,
+            execution,
+            [](const Iterator& chunk_begin, const Iterator& chunk_end) {
+                return ml::computation::statistic::sum<Iterator, DATA_TYPE>(chunk_begin, chunk_end);
+            },
+            [](const DATA_TYPE& lhs, const DATA_TYPE& rhs) { return lhs + rhs; });
+    }
+
     template <class Iterator, typename DATA_TYPE>
     DATA_TYPE mean(const Iterator& begin, const Iterator& end)
     {
@@ -27,46 +88,69 @@ namespace ml::computation::statistic
     }
 
     template <class Iterator, typename DATA_TYPE>
-    DATA_TYPE median(const Iterator& begin, const Iterator& end)
+    DATA_TYPE mean(const Iterator& begin, const Iterator& end, Execution execution)
     {
+        auto mean = ml::computation::statistic::sum<Iterator, DATA_TYPE>(begin, end, execution);
         auto count = end - begin;
 
-        std::vector<DATA_TYPE> data(count);
-        size_t i = 0;
-        for (auto it = begin; it < end; ++it)
-            data[i++] = *it;
+        mean /= count;
+        return mean;
+    }
 
-        if (count > 2)
-            std::sort(data.begin(), data.end());
+    template <class Iterator, typename DATA_TYPE>
+    inline DATA_TYPE median(const Iterator& begin, const Iterator& end)
+    {
+        std::vector<DATA_TYPE> buffer;
+        return ml::computation::statistic::median(begin, end, buffer);
+    }
 
-        auto mid = count / 2;
+    template <class Iterator, typename DATA_TYPE>
+    inline DATA_TYPE median(const Iterator& begin, const Iterator& end, std::vector<DATA_TYPE>& buffer)
+    {
+        buffer.assign(begin, end);
+        return ml::computation::statistic::median_in_place(buffer.begin(), buffer.end());
+    }
+
+    template <class Iterator, typename DATA_TYPE>
+    DATA_TYPE median_in_place(const Iterator& begin, const Iterator& end)
+    {
+        auto count = end - begin;
+        auto middle = begin + count / 2;
+
+        std::nth_element(begin, middle, end);
+        DATA_TYPE median = *middle;
 
         if (count % 2 == 0)
         {
-            auto median = data[mid - 1];
-            median += data[mid];
+            // nth_element leaves the lower half before the middle, its greatest element is the lower middle one
+            median += *std::max_element(begin, middle);
             median /= 2;
-            return median;
         }
 
-        return data[mid];
+        return median;
     }
 
     template <class Iterator, typename DATA_TYPE>
-    DATA_TYPE variance(const Iterator& begin, const Iterator& end, size_t ddof)
+    inline DATA_TYPE variance(const Iterator& begin, const Iterator& end, size_t ddof)
     {
-        auto mean = ml::computation::statistic::sum(begin, end);
-        auto count = end - begin;
-        mean /= count;
-
-        DATA_TYPE error_sum = 0;
+        return VarianceAccumulator<DATA_TYPE>().add(begin, end).get_variance(ddof);
+    }
 
-        for (auto it = begin; it < end; ++it)
-            error_sum += std::pow(*it - mean, 2);
+    template <class Iterator, typename DATA_TYPE>
+    DATA_TYPE variance(const Iterator& begin, const Iterator& end, size_t ddof, Execution execution)
+    {
+        const auto accumulator = reduce_chunks(
+            begin,
+            end,
+            execution,
+            [](const Iterator& chunk_begin, const Iterator& chunk_end) {
+                return VarianceAccumulator<DATA_TYPE>().add(chunk_begin, chunk_end);
+            },
+            [](VarianceAccumulator<DATA_TYPE> lhs, const VarianceAccumulator<DATA_TYPE>& rhs) {
+                return lhs.merge(rhs);
+            });
 
-        count -= ddof;
-        error_sum /= count;
-        return error_sum;
+        return accumulator.get_variance(ddof);
     }
 
     template <class Iterator, typename DATA_TYPE>
@@ -76,6 +160,362 @@ namespace ml::computation::statistic
         return std::sqrt(variance);
     }
 
+    template <class Iterator, typename DATA_TYPE>
+    inline DATA_TYPE standard_deviation(const Iterator& begin, const Iterator& end, size_t ddof, Execution execution)
+    {
+        auto variance = ml::computation::statistic::variance<Iterator, DATA_TYPE>(begin, end, ddof, execution);
+        return std::sqrt(variance);
+    }
+
+    /** @brief Sweep the rows of a row-major matrix, accumulating the moments of each column by blocks of rows
+     ** @param height The height of the matrix, at least one
+     ** @param width The width of the matrix, at least one
+     ** @param data The first element of the matrix
+     ** @param row_stride The distance between two rows of the matrix
+     ** @param mean The width means, overwritten
+     ** @param squared_error The width sums of squared deviations, overwritten
+     ** @param sum The width sums, overwritten, nullptr to skip the sums, the mins and the maxs
+     ** @param min The width mins, overwritten
+     ** @param max The width maxs, overwritten
+     */
+    template <typename DATA_TYPE>
+    static void sweep_columns(size_t height,
+                              size_t width,
+                              const DATA_TYPE* data,
+                              ptrdiff_t row_stride,
+                              moment_t<DATA_TYPE>* mean,
+                              moment_t<DATA_TYPE>* squared_error,
+                              DATA_TYPE* sum,
+                              DATA_TYPE* min,
+                              DATA_TYPE* max)
+    {
+        using moment_type = moment_t<DATA_TYPE>;
+
+        std::vector<moment_type> block_mean_vector(width);
+        std::vector<moment_type> block_squared_error_vector(width);
+        moment_type* block_mean = block_mean_vector.data();
+        moment_type* block_squared_error = block_squared_error_vector.data();
+
+        std::fill(mean, mean + width, 0);
+        std::fill(squared_error, squared_error + width, 0);
+        if (sum != nullptr)
+        {
+            std::fill(sum, sum + width, 0);
+            std::copy(data, data + width, min);
+            std::copy(data, data + width, max);
+        }
+
+        const size_t block_height = std::max<size_t>(1, VARIANCE_BLOCK_SIZE / width);
+
+        ml::computation::simd::dispatch([&]() {
+            for (size_t block_begin = 0; block_begin < height; block_begin += block_height)
+            {
+                const size_t block_count = std::min(block_height, height - block_begin);
+                const DATA_TYPE* block = data + static_cast<ptrdiff_t>(block_begin) * row_stride;
+
+                std::fill(block_mean, block_mean + width, 0);
+                for (size_t i = 0; i < block_count; i++)
+                {
+                    const DATA_TYPE* row = block + static_cast<ptrdiff_t>(i) * row_stride;
+                    for (size_t j = 0; j < width; j++)
+                        block_mean[j] += static_cast<moment_type>(row[j]);
+
+                    // The row is still in the L1 cache, a separate loop keeps the one above a plain sum
+                    if (sum != nullptr)
+                    {
+                        for (size_t j = 0; j < width; j++)
+                        {
+                            min[j] = std::min(min[j], row[j]);
+                            max[j] = std::max(max[j], row[j]);
+                        }
+                    }
+                }
+
+                if (sum != nullptr)
+                {
+                    for (size_t j = 0; j < width; j++)
+                        sum[j] += static_cast<DATA_TYPE>(block_mean[j]);
+                }
+
+                for (size_t j = 0; j < width; j++)
+                    block_mean[j] /= static_cast<moment_type>(block_count);
+
+                std::fill(block_squared_error, block_squared_error + width, 0);
+                for (size_t i = 0; i < block_count; i++)
+                {
+                    const DATA_TYPE* row = block + static_cast<ptrdiff_t>(i) * row_stride;
+                    for (size_t j = 0; j < width; j++)
+                    {
+                        const moment_type deviation = static_cast<moment_type>(row[j]) - block_mean[j];
+                        block_squared_error[j] += deviation * deviation;
+                    }
+                }
+
+                // Same merge as VarianceAccumulator::merge, the counts are shared by all the columns
+                const auto count = static_cast<moment_type>(block_begin);
+                const auto block_count_value = static_cast<moment_type>(block_count);
+                const auto new_count = static_cast<moment_type>(block_begin + block_count);
+                for (size_t j = 0; j < width; j++)
+                {
+                    const moment_type delta = block_mean[j] - mean[j];
+                    mean[j] += delta * block_count_value / new_count;
+                    squared_error[j] +=
+                        block_squared_error[j] + delta * delta * count * block_count_value / new_count;
+                }
+            }
+        });
+    }
+
+    template <typename DATA_TYPE, class Function>
+    void reduce_columns(size_t height,
+                        size_t width,
+                        const DATA_TYPE* data,
+                        ptrdiff_t row_stride,
+                        DATA_TYPE* result,
+                        const Function& function)
+    {
+        if (height == 0)
+            return;
+
+        std::copy(data, data + width, result);
+
+        ml::computation::simd::dispatch([&]() {
+            for (size_t i = 1; i < height; i++)
+            {
+                const DATA_TYPE* row = data + static_cast<ptrdiff_t>(i) * row_stride;
+                for (size_t j = 0; j < width; j++)
+                    result[j] = function(result[j], row[j]);
+            }
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline void sum_columns(size_t height, size_t width, const DATA_TYPE* data, ptrdiff_t row_stride, DATA_TYPE* result)
+    {
+        if (height == 0)
+            std::fill(result, result + width, 0);
+
+        reduce_columns(height, width, data, row_stride, result, [](DATA_TYPE lhs, DATA_TYPE rhs) { return lhs + rhs; });
+    }
+
+    // The selections are written by value, std::min and std::max return a reference which adds a branch to the loop
+    template <typename DATA_TYPE>
+    inline void min_columns(size_t height, size_t width, const DATA_TYPE* data, ptrdiff_t row_stride, DATA_TYPE* result)
+    {
+        reduce_columns(height, width, data, row_stride, result, [](DATA_TYPE lhs, DATA_TYPE rhs) {
+            return rhs < lhs ? rhs : lhs;
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline void max_columns(size_t height, size_t width, const DATA_TYPE* data, ptrdiff_t row_stride, DATA_TYPE* result)
+    {
+        reduce_columns(height, width, data, row_stride, result, [](DATA_TYPE lhs, DATA_TYPE rhs) {
+            return rhs > lhs ? rhs : lhs;
+        });
+    }
+
+    template <typename DATA_TYPE>
+    void mean_columns(size_t height, size_t width, const DATA_TYPE* data, ptrdiff_t row_stride, DATA_TYPE* result)
+    {
+        sum_columns(height, width, data, row_stride, result);
+
+        const auto count = static_cast<DATA_TYPE>(height);
+        for (size_t j = 0; j < width; j++)
+            result[j] /= count;
+    }
+
+    template <typename DATA_TYPE>
+    inline void
+    sum_product_columns(size_t height, size_t width, const DATA_TYPE* data, ptrdiff_t row_stride, DATA_TYPE* result)
+    {
+        if (height == 0)
+            std::fill(result, result + width, 1);
+
+        reduce_columns(height, width, data, row_stride, result, [](DATA_TYPE lhs, DATA_TYPE rhs) { return lhs * rhs; });
+    }
+
+    template <typename DATA_TYPE>
+    void variance_columns(
+        size_t height, size_t width, const DATA_TYPE* data, ptrdiff_t row_stride, DATA_TYPE* result, size_t ddof)
+    {
+        if (height == 0 || width == 0)
+            return;
+        if (height <= ddof)
+            throw std::invalid_argument("The number of elements must be greater than ddof");
+
+        std::vector<moment_t<DATA_TYPE>> mean(width);
+        std::vector<moment_t<DATA_TYPE>> squared_error(width);
+        sweep_columns<DATA_TYPE>(
+            height, width, data, row_stride, mean.data(), squared_error.data(), nullptr, nullptr, nullptr);
+
+        const auto count = static_cast<moment_t<DATA_TYPE>>(height - ddof);
+        for (size_t j = 0; j < width; j++)
+            result[j] = static_cast<DATA_TYPE>(squared_error[j] / count);
+    }
+
+    template <typename DATA_TYPE>
+    void accumulate_columns(size_t height,
+                            size_t width,
+                            const DATA_TYPE* data,
+                            ptrdiff_t row_stride,
+                            VarianceAccumulator<DATA_TYPE>* result,
+                            DATA_TYPE* sum,
+                            DATA_TYPE* min,
+                            DATA_TYPE* max)
+    {
+        if (height == 0 || width == 0)
+            return;
+
+        std::vector<moment_t<DATA_TYPE>> mean(width);
+        std::vector<moment_t<DATA_TYPE>> squared_error(width);
+        sweep_columns<DATA_TYPE>(height, width, data, row_stride, mean.data(), squared_error.data(), sum, min, max);
+
+        for (size_t j = 0; j < width; j++)
+            result[j].merge(VarianceAccumulator<DATA_TYPE>(height, mean[j], squared_error[j]));
+    }
+
+    template <class Iterator, typename DATA_TYPE>
+    Description<DATA_TYPE> describe(const Iterator& begin, const Iterator& end, size_t ddof)
+    {
+        using difference_type = typename std::iterator_traits<Iterator>::difference_type;
+
+        // An empty container has no element to start the min and the max from, as describe_columns of no row
+        if (begin == end)
+            return Description<DATA_TYPE>{0, 0, 0, 0, 0, 0, 0};
+
+        DATA_TYPE sum = 0;
+        DATA_TYPE min = *begin;
+        DATA_TYPE max = *begin;
+        VarianceAccumulator<DATA_TYPE> accumulator;
+
+        ml::computation::simd::dispatch([&]() {
+            for (auto block_begin = begin; block_begin != end;)
+            {
+                const auto block_count =
+                    std::min(end - block_begin, static_cast<difference_type>(VARIANCE_BLOCK_SIZE));
+                const auto block_end = block_begin + block_count;
+
+                // Local values selected by value: std::min returns a reference, which adds a branch to the loop
+                DATA_TYPE block_sum = 0;
+                DATA_TYPE block_min = *block_begin;
+                DATA_TYPE block_max = *block_begin;
+                for (auto it = block_begin; it != block_end; ++it)
+                {
+                    const DATA_TYPE value = *it;
+                    block_sum += value;
+                    block_min = value < block_min ? value : block_min;
+                    block_max = value > block_max ? value : block_max;
+                }
+
+                const auto block_mean =
+                    static_cast<moment_t<DATA_TYPE>>(block_sum) / static_cast<moment_t<DATA_TYPE>>(block_count);
+
+                moment_t<DATA_TYPE> block_squared_error = 0;
+                for (auto it = block_begin; it != block_end; ++it)
+                {
+                    const moment_t<DATA_TYPE> deviation = static_cast<moment_t<DATA_TYPE>>(*it) - block_mean;
+                    block_squared_error += deviation * deviation;
+                }
+
+                sum += block_sum;
+                min = std::min(min, block_min);
+                max = std::max(max, block_max);
+                accumulator.merge(VarianceAccumulator<DATA_TYPE>(block_count, block_mean, block_squared_error));
+                block_begin = block_end;
+            }
+        });
+
+        Description<DATA_TYPE> description;
+        description.sum = sum;
+        description.min = min;
+        description.max = max;
+        description.mean = sum / static_cast<DATA_TYPE>(end - begin);
+        description.variance = accumulator.get_variance(ddof);
+        description.standard_deviation = std::sqrt(description.variance);
+        description.peak_to_peak = max - min;
+
+        return description;
+    }
+
+    template <typename DATA_TYPE>
+    void describe_columns(size_t height,
+                          size_t width,
+                          const DATA_TYPE* data,
+                          ptrdiff_t row_stride,
+                          const Description<DATA_TYPE*>& result,
+                          size_t ddof)
+    {
+        if (height == 0 || width == 0)
+            return;
+        if (height <= ddof)
+            throw std::invalid_argument("The number of elements must be greater than ddof");
+
+        std::vector<moment_t<DATA_TYPE>> mean(width);
+        std::vector<moment_t<DATA_TYPE>> squared_error(width);
+        sweep_columns<DATA_TYPE>(height,
+                                 width,
+                                 data,
+                                 row_stride,
+                                 mean.data(),
+                                 squared_error.data(),
+                                 result.sum,
+                                 result.min,
+                                 result.max);
+
+        const auto count = static_cast<moment_t<DATA_TYPE>>(height - ddof);
+        for (size_t j = 0; j < width; j++)
+        {
+            result.mean[j] = result.sum[j] / static_cast<DATA_TYPE>(height);
+            result.variance[j] = static_cast<DATA_TYPE>(squared_error[j] / count);
+            result.standard_deviation[j] = std::sqrt(result.variance[j]);
+            result.peak_to_peak[j] = result.max[j] - result.min[j];
+        }
+    }
+
+    template <typename DATA_TYPE>
+    void describe_rows(size_t height,
+                       size_t width,
+                       const DATA_TYPE* data,
+                       ptrdiff_t row_stride,
+                       const Description<DATA_TYPE*>& result,
+                       size_t ddof)
+    {
+        for (size_t i = 0; i < height; i++)
+        {
+            const DATA_TYPE* row = data + static_cast<ptrdiff_t>(i) * row_stride;
+            const auto description = ml::computation::statistic::describe(row, row + width, ddof);
+
+            result.sum[i] = description.sum;
+            result.min[i] = description.min;
+            result.max[i] = description.max;
+            result.mean[i] = description.mean;
+            result.variance[i] = description.variance;
+            result.standard_deviation[i] = description.standard_deviation;
+            result.peak_to_peak[i] = description.peak_to_peak;
+        }
+    }
+
+    template <typename VALUE>
+    inline Description<VALUE> make_description(const VALUE& value)
+    {
+        return Description<VALUE>{value, value, value, value, value, value, value};
+    }
+
+    template <class MATRIX>
+    inline auto get_data(Description<MATRIX>& description)
+    {
+        using data_type_t = std::remove_reference_t<decltype(*description.sum.data().data())>;
+
+        return Description<data_type_t*>{description.sum.data().data(),
+                                         description.min.data().data(),
+                                         description.max.data().data(),
+                                         description.mean.data().data(),
+                                         description.variance.data().data(),
+                                         description.standard_deviation.data().data(),
+                                         description.peak_to_peak.data().data()};
+    }
+
     template <class Iterator, typename DATA_TYPE>
     inline DATA_TYPE sum_product(const Iterator& begin, const Iterator& end)
     {
@@ -0,0 +1,56 @@
+/**
+ ** @file src/computation/transpose.hh
+ ** @brief Declaration of ml::computation::transpose functions
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace ml::computation::transpose
+{
+    /// The recursion stops on blocks of at most BLOCK_SIZE x BLOCK_SIZE elements, whose source and destination rows
+    /// stay in the L1 cache
+    constexpr size_t BLOCK_SIZE = 32;
+
+    /// The blocks are split on multiples of SPLIT_ALIGNMENT so that the vectorised tiles are not cut
+    constexpr size_t SPLIT_ALIGNMENT = 16;
+
+    /** @brief Write the transpose of a row-major height x width matrix into destination
+     ** @details The matrix is recursively split in halves along its longer side until the blocks fit the cache,
+     ** so that neither the reads nor the strided writes thrash the cache or the TLB whatever the size.
+     ** @param height The height of source
+     ** @param width The width of source
+     ** @param source The row-major source
+     ** @param destination The row-major width x height destination, not overlapping source
+     */
+    template <typename DATA_TYPE>
+    void copy(size_t height, size_t width, const DATA_TYPE* source, DATA_TYPE* destination);
+
+    /** @brief Write the transpose of a row-major height x width block into a destination block
+     ** @param height The height of source
+     ** @param width The width of source
+     ** @param source The row-major source
+     ** @param source_stride The distance between two rows of source
+     ** @param destination The row-major width x height destination, not overlapping source
+     ** @param destination_stride The distance between two rows of destination
+     */
+    template <typename DATA_TYPE>
+    void copy(size_t height,
+              size_t width,
+              const DATA_TYPE* source,
+              size_t source_stride,
+              DATA_TYPE* destination,
+              size_t destination_stride);
+
+    /** @brief Transpose a row-major square matrix in place
+     ** @details The diagonal blocks are transposed in place and the blocks on both sides of the diagonal are
+     ** swapped, with the same recursive split as copy.
+     ** @param size The height and width of the matrix
+     ** @param data The row-major matrix
+     */
+    template <typename DATA_TYPE>
+    void in_place(size_t size, DATA_TYPE* data);
+} // namespace ml::computation::transpose
+
+#include "computation/transpose.hxx"
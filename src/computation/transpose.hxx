@@ -0,0 +1,152 @@
+/**
+ ** @file src/computation/transpose.hxx
+ ** @brief Implementation of ml::computation::transpose templated functions
+ */
+
+#include <algorithm>
+#include <array>
+#include <type_traits>
+
+#include "computation/simd.hh"
+
+namespace ml::computation::transpose
+{
+    /// Transpose a block fitting the cache, with shuffles on the vector registers for float and double
+    template <typename DATA_TYPE>
+    static void transpose_block(size_t height,
+                                size_t width,
+                                const DATA_TYPE* source,
+                                size_t source_stride,
+                                DATA_TYPE* destination,
+                                size_t destination_stride)
+    {
+        if constexpr (std::is_same_v<DATA_TYPE, float> || std::is_same_v<DATA_TYPE, double>)
+        {
+            ml::computation::simd::transpose(height, width, source, source_stride, destination, destination_stride);
+        }
+        else
+        {
+            for (size_t i = 0; i < height; i++)
+            {
+                for (size_t j = 0; j < width; j++)
+                    destination[j * destination_stride + i] = source[i * source_stride + j];
+            }
+        }
+    }
+
+    /// Split a dimension larger than BLOCK_SIZE in two, on a multiple of SPLIT_ALIGNMENT
+    static inline size_t split_size(size_t size)
+    {
+        return size / 2 / SPLIT_ALIGNMENT * SPLIT_ALIGNMENT;
+    }
+
+    template <typename DATA_TYPE>
+    static void copy_recursive(size_t height,
+                               size_t width,
+                               const DATA_TYPE* source,
+                               size_t source_stride,
+                               DATA_TYPE* destination,
+                               size_t destination_stride)
+    {
+        if (height <= BLOCK_SIZE && width <= BLOCK_SIZE)
+            return transpose_block(height, width, source, source_stride, destination, destination_stride);
+
+        // The rows of source are the columns of destination and the other way around
+        if (height >= width)
+        {
+            const size_t half = split_size(height);
+            copy_recursive(half, width, source, source_stride, destination, destination_stride);
+            copy_recursive(height - half,
+                           width,
+                           source + half * source_stride,
+                           source_stride,
+                           destination + half,
+                           destination_stride);
+        }
+        else
+        {
+            const size_t half = split_size(width);
+            copy_recursive(height, half, source, source_stride, destination, destination_stride);
+            copy_recursive(height,
+                           width - half,
+                           source + half,
+                           source_stride,
+                           destination + half * destination_stride,
+                           destination_stride);
+        }
+    }
+
+    /// Replace the height x width block lhs by the transpose of the width x height block rhs and the other way around
+    template <typename DATA_TYPE>
+    static void swap_recursive(size_t height, size_t width, DATA_TYPE* lhs, DATA_TYPE* rhs, size_t stride)
+    {
+        if (height <= BLOCK_SIZE && width <= BLOCK_SIZE)
+        {
+            std::array<DATA_TYPE, BLOCK_SIZE * BLOCK_SIZE> buffer;
+            transpose_block(height, width, lhs, stride, buffer.data(), height);
+            transpose_block(width, height, rhs, stride, lhs, stride);
+
+            for (size_t i = 0; i < width; i++)
+                std::copy(buffer.data() + i * height, buffer.data() + (i + 1) * height, rhs + i * stride);
+
+            return;
+        }
+
+        if (height >= width)
+        {
+            const size_t half = split_size(height);
+            swap_recursive(half, width, lhs, rhs, stride);
+            swap_recursive(height - half, width, lhs + half * stride, rhs + half, stride);
+        }
+        else
+        {
+            const size_t half = split_size(width);
+            swap_recursive(height, half, lhs, rhs, stride);
+            swap_recursive(height, width - half, lhs + half, rhs + half * stride, stride);
+        }
+    }
+
+    /// Transpose in place the size x size block on the diagonal starting at data
+    template <typename DATA_TYPE>
+    static void in_place_recursive(size_t size, DATA_TYPE* data, size_t stride)
+    {
+        if (size <= BLOCK_SIZE)
+        {
+            std::array<DATA_TYPE, BLOCK_SIZE * BLOCK_SIZE> buffer;
+            transpose_block(size, size, data, stride, buffer.data(), size);
+
+            for (size_t i = 0; i < size; i++)
+                std::copy(buffer.data() + i * size, buffer.data() + (i + 1) * size, data + i * stride);
+
+            return;
+        }
+
+        const size_t half = split_size(size);
+        in_place_recursive(half, data, stride);
+        in_place_recursive(size - half, data + half * stride + half, stride);
+        swap_recursive(size - half, half, data + half * stride, data + half, stride);
+    }
+
+    template <typename DATA_TYPE>
+    void copy(size_t height, size_t width, const DATA_TYPE* source, DATA_TYPE* destination)
+    {
+        copy_recursive(height, width, source, width, destination, height);
+    }
+
+    template <typename DATA_TYPE>
+    void copy(size_t height,
+              size_t width,
+              const DATA_TYPE* source,
+              size_t source_stride,
+              DATA_TYPE* destination,
+              size_t destination_stride)
+    {
+        copy_recursive(height, width, source, source_stride, destination, destination_stride);
+    }
+
+    template <typename DATA_TYPE>
+    void in_place(size_t size, DATA_TYPE* data)
+    {
+        in_place_recursive(size, data, size);
+    }
+} // namespace ml::computation::transpose
@@ -0,0 +1,111 @@
+/**
+ ** @file src/computation/variance_accumulator.hh
+ ** @brief Declaration of ml::computation::statistic::VarianceAccumulator
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+namespace ml::computation::statistic
+{
+    /// The ranges are reduced by blocks of VARIANCE_BLOCK_SIZE elements, summed then read again for their squared
+    /// deviations while they are still in the L1 cache
+    constexpr size_t VARIANCE_BLOCK_SIZE = 2048;
+
+    /// The type in which the moments of DATA_TYPE are accumulated: the mean and the squared deviations of integers
+    /// are not integers, truncating them would make the variance depend on the order of the updates and merges
+    template <typename DATA_TYPE>
+    using moment_t = std::conditional_t<std::is_integral_v<DATA_TYPE>, double, DATA_TYPE>;
+
+    /** @brief Mergeable partial result of a variance: the count, the mean and the sum of squared deviations
+     ** @details Two accumulators of disjoint ranges merge into the accumulator of their union with the formula of
+     ** Chan et al., so a range can be reduced by blocks, by threads or by rows in any order without a second pass.
+     ** The moments of the integer types are kept in double, only the variance is converted back to DATA_TYPE.
+     */
+    template <typename DATA_TYPE>
+    class VarianceAccumulator
+    {
+    public:
+        /// The type of the mean and of the sum of the squared deviations
+        using moment_type = moment_t<DATA_TYPE>;
+
+        /** @name Constructors
+         ** \{ */
+
+        /// @brief Instantiate the accumulator of an empty range
+        VarianceAccumulator();
+
+        /** @brief Instantiate an accumulator from its partial results
+         ** @param count The number of elements
+         ** @param mean The mean of the elements
+         ** @param squared_error The sum of the squared deviations of the elements from their mean
+         */
+        VarianceAccumulator(size_t count, const moment_type& mean, const moment_type& squared_error);
+
+        /** \} */
+
+        /** @name Operations
+         ** \{ */
+
+        /** @brief Add one element, with the update of Welford
+         ** @param value The element
+         ** @return The reference to the current accumulator
+         */
+        VarianceAccumulator<DATA_TYPE>& add(const DATA_TYPE& value);
+
+        /** @brief Add every element of a range, summed by blocks read twice from the cache
+         ** @param begin Begin iterator of the range
+         ** @param end End iterator of the range
+         ** @return The reference to the current accumulator
+         */
+        template <class Iterator>
+        VarianceAccumulator<DATA_TYPE>& add(const Iterator& begin, const Iterator& end);
+
+        /** @brief Merge the accumulator of a disjoint range
+         ** @param other The other accumulator
+         ** @return The reference to the current accumulator
+         */
+        VarianceAccumulator<DATA_TYPE>& merge(const VarianceAccumulator<DATA_TYPE>& other);
+
+        /** \} */
+
+        /** @name Accessors
+         ** \{ */
+
+        /** @brief Get the number of elements
+         ** @return The number of elements
+         */
+        size_t get_count() const;
+
+        /** @brief Get the mean of the elements
+         ** @return The mean
+         */
+        const moment_type& get_mean() const;
+
+        /** @brief Get the sum of the squared deviations of the elements from their mean
+         ** @return The sum of the squared deviations
+         */
+        const moment_type& get_squared_error() const;
+
+        /** @brief Get the variance of the elements
+         ** @param ddof The divisor used in the calculation is N - ddof, 0 by default
+         ** @return The variance
+         ** @throw std::invalid_argument If the number of elements is not greater than ddof
+         */
+        DATA_TYPE get_variance(size_t ddof = 0) const;
+
+        /** \} */
+
+    private:
+        /// The number of elements
+        size_t count_;
+        /// The mean of the elements
+        moment_type mean_;
+        /// The sum of the squared deviations of the elements from their mean
+        moment_type squared_error_;
+    };
+} // namespace ml::computation::statistic
+
+#include "computation/variance_accumulator.hxx"
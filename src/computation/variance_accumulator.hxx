@@ -0,0 +1,125 @@
+/**
+ ** @file src/computation/variance_accumulator.hxx
+ ** @brief Implementation of ml::computation::statistic::VarianceAccumulator
+ */
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+#include "computation/simd.hh"
+
+namespace ml::computation::statistic
+{
+    template <typename DATA_TYPE>
+    VarianceAccumulator<DATA_TYPE>::VarianceAccumulator()
+        : count_(0)
+        , mean_(0)
+        , squared_error_(0)
+    {}
+
+    template <typename DATA_TYPE>
+    VarianceAccumulator<DATA_TYPE>::VarianceAccumulator(size_t count,
+                                                        const moment_type& mean,
+                                                        const moment_type& squared_error)
+        : count_(count)
+        , mean_(mean)
+        , squared_error_(squared_error)
+    {}
+
+    template <typename DATA_TYPE>
+    inline VarianceAccumulator<DATA_TYPE>& VarianceAccumulator<DATA_TYPE>::add(const DATA_TYPE& value)
+    {
+        count_++;
+
+        const auto moment_value = static_cast<moment_type>(value);
+        const moment_type delta = moment_value - mean_;
+        mean_ += delta / static_cast<moment_type>(count_);
+        squared_error_ += delta * (moment_value - mean_);
+
+        return *this;
+    }
+
+    template <typename DATA_TYPE>
+    template <class Iterator>
+    VarianceAccumulator<DATA_TYPE>& VarianceAccumulator<DATA_TYPE>::add(const Iterator& begin, const Iterator& end)
+    {
+        using difference_type = typename std::iterator_traits<Iterator>::difference_type;
+
+        ml::computation::simd::dispatch([&]() {
+            for (auto block_begin = begin; block_begin != end;)
+            {
+                const auto block_count =
+                    std::min(end - block_begin, static_cast<difference_type>(VARIANCE_BLOCK_SIZE));
+                const auto block_end = block_begin + block_count;
+
+                // Both loops are plain reductions, which vectorize, unlike the division of the update of Welford
+                moment_type block_mean = 0;
+                for (auto it = block_begin; it != block_end; ++it)
+                    block_mean += static_cast<moment_type>(*it);
+                block_mean /= static_cast<moment_type>(block_count);
+
+                moment_type block_squared_error = 0;
+                for (auto it = block_begin; it != block_end; ++it)
+                {
+                    const moment_type deviation = static_cast<moment_type>(*it) - block_mean;
+                    block_squared_error += deviation * deviation;
+                }
+
+                merge(VarianceAccumulator<DATA_TYPE>(block_count, block_mean, block_squared_error));
+                block_begin = block_end;
+            }
+        });
+
+        return *this;
+    }
+
+    template <typename DATA_TYPE>
+    VarianceAccumulator<DATA_TYPE>& VarianceAccumulator<DATA_TYPE>::merge(const VarianceAccumulator<DATA_TYPE>& other)
+    {
+        if (other.count_ == 0)
+            return *this;
+        if (count_ == 0)
+            return *this = other;
+
+        const size_t count = count_ + other.count_;
+        const moment_type delta = other.mean_ - mean_;
+        const auto count_value = static_cast<moment_type>(count);
+        const auto other_count_value = static_cast<moment_type>(other.count_);
+
+        mean_ += delta * other_count_value / count_value;
+        squared_error_ +=
+            other.squared_error_ + delta * delta * static_cast<moment_type>(count_) * other_count_value / count_value;
+        count_ = count;
+
+        return *this;
+    }
+
+    template <typename DATA_TYPE>
+    inline size_t VarianceAccumulator<DATA_TYPE>::get_count() const
+    {
+        return count_;
+    }
+
+    template <typename DATA_TYPE>
+    inline const typename VarianceAccumulator<DATA_TYPE>::moment_type& VarianceAccumulator<DATA_TYPE>::get_mean() const
+    {
+        return mean_;
+    }
+
+    template <typename DATA_TYPE>
+    inline const typename VarianceAccumulator<DATA_TYPE>::moment_type&
+    VarianceAccumulator<DATA_TYPE>::get_squared_error() const
+    {
+        return squared_error_;
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE VarianceAccumulator<DATA_TYPE>::get_variance(size_t ddof) const
+    {
+        if (count_ <= ddof)
+            throw std::invalid_argument("The number of elements must be greater than ddof");
+
+        return static_cast<DATA_TYPE>(squared_error_ / static_cast<moment_type>(count_ - ddof));
+    }
+} // namespace ml::computation::statistic
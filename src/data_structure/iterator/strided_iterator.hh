@@ -0,0 +1,191 @@
+/**
+ ** @file src/data_structure/iterator/strided_iterator.hh
+ ** @brief Declaration of ml::data_structure::iterator::StridedIterator functions
+ */
+
+#pragma once
+
+#include <iterator>
+
+namespace ml::data_structure::iterator
+{
+    /** @brief Iterator over every stride element of a container, meet the requirements of a LegacyRandomAccessIterator
+     ** @details The stride is a runtime value, so a single instantiation per base iterator serves every shape: the
+     ** columns of a DynamicMatrix or of a strided MatrixView share the code that UncheckedStepIterator instantiates
+     ** once per width. As with UncheckedStepIterator, nothing is bound checked: the caller stays in [0, count] and only
+     ** the element at index * stride is ever computed. Iterators compared or subtracted must share the same base and
+     ** stride.
+     */
+    template <class Iterator>
+    class StridedIterator
+    {
+    public:
+        /// Iterator difference type
+        using difference_type = typename std::iterator_traits<Iterator>::difference_type;
+        /// Iterator value type
+        using value_type = typename std::iterator_traits<Iterator>::value_type;
+        /// Iterator reference type
+        using reference = typename std::iterator_traits<Iterator>::reference;
+        /// Iterator pointer type
+        using pointer = typename std::iterator_traits<Iterator>::pointer;
+        /// Iterator category type
+        using iterator_category = std::random_access_iterator_tag;
+
+        /** @name Constructors
+         ** \{ */
+
+        /// Instantiate a StridedIterator
+        StridedIterator() = default;
+
+        /** @brief Instantiate a StridedIterator
+         ** @param base The iterator on the first element
+         ** @param stride The distance between two consecutive elements in the container
+         ** @param index The index of the element, in strides from the first element
+         */
+        StridedIterator(const Iterator& base, difference_type stride, difference_type index = 0);
+
+        /** \} */
+
+        /** @name Accessors
+         ** \{ */
+
+        /** @brief Member of pointer operator
+         ** @return A pointer to the value
+         */
+        pointer operator->() const;
+
+        /** @brief Indirect operator
+         ** @return A reference to the value
+         */
+        reference operator*() const;
+
+        /** @brief Subscript operator
+         ** @param index Subscript index
+         ** @return The value at the index
+         */
+        reference operator[](difference_type index) const;
+
+        /** \} */
+
+        /** @name Operators
+         ** \{ */
+
+        /** @brief Pre-increment operator
+         ** @return A reference to the iterator
+         */
+        StridedIterator<Iterator>& operator++();
+
+        /** @brief Post-increment operator
+         ** @return A copy to the iterator before the increment
+         */
+        StridedIterator<Iterator> operator++(int);
+
+        /** @brief Pre-decrement operator
+         ** @return A reference to the iterator
+         */
+        StridedIterator<Iterator>& operator--();
+
+        /** @brief Post-decrement operator
+         ** @return A copy to the iterator before the decrement
+         */
+        StridedIterator<Iterator> operator--(int);
+
+        /** @brief Addition assignment operator
+         ** @param increment The increment
+         ** @return A reference to the iterator
+         */
+        StridedIterator<Iterator>& operator+=(difference_type increment);
+
+        /** @brief Subtraction assignment operator
+         ** @param increment The increment
+         ** @return A reference to the iterator
+         */
+        StridedIterator<Iterator>& operator-=(difference_type increment);
+
+        /** @brief Addition operator
+         ** @param increment The increment
+         ** @return The new iterator
+         */
+        StridedIterator<Iterator> operator+(difference_type increment) const;
+
+        /** @brief Subtraction operator
+         ** @param increment The increment
+         ** @return The new iterator
+         */
+        StridedIterator<Iterator> operator-(difference_type increment) const;
+
+        /** @brief Distance operator
+         ** @param rhs The other iterator, over the same elements
+         ** @return The distance
+         */
+        difference_type operator-(const StridedIterator<Iterator>& rhs) const;
+
+        /** \} */
+
+        /** @name Comparators
+         ** \{ */
+
+        /** @brief Equal to operator
+         ** @param rhs The other iterator, over the same elements
+         ** @return True if both iterator are equal
+         */
+        bool operator==(const StridedIterator<Iterator>& rhs) const;
+
+        /** @brief Not equal to operator
+         ** @param rhs The other iterator, over the same elements
+         ** @return True if both iterator are not equal
+         */
+        bool operator!=(const StridedIterator<Iterator>& rhs) const;
+
+        /** @brief Less than operator
+         ** @param rhs The other iterator, over the same elements
+         ** @return True if the current iterator is smaller than the other
+         */
+        bool operator<(const StridedIterator<Iterator>& rhs) const;
+
+        /** @brief Greater than operator
+         ** @param rhs The other iterator, over the same elements
+         ** @return True if the current iterator is greater than the other
+         */
+        bool operator>(const StridedIterator<Iterator>& rhs) const;
+
+        /** @brief Less than or equal operator
+         ** @param rhs The other iterator, over the same elements
+         ** @return True if the current iterator is smaller or equal than the other
+         */
+        bool operator<=(const StridedIterator<Iterator>& rhs) const;
+
+        /** @brief Greater than or equal operator
+         ** @param rhs The other iterator, over the same elements
+         ** @return True if the current iterator is greater or equal than the other
+         */
+        bool operator>=(const StridedIterator<Iterator>& rhs) const;
+
+        /** @brief Get the stride of the StridedIterator
+         ** @return The stride
+         */
+        difference_type get_stride() const;
+
+        /** \} */
+
+    private:
+        /// The iterator on the first element
+        Iterator base_;
+        /// The distance between two consecutive elements in the container
+        difference_type stride_;
+        /// The index of the element, in strides from the first element
+        difference_type index_;
+    };
+
+    /** @brief Addition operator
+     ** @param increment The increment
+     ** @param iterator The iterator
+     ** @return The new iterator
+     */
+    template <class Iterator>
+    StridedIterator<Iterator>
+    operator+(typename std::iterator_traits<Iterator>::difference_type increment,
+              const StridedIterator<Iterator>& iterator);
+} // namespace ml::data_structure::iterator
+
+#include "data_structure/iterator/strided_iterator.hxx"
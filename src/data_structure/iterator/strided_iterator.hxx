@@ -0,0 +1,148 @@
+/**
+ ** @file src/data_structure/iterator/strided_iterator.hxx
+ ** @brief Implementation of ml::data_structure::iterator::StridedIterator functions
+ */
+
+namespace ml::data_structure::iterator
+{
+    template <class Iterator>
+    inline StridedIterator<Iterator>::StridedIterator(const Iterator& base,
+                                                      difference_type stride,
+                                                      difference_type index)
+        : base_(base)
+        , stride_(stride)
+        , index_(index)
+    {}
+
+    template <class Iterator>
+    inline typename StridedIterator<Iterator>::pointer StridedIterator<Iterator>::operator->() const
+    {
+        return &**this;
+    }
+
+    template <class Iterator>
+    inline typename StridedIterator<Iterator>::reference StridedIterator<Iterator>::operator*() const
+    {
+        return this->base_[this->index_ * this->stride_];
+    }
+
+    template <class Iterator>
+    inline typename StridedIterator<Iterator>::reference
+    StridedIterator<Iterator>::operator[](difference_type index) const
+    {
+        return this->base_[(this->index_ + index) * this->stride_];
+    }
+
+    template <class Iterator>
+    inline StridedIterator<Iterator>& StridedIterator<Iterator>::operator++()
+    {
+        ++this->index_;
+        return *this;
+    }
+
+    template <class Iterator>
+    inline StridedIterator<Iterator> StridedIterator<Iterator>::operator++(int)
+    {
+        StridedIterator<Iterator> copy = *this;
+        ++this->index_;
+        return copy;
+    }
+
+    template <class Iterator>
+    inline StridedIterator<Iterator>& StridedIterator<Iterator>::operator--()
+    {
+        --this->index_;
+        return *this;
+    }
+
+    template <class Iterator>
+    inline StridedIterator<Iterator> StridedIterator<Iterator>::operator--(int)
+    {
+        StridedIterator<Iterator> copy = *this;
+        --this->index_;
+        return copy;
+    }
+
+    template <class Iterator>
+    inline StridedIterator<Iterator>& StridedIterator<Iterator>::operator+=(difference_type increment)
+    {
+        this->index_ += increment;
+        return *this;
+    }
+
+    template <class Iterator>
+    inline StridedIterator<Iterator>& StridedIterator<Iterator>::operator-=(difference_type increment)
+    {
+        this->index_ -= increment;
+        return *this;
+    }
+
+    template <class Iterator>
+    inline StridedIterator<Iterator> StridedIterator<Iterator>::operator+(difference_type increment) const
+    {
+        return StridedIterator<Iterator>(this->base_, this->stride_, this->index_ + increment);
+    }
+
+    template <class Iterator>
+    inline StridedIterator<Iterator>
+    operator+(typename std::iterator_traits<Iterator>::difference_type increment,
+              const StridedIterator<Iterator>& iterator)
+    {
+        return iterator + increment;
+    }
+
+    template <class Iterator>
+    inline StridedIterator<Iterator> StridedIterator<Iterator>::operator-(difference_type increment) const
+    {
+        return StridedIterator<Iterator>(this->base_, this->stride_, this->index_ - increment);
+    }
+
+    template <class Iterator>
+    inline typename StridedIterator<Iterator>::difference_type
+    StridedIterator<Iterator>::operator-(const StridedIterator<Iterator>& rhs) const
+    {
+        return this->index_ - rhs.index_;
+    }
+
+    template <class Iterator>
+    inline bool StridedIterator<Iterator>::operator==(const StridedIterator<Iterator>& rhs) const
+    {
+        return this->index_ == rhs.index_;
+    }
+
+    template <class Iterator>
+    inline bool StridedIterator<Iterator>::operator!=(const StridedIterator<Iterator>& rhs) const
+    {
+        return this->index_ != rhs.index_;
+    }
+
+    template <class Iterator>
+    inline bool StridedIterator<Iterator>::operator<(const StridedIterator<Iterator>& rhs) const
+    {
+        return this->index_ < rhs.index_;
+    }
+
+    template <class Iterator>
+    inline bool StridedIterator<Iterator>::operator>(const StridedIterator<Iterator>& rhs) const
+    {
+        return this->index_ > rhs.index_;
+    }
+
+    template <class Iterator>
+    inline bool StridedIterator<Iterator>::operator<=(const StridedIterator<Iterator>& rhs) const
+    {
+        return this->index_ <= rhs.index_;
+    }
+
+    template <class Iterator>
+    inline bool StridedIterator<Iterator>::operator>=(const StridedIterator<Iterator>& rhs) const
+    {
+        return this->index_ >= rhs.index_;
+    }
+
+    template <class Iterator>
+    inline typename StridedIterator<Iterator>::difference_type StridedIterator<Iterator>::get_stride() const
+    {
+        return this->stride_;
+    }
+} // namespace ml::data_structure::iterator
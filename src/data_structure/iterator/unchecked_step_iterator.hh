@@ -0,0 +1,188 @@
+/**
+ ** @file src/data_structure/iterator/unchecked_step_iterator.hh
+ ** @brief Declaration of ml::data_structure::iterator::UncheckedStepIterator functions
+ */
+
+#pragma once
+
+#include <iterator>
+
+namespace ml::data_structure::iterator
+{
+    /** @brief Iterator over every STEP element of a container, meet the requirements of a LegacyRandomAccessIterator
+     ** @details Unlike StepIterator, nothing is clamped to the bounds of the container: the iterator is a base
+     ** iterator and the index of the element, so an increment is a single addition. The caller is responsible for
+     ** staying in [0, count], where count is the number of elements iterated over, which makes it an iterator for the
+     ** internal hot paths. Only the element at index * STEP is ever computed, so the end iterator of a column never
+     ** points after the end of the container.
+     */
+    template <class Iterator, typename std::iterator_traits<Iterator>::difference_type STEP>
+    class UncheckedStepIterator
+    {
+    public:
+        /// Iterator difference type
+        using difference_type = typename std::iterator_traits<Iterator>::difference_type;
+        /// Iterator value type
+        using value_type = typename std::iterator_traits<Iterator>::value_type;
+        /// Iterator reference type
+        using reference = typename std::iterator_traits<Iterator>::reference;
+        /// Iterator pointer type
+        using pointer = typename std::iterator_traits<Iterator>::pointer;
+        /// Iterator category type
+        using iterator_category = std::random_access_iterator_tag;
+
+        /** @name Constructors
+         ** \{ */
+
+        /// Instantiate an UncheckedStepIterator
+        UncheckedStepIterator() = default;
+
+        /** @brief Instantiate an UncheckedStepIterator
+         ** @param base The iterator on the first element
+         ** @param index The index of the element, in steps from the first element
+         */
+        explicit UncheckedStepIterator(const Iterator& base, difference_type index = 0);
+
+        /** \} */
+
+        /** @name Accessors
+         ** \{ */
+
+        /** @brief Member of pointer operator
+         ** @return A pointer to the value
+         */
+        pointer operator->() const;
+
+        /** @brief Indirect operator
+         ** @return A reference to the value
+         */
+        reference operator*() const;
+
+        /** @brief Subscript operator
+         ** @param index Subscript index
+         ** @return The value at the index
+         */
+        reference operator[](difference_type index) const;
+
+        /** \} */
+
+        /** @name Operators
+         ** \{ */
+
+        /** @brief Pre-increment operator
+         ** @return A reference to the iterator
+         */
+        UncheckedStepIterator<Iterator, STEP>& operator++();
+
+        /** @brief Post-increment operator
+         ** @return A copy to the iterator before the increment
+         */
+        UncheckedStepIterator<Iterator, STEP> operator++(int);
+
+        /** @brief Pre-decrement operator
+         ** @return A reference to the iterator
+         */
+        UncheckedStepIterator<Iterator, STEP>& operator--();
+
+        /** @brief Post-decrement operator
+         ** @return A copy to the iterator before the decrement
+         */
+        UncheckedStepIterator<Iterator, STEP> operator--(int);
+
+        /** @brief Addition assignment operator
+         ** @param increment The increment
+         ** @return A reference to the iterator
+         */
+        UncheckedStepIterator<Iterator, STEP>& operator+=(difference_type increment);
+
+        /** @brief Subtraction assignment operator
+         ** @param increment The increment
+         ** @return A reference to the iterator
+         */
+        UncheckedStepIterator<Iterator, STEP>& operator-=(difference_type increment);
+
+        /** @brief Addition operator
+         ** @param increment The increment
+         ** @return The new iterator
+         */
+        UncheckedStepIterator<Iterator, STEP> operator+(difference_type increment) const;
+
+        /** @brief Subtraction operator
+         ** @param increment The increment
+         ** @return The new iterator
+         */
+        UncheckedStepIterator<Iterator, STEP> operator-(difference_type increment) const;
+
+        /** @brief Distance operator
+         ** @param rhs The other iterator, over the same elements
+         ** @return The distance
+         */
+        difference_type operator-(const UncheckedStepIterator<Iterator, STEP>& rhs) const;
+
+        /** \} */
+
+        /** @name Comparators
+         ** \{ */
+
+        /** @brief Equal to operator
+         ** @param rhs The other iterator, over the same elements
+         ** @return True if both iterator are equal
+         */
+        bool operator==(const UncheckedStepIterator<Iterator, STEP>& rhs) const;
+
+        /** @brief Not equal to operator
+         ** @param rhs The other iterator, over the same elements
+         ** @return True if both iterator are not equal
+         */
+        bool operator!=(const UncheckedStepIterator<Iterator, STEP>& rhs) const;
+
+        /** @brief Less than operator
+         ** @param rhs The other iterator, over the same elements
+         ** @return True if the current iterator is smaller than the other
+         */
+        bool operator<(const UncheckedStepIterator<Iterator, STEP>& rhs) const;
+
+        /** @brief Greater than operator
+         ** @param rhs The other iterator, over the same elements
+         ** @return True if the current iterator is greater than the other
+         */
+        bool operator>(const UncheckedStepIterator<Iterator, STEP>& rhs) const;
+
+        /** @brief Less than or equal operator
+         ** @param rhs The other iterator, over the same elements
+         ** @return True if the current iterator is smaller or equal than the other
+         */
+        bool operator<=(const UncheckedStepIterator<Iterator, STEP>& rhs) const;
+
+        /** @brief Greater than or equal operator
+         ** @param rhs The other iterator, over the same elements
+         ** @return True if the current iterator is greater or equal than the other
+         */
+        bool operator>=(const UncheckedStepIterator<Iterator, STEP>& rhs) const;
+
+        /** @brief Get the current step of the UncheckedStepIterator
+         ** @return The step
+         */
+        static constexpr difference_type get_step();
+
+        /** \} */
+
+    private:
+        /// The iterator on the first element
+        Iterator base_;
+        /// The index of the element, in steps from the first element
+        difference_type index_;
+    };
+
+    /** @brief Addition operator
+     ** @param increment The increment
+     ** @param iterator The iterator
+     ** @return The new iterator
+     */
+    template <class Iterator, typename std::iterator_traits<Iterator>::difference_type STEP>
+    UncheckedStepIterator<Iterator, STEP>
+    operator+(typename std::iterator_traits<Iterator>::difference_type increment,
+              const UncheckedStepIterator<Iterator, STEP>& iterator);
+} // namespace ml::data_structure::iterator
+
+#include "data_structure/iterator/unchecked_step_iterator.hxx"
@@ -0,0 +1,156 @@
+/**
+ ** @file src/data_structure/iterator/unchecked_step_iterator.hxx
+ ** @brief Implementation of ml::data_structure::iterator::UncheckedStepIterator functions
+ */
+
+namespace ml::data_structure::iterator
+{
+    template <class Iterator, typename std::iterator_traits<Iterator>::difference_type STEP>
+    inline UncheckedStepIterator<Iterator, STEP>::UncheckedStepIterator(const Iterator& base, difference_type index)
+        : base_(base)
+        , index_(index)
+    {}
+
+    template <class Iterator, typename std::iterator_traits<Iterator>::difference_type STEP>
+    inline typename UncheckedStepIterator<Iterator, STEP>::pointer
+    UncheckedStepIterator<Iterator, STEP>::operator->() const
+    {
+        return &**this;
+    }
+
+    template <class Iterator, typename std::iterator_traits<Iterator>::difference_type STEP>
+    inline typename UncheckedStepIterator<Iterator, STEP>::reference
+    UncheckedStepIterator<Iterator, STEP>::operator*() const
+    {
+        return this->base_[this->index_ * STEP];
+    }
+
+    template <class Iterator, typename std::iterator_traits<Iterator>::difference_type STEP>
+    inline typename UncheckedStepIterator<Iterator, STEP>::reference
+    UncheckedStepIterator<Iterator, STEP>::operator[](difference_type index) const
+    {
+        return this->base_[(this->index_ + index) * STEP];
+    }
+
+    template <class Iterator, typename std::iterator_traits<Iterator>::difference_type STEP>
+    inline UncheckedStepIterator<Iterator, STEP>& UncheckedStepIterator<Iterator, STEP>::operator++()
+    {
+        ++this->index_;
+        return *this;
+    }
+
+    template <class Iterator, typename std::iterator_traits<Iterator>::difference_type STEP>
+    inline UncheckedStepIterator<Iterator, STEP> UncheckedStepIterator<Iterator, STEP>::operator++(int)
+    {
+        UncheckedStepIterator<Iterator, STEP> copy = *this;
+        ++this->index_;
+        return copy;
+    }
+
+    template <class Iterator, typename std::iterator_traits<Iterator>::difference_type STEP>
+    inline UncheckedStepIterator<Iterator, STEP>& UncheckedStepIterator<Iterator, STEP>::operator--()
+    {
+        --this->index_;
+        return *this;
+    }
+
+    template <class Iterator, typename std::iterator_traits<Iterator>::difference_type STEP>
+    inline UncheckedStepIterator<Iterator, STEP> UncheckedStepIterator<Iterator, STEP>::operator--(int)
+    {
+        UncheckedStepIterator<Iterator, STEP> copy = *this;
+        --this->index_;
+        return copy;
+    }
+
+    template <class Iterator, typename std::iterator_traits<Iterator>::difference_type STEP>
+    inline UncheckedStepIterator<Iterator, STEP>&
+    UncheckedStepIterator<Iterator, STEP>::operator+=(difference_type increment)
+    {
+        this->index_ += increment;
+        return *this;
+    }
+
+    template <class Iterator, typename std::iterator_traits<Iterator>::difference_type STEP>
+    inline UncheckedStepIterator<Iterator, STEP>&
+    UncheckedStepIterator<Iterator, STEP>::operator-=(difference_type increment)
+    {
+        this->index_ -= increment;
+        return *this;
+    }
+
+    template <class Iterator, typename std::iterator_traits<Iterator>::difference_type STEP>
+    inline UncheckedStepIterator<Iterator, STEP>
+    UncheckedStepIterator<Iterator, STEP>::operator+(difference_type increment) const
+    {
+        return UncheckedStepIterator<Iterator, STEP>(this->base_, this->index_ + increment);
+    }
+
+    template <class Iterator, typename std::iterator_traits<Iterator>::difference_type STEP>
+    inline UncheckedStepIterator<Iterator, STEP>
+    operator+(typename std::iterator_traits<Iterator>::difference_type increment,
+              const UncheckedStepIterator<Iterator, STEP>& iterator)
+    {
+        return iterator + increment;
+    }
+
+    template <class Iterator, typename std::iterator_traits<Iterator>::difference_type STEP>
+    inline UncheckedStepIterator<Iterator, STEP>
+    UncheckedStepIterator<Iterator, STEP>::operator-(difference_type increment) const
+    {
+        return UncheckedStepIterator<Iterator, STEP>(this->base_, this->index_ - increment);
+    }
+
+    template <class Iterator, typename std::iterator_traits<Iterator>::difference_type STEP>
+    inline typename UncheckedStepIterator<Iterator, STEP>::difference_type
+    UncheckedStepIterator<Iterator, STEP>::operator-(const UncheckedStepIterator<Iterator, STEP>& rhs) const
+    {
+        return this->index_ - rhs.index_;
+    }
+
+    template <class Iterator, typename std::iterator_traits<Iterator>::difference_type STEP>
+    inline bool
+    UncheckedStepIterator<Iterator, STEP>::operator==(const UncheckedStepIterator<Iterator, STEP>& rhs) const
+    {
+        return this->index_ == rhs.index_;
+    }
+
+    template <class Iterator, typename std::iterator_traits<Iterator>::difference_type STEP>
+    inline bool
+    UncheckedStepIterator<Iterator, STEP>::operator!=(const UncheckedStepIterator<Iterator, STEP>& rhs) const
+    {
+        return this->index_ != rhs.index_;
+    }
+
+    template <class Iterator, typename std::iterator_traits<Iterator>::difference_type STEP>
+    inline bool UncheckedStepIterator<Iterator, STEP>::operator<(const UncheckedStepIterator<Iterator, STEP>& rhs) const
+    {
+        return this->index_ < rhs.index_;
+    }
+
+    template <class Iterator, typename std::iterator_traits<Iterator>::difference_type STEP>
+    inline bool UncheckedStepIterator<Iterator, STEP>::operator>(const UncheckedStepIterator<Iterator, STEP>& rhs) const
+    {
+        return this->index_ > rhs.index_;
+    }
+
+    template <class Iterator, typename std::iterator_traits<Iterator>::difference_type STEP>
+    inline bool
+    UncheckedStepIterator<Iterator, STEP>::operator<=(const UncheckedStepIterator<Iterator, STEP>& rhs) const
+    {
+        return this->index_ <= rhs.index_;
+    }
+
+    template <class Iterator, typename std::iterator_traits<Iterator>::difference_type STEP>
+    inline bool
+    UncheckedStepIterator<Iterator, STEP>::operator>=(const UncheckedStepIterator<Iterator, STEP>& rhs) const
+    {
+        return this->index_ >= rhs.index_;
+    }
+
+    template <class Iterator, typename std::iterator_traits<Iterator>::difference_type STEP>
+    inline constexpr typename UncheckedStepIterator<Iterator, STEP>::difference_type
+    UncheckedStepIterator<Iterator, STEP>::get_step()
+    {
+        return STEP;
+    }
+} // namespace ml::data_structure::iterator
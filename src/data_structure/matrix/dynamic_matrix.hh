@@ -0,0 +1,1062 @@
+/**
+ ** @file src/data_structure/matrix/dynamic_matrix.hh
+ ** @brief Declaration of ml::data_structure::matrix::DynamicMatrix and related functions
+ */
+
+#pragma once
+
+#include <functional>
+#include <ostream>
+#include <vector>
+
+#include "data_structure/iterator/strided_iterator.hh"
+#include "data_structure/matrix/matrix.hh"
+#include "data_structure/memory/aligned_allocator.hh"
+
+namespace ml::data_structure::matrix
+{
+    /// The Matrix structure with a shape known at runtime, the data is stored in an aligned heap buffer
+    template <typename DATA_TYPE>
+    class DynamicMatrix
+    {
+    public:
+        /// The type of the data container
+        using data_array_t = std::vector<DATA_TYPE, ml::data_structure::memory::AlignedAllocator<DATA_TYPE>>;
+        /// Iterator for the columns of the matrix, the stride is the width known at runtime
+        using column_iterator_t = ml::data_structure::iterator::StridedIterator<typename data_array_t::iterator>;
+        /// Const iterator for the columns of the matrix, the stride is the width known at runtime
+        using column_const_iterator_t =
+            ml::data_structure::iterator::StridedIterator<typename data_array_t::const_iterator>;
+
+        /** @name Constructors
+         ** \{ */
+
+        /// @brief Instantiate a new empty matrix
+        DynamicMatrix();
+
+        /** @brief Instantiate a new matrix filled with zeros
+         ** @param height The height of the matrix
+         ** @param width The width of the matrix
+         */
+        DynamicMatrix(size_t height, size_t width);
+
+        /** @brief Instantiate a new matrix
+         ** @param height The height of the matrix
+         ** @param width The width of the matrix
+         ** @param value The default value to fill the matrix with
+         */
+        DynamicMatrix(size_t height, size_t width, const DATA_TYPE& value);
+
+        /** @brief Instantiate a new matrix
+         ** @param height The height of the matrix
+         ** @param width The width of the matrix
+         ** @param data The data to add in the matrix, must contain height * width elements
+         */
+        DynamicMatrix(size_t height, size_t width, const data_array_t& data);
+
+        /** @brief Instantiate a new matrix
+         ** @param height The height of the matrix
+         ** @param width The width of the matrix
+         ** @param data The data to move in the matrix, must contain height * width elements
+         */
+        DynamicMatrix(size_t height, size_t width, data_array_t&& data);
+
+        /** @brief Instantiate a new matrix from a matrix with a compile-time shape
+         ** @param matrix The matrix to copy
+         */
+        template <size_t HEIGHT, size_t WIDTH>
+        explicit DynamicMatrix(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix);
+
+        /** @brief Instantiate a new matrix from a lazy expression, computing every element in one pass
+         ** @param expression The expression, it must evaluate to this matrix type
+         */
+        template <class Expression, typename = std::enable_if_t<is_lazy_matrix_expression_v<Expression>>>
+        DynamicMatrix(const Expression& expression);
+
+        /** @brief Compute a lazy expression in one pass directly into the matrix, reshaping it if needed
+         ** @param expression The expression, it must evaluate to this matrix type
+         ** @return The reference to the current matrix
+         */
+        template <class Expression, typename = std::enable_if_t<is_lazy_matrix_expression_v<Expression>>>
+        DynamicMatrix<DATA_TYPE>& operator=(const Expression& expression);
+
+        /** \} */
+
+        /** @name Matrix Operations
+         ** \{ */
+
+        /** @brief Fill the matrix with one value
+         ** @param value The value to fill the matrix with
+         ** @return The reference to the current matrix
+         */
+        DynamicMatrix<DATA_TYPE>& fill(const DATA_TYPE& value);
+
+        /** @brief Fill a row with one value
+         ** @param row_index The index of the row
+         ** @param value The value to fill the row with
+         ** @return The reference to the current matrix
+         */
+        DynamicMatrix<DATA_TYPE>& fill_row(size_t row_index, const DATA_TYPE& value);
+
+        /** @brief Fill a column with one value
+         ** @param column_index The index of the column
+         ** @param value The value to fill the column with
+         ** @return The reference to the current matrix
+         */
+        DynamicMatrix<DATA_TYPE>& fill_column(size_t column_index, const DATA_TYPE& value);
+
+        /** @brief Fill the matrix using a generator
+         ** @param generator The function which will be called for each value
+         ** @return The reference to the current matrix
+         */
+        template <class Generator>
+        DynamicMatrix<DATA_TYPE>& fill_generator(const Generator& generator);
+
+        /** @brief Fill a row with using a generator
+         ** @param row_index The index of the row
+         ** @param generator The function which will be called for each value
+         ** @return The reference to the current matrix
+         */
+        template <class Generator>
+        DynamicMatrix<DATA_TYPE>& fill_row_generator(size_t row_index, const Generator& generator);
+
+        /** @brief Fill a column using a generator
+         ** @param column_index The index of the column
+         ** @param generator The function which will be called for each value
+         ** @return The reference to the current matrix
+         */
+        template <class Generator>
+        DynamicMatrix<DATA_TYPE>& fill_column_generator(size_t column_index, const Generator& generator);
+
+        /** @brief Sort the matrix as it was a flat array in place
+         ** @param compare The compare function, std::less by default
+         ** @return The reference to the current matrix
+         */
+        template <class Compare = std::less<DATA_TYPE>>
+        DynamicMatrix<DATA_TYPE>& sort(const Compare& compare = Compare());
+
+        /** @brief Sort the rows of the matrix in place
+         ** @param compare The compare function, std::less by default
+         ** @return The reference to the current matrix
+         */
+        template <class Compare = std::less<DATA_TYPE>>
+        DynamicMatrix<DATA_TYPE>& sort_rows(const Compare& compare = Compare());
+
+        /** @brief Sort the columns of the matrix in place
+         ** @param compare The compare function, std::less by default
+         ** @return The reference to the current matrix
+         */
+        template <class Compare = std::less<DATA_TYPE>>
+        DynamicMatrix<DATA_TYPE>& sort_columns(const Compare& compare = Compare());
+
+        /** @brief Sort the rows of the matrix in place by the values of one of its columns
+         ** @details The rows are stably ordered by the column, then moved in a single gather pass
+         ** @param column_index The index of the column to sort by
+         ** @param compare The compare function, std::less by default
+         ** @return The reference to the current matrix
+         */
+        template <class Compare = std::less<DATA_TYPE>>
+        DynamicMatrix<DATA_TYPE>& sort_rows_by_column(size_t column_index, const Compare& compare = Compare());
+
+        /** @brief Compute the indexes that sort the matrix as it was a flat array
+         ** @param compare The compare function, std::less by default
+         ** @return The flat indexes of the elements in their sorted order, equivalent elements keep their order
+         */
+        template <class Compare = std::less<DATA_TYPE>>
+        DynamicMatrix<size_t> argsort(const Compare& compare = Compare()) const;
+
+        /** @brief Compute the indexes that sort each row of the matrix
+         ** @param compare The compare function, std::less by default
+         ** @return The column indexes of the elements of each row in their sorted order
+         */
+        template <class Compare = std::less<DATA_TYPE>>
+        DynamicMatrix<size_t> argsort_rows(const Compare& compare = Compare()) const;
+
+        /** @brief Compute the indexes that sort each column of the matrix
+         ** @param compare The compare function, std::less by default
+         ** @return The row indexes of the elements of each column in their sorted order
+         */
+        template <class Compare = std::less<DATA_TYPE>>
+        DynamicMatrix<size_t> argsort_columns(const Compare& compare = Compare()) const;
+
+        /** @brief Transpose the matrix
+         ** @return The new transposed matrix
+         */
+        DynamicMatrix<DATA_TYPE> transpose() const;
+
+        /** @brief Transpose the matrix in place, swapping its height and width
+         ** @details A square matrix is transposed without any allocation
+         ** @return The reference to the current matrix
+         */
+        DynamicMatrix<DATA_TYPE>& transpose_in_place();
+
+        /** @brief Apply a function to every element in the matrix in place
+         ** @param function The function to apply
+         ** @return The reference to the current matrix
+         */
+        template <class Function>
+        DynamicMatrix<DATA_TYPE>& apply(const Function& function);
+
+        /** \} */
+
+        /** @name Statistic Operations
+         ** \{ */
+
+        /** @brief Sum of all the element in the matrix
+         ** @return The sum
+         */
+        DATA_TYPE sum() const;
+
+        /** @brief Sum of all the columns
+         ** @return The row matrix containing the sums
+         */
+        DynamicMatrix<DATA_TYPE> sum_columns() const;
+
+        /** @brief Sum of all the rows
+         ** @return The column matrix containing the sums
+         */
+        DynamicMatrix<DATA_TYPE> sum_rows() const;
+
+        /** @brief Min of all the element in the matrix
+         ** @return The min
+         */
+        DATA_TYPE min() const;
+
+        /** @brief Min of all the columns
+         ** @return The row matrix containing the minimums
+         */
+        DynamicMatrix<DATA_TYPE> min_columns() const;
+
+        /** @brief Min of all the rows
+         ** @return The column matrix containing the minimums
+         */
+        DynamicMatrix<DATA_TYPE> min_rows() const;
+
+        /** @brief Max of all the element of the matrix
+         ** @return The max
+         */
+        DATA_TYPE max() const;
+
+        /** @brief Max of all the columns
+         ** @return The row matrix containing the maximums
+         */
+        DynamicMatrix<DATA_TYPE> max_columns() const;
+
+        /** @brief Max of all the rows
+         ** @return The column matrix containing the maximums
+         */
+        DynamicMatrix<DATA_TYPE> max_rows() const;
+
+        /** @brief Mean of all the element of the matrix
+         ** @return The mean
+         */
+        DATA_TYPE mean() const;
+
+        /** @brief Mean of all the columns
+         ** @return The row matrix containing the means
+         */
+        DynamicMatrix<DATA_TYPE> mean_columns() const;
+
+        /** @brief Mean of all the rows
+         ** @return The column matrix containing the means
+         */
+        DynamicMatrix<DATA_TYPE> mean_rows() const;
+
+        /** @brief Median of all the element of the matrix
+         ** @return The median
+         */
+        DATA_TYPE median() const;
+
+        /** @brief Median of all the columns
+         ** @return The row matrix containing the medians
+         */
+        DynamicMatrix<DATA_TYPE> median_columns() const;
+
+        /** @brief Median of all the rows
+         ** @return The column matrix containing the medians
+         */
+        DynamicMatrix<DATA_TYPE> median_rows() const;
+
+        /** @brief Variance of all the element of the matrix
+         ** @param ddof The divisor used in the calculation is N - ddof, 0 by default
+         ** @return The variance
+         */
+        DATA_TYPE variance(size_t ddof = 0) const;
+
+        /** @brief Variance of all the columns
+         ** @param ddof The divisor used in the calculation is N - ddof, 0 by default
+         ** @return The row matrix containing the variances
+         */
+        DynamicMatrix<DATA_TYPE> variance_columns(size_t ddof = 0) const;
+
+        /** @brief Variance of all the rows
+         ** @param ddof The divisor used in the calculation is N - ddof, 0 by default
+         ** @return The column matrix containing the variances
+         */
+        DynamicMatrix<DATA_TYPE> variance_rows(size_t ddof = 0) const;
+
+        /** @brief Standard deviation of all the element of the matrix
+         ** @param ddof The divisor used in the calculation is N - ddof, 0 by default
+         ** @return The standard deviation
+         */
+        DATA_TYPE standard_deviation(size_t ddof = 0) const;
+
+        /** @brief Standard deviation of all the columns
+         ** @param ddof The divisor used in the calculation is N - ddof, 0 by default
+         ** @return The row matrix containing the standard deviations
+         */
+        DynamicMatrix<DATA_TYPE> standard_deviation_columns(size_t ddof = 0) const;
+
+        /** @brief Standard deviation of all the rows
+         ** @param ddof The divisor used in the calculation is N - ddof, 0 by default
+         ** @return The column matrix containing the standard deviations
+         */
+        DynamicMatrix<DATA_TYPE> standard_deviation_rows(size_t ddof = 0) const;
+
+        /** @brief Sum-product of all the element of the matrix
+         ** @return The sum-product
+         */
+        DATA_TYPE sum_product() const;
+
+        /** @brief Sum-product of all the columns
+         ** @return The row matrix containing the sum-products
+         */
+        DynamicMatrix<DATA_TYPE> sum_product_columns() const;
+
+        /** @brief Sum-product of all the rows
+         ** @return The column matrix containing the sum-products
+         */
+        DynamicMatrix<DATA_TYPE> sum_product_rows() const;
+
+        /** @brief Peak to peak of all the element of the matrix
+         ** @return The peak to peak
+         */
+        DATA_TYPE peak_to_peak() const;
+
+        /** @brief Peak to peak of all the columns
+         ** @return The row matrix containing the peak to peaks
+         */
+        DynamicMatrix<DATA_TYPE> peak_to_peak_columns() const;
+
+        /** @brief Peak to peak of all the rows
+         ** @return The column matrix containing the peak to peaks
+         */
+        DynamicMatrix<DATA_TYPE> peak_to_peak_rows() const;
+
+        /** @brief Sum, min, max, mean, variance, standard deviation and peak to peak of all the element of the matrix,
+         ** computed in one pass
+         ** @param ddof The divisor used in the calculation of the variance is N - ddof, 0 by default
+         ** @return The statistics
+         */
+        ml::computation::statistic::Description<DATA_TYPE> describe(size_t ddof = 0) const;
+
+        /** @brief Statistics of describe of all the columns, computed in one sweep over the rows
+         ** @param ddof The divisor used in the calculation of the variance is N - ddof, 0 by default
+         ** @return The row matrices containing the statistics
+         */
+        ml::computation::statistic::Description<DynamicMatrix<DATA_TYPE>> describe_columns(size_t ddof = 0) const;
+
+        /** @brief Statistics of describe of all the rows
+         ** @param ddof The divisor used in the calculation of the variance is N - ddof, 0 by default
+         ** @return The column matrices containing the statistics
+         */
+        ml::computation::statistic::Description<DynamicMatrix<DATA_TYPE>> describe_rows(size_t ddof = 0) const;
+
+        /** \} */
+
+        /** @name Arithmetic Operations
+         ** \{ */
+
+        /** @brief Negate element-wise in place
+         ** @return The reference to the current matrix
+         */
+        DynamicMatrix<DATA_TYPE>& negate();
+
+        /** @brief Compute a classic addition in place
+         ** @param rhs The other matrix to compute the operation with, must have the same shape
+         ** @return The reference to the current matrix
+         */
+        DynamicMatrix<DATA_TYPE>& plus(const DynamicMatrix<DATA_TYPE>& rhs);
+
+        /** @brief Compute a classic subtraction in place
+         ** @param rhs The other matrix to compute the operation with, must have the same shape
+         ** @return The reference to the current matrix
+         */
+        DynamicMatrix<DATA_TYPE>& minus(const DynamicMatrix<DATA_TYPE>& rhs);
+
+        /** @brief Compute an element-wise multiplication in place
+         ** @param rhs The other matrix to compute the operation with, must have the same shape
+         ** @return The reference to the current matrix
+         */
+        DynamicMatrix<DATA_TYPE>& multiplies(const DynamicMatrix<DATA_TYPE>& rhs);
+
+        /** @brief Compute an element-wise division in place
+         ** @param rhs The other matrix to compute the operation with, must have the same shape
+         ** @return The reference to the current matrix
+         */
+        DynamicMatrix<DATA_TYPE>& divides(const DynamicMatrix<DATA_TYPE>& rhs);
+
+        /** @brief Compute an element-wise modulo in place
+         ** @param rhs The other matrix to compute the operation with, must have the same shape
+         ** @return The reference to the current matrix
+         */
+        DynamicMatrix<DATA_TYPE>& modulus(const DynamicMatrix<DATA_TYPE>& rhs);
+
+        /** @brief Addition of each element of the matrix with a scalar in place
+         ** @param scalar The scalar
+         ** @return The reference to the current matrix
+         */
+        DynamicMatrix<DATA_TYPE>& plus_scalar(const DATA_TYPE& scalar);
+
+        /** @brief Subtraction of each element of the matrix with a scalar in place
+         ** @param scalar The scalar
+         ** @return The reference to the current matrix
+         */
+        DynamicMatrix<DATA_TYPE>& minus_scalar(const DATA_TYPE& scalar);
+
+        /** @brief Multiplication of each element of the matrix with a scalar in place
+         ** @param scalar The scalar
+         ** @return The reference to the current matrix
+         */
+        DynamicMatrix<DATA_TYPE>& multiplies_scalar(const DATA_TYPE& scalar);
+
+        /** @brief Division of each element of the matrix with a scalar in place
+         ** @param scalar The scalar
+         ** @return The reference to the current matrix
+         */
+        DynamicMatrix<DATA_TYPE>& divides_scalar(const DATA_TYPE& scalar);
+
+        /** @brief Modulus of each element of the matrix with a scalar in place
+         ** @param scalar The scalar
+         ** @return The reference to the current matrix
+         */
+        DynamicMatrix<DATA_TYPE>& modulus_scalar(const DATA_TYPE& scalar);
+
+        /** \} */
+
+        /** @name Arithmetic Operators
+         ** \{ */
+
+        /** @brief Compute a classic addition in place
+         ** @param rhs The other matrix to compute the operation with, must have the same shape
+         ** @return The reference to the current matrix
+         */
+        DynamicMatrix<DATA_TYPE>& operator+=(const DynamicMatrix<DATA_TYPE>& rhs);
+
+        /** @brief Compute a classic subtraction in place
+         ** @param rhs The other matrix to compute the operation with, must have the same shape
+         ** @return The reference to the current matrix
+         */
+        DynamicMatrix<DATA_TYPE>& operator-=(const DynamicMatrix<DATA_TYPE>& rhs);
+
+        /** @brief Compute an element-wise multiplication in place
+         ** @param rhs The other matrix to compute the operation with, must have the same shape
+         ** @return The reference to the current matrix
+         */
+        DynamicMatrix<DATA_TYPE>& operator*=(const DynamicMatrix<DATA_TYPE>& rhs);
+
+        /** @brief Compute an element-wise division in place
+         ** @param rhs The other matrix to compute the operation with, must have the same shape
+         ** @return The reference to the current matrix
+         */
+        DynamicMatrix<DATA_TYPE>& operator/=(const DynamicMatrix<DATA_TYPE>& rhs);
+
+        /** @brief Compute an element-wise modulo in place
+         ** @param rhs The other matrix to compute the operation with, must have the same shape
+         ** @return The reference to the current matrix
+         */
+        DynamicMatrix<DATA_TYPE>& operator%=(const DynamicMatrix<DATA_TYPE>& rhs);
+
+        /** @brief Addition of each element of the matrix with a scalar in place
+         ** @param scalar The scalar
+         ** @return The reference to the current matrix
+         */
+        DynamicMatrix<DATA_TYPE>& operator+=(const DATA_TYPE& scalar);
+
+        /** @brief Subtraction of each element of the matrix with a scalar in place
+         ** @param scalar The scalar
+         ** @return The reference to the current matrix
+         */
+        DynamicMatrix<DATA_TYPE>& operator-=(const DATA_TYPE& scalar);
+
+        /** @brief Multiplication of each element of the matrix with a scalar in place
+         ** @param scalar The scalar
+         ** @return The reference to the current matrix
+         */
+        DynamicMatrix<DATA_TYPE>& operator*=(const DATA_TYPE& scalar);
+
+        /** @brief Division of each element of the matrix with a scalar in place
+         ** @param scalar The scalar
+         ** @return The reference to the current matrix
+         */
+        DynamicMatrix<DATA_TYPE>& operator/=(const DATA_TYPE& scalar);
+
+        /** @brief Modulus of each element of the matrix with a scalar in place
+         ** @param scalar The scalar
+         ** @return The reference to the current matrix
+         */
+        DynamicMatrix<DATA_TYPE>& operator%=(const DATA_TYPE& scalar);
+
+        /** \} */
+
+        /** @name Accessors
+         ** \{ */
+
+        /** @brief Access an element of the matrix without bound checking
+         ** @param height_index The height index of the element
+         ** @param width_index The width index of the element
+         ** @return The reference to the element
+         */
+        DATA_TYPE& operator()(size_t height_index, size_t width_index);
+
+        /** @brief Return an element of the matrix without bound checking
+         ** @param height_index The height index of the element
+         ** @param width_index The width index of the element
+         ** @return The element
+         */
+        const DATA_TYPE& operator()(size_t height_index, size_t width_index) const;
+
+        /** @brief Access an element of the matrix with bound checking
+         ** @param height_index The height index of the element
+         ** @param width_index The width index of the element
+         ** @return The reference to the element
+         */
+        DATA_TYPE& at(size_t height_index, size_t width_index);
+
+        /** @brief Return an element of the matrix with bound checking
+         ** @param height_index The height index of the element
+         ** @param width_index The width index of the element
+         ** @return The element
+         */
+        const DATA_TYPE& at(size_t height_index, size_t width_index) const;
+
+        /** @brief Access the raw data of the matrix
+         ** @return The reference to the raw data
+         */
+        data_array_t& data();
+
+        /** @brief Return the raw data of the matrix
+         ** @return The raw data
+         */
+        const data_array_t& data() const;
+
+        /** @brief Get a view of the matrix allowing modifications, without copy
+         ** @return The view, valid until the matrix is destroyed or reshaped
+         */
+        MatrixView<DATA_TYPE> view();
+
+        /** @brief Get a read-only view of the matrix, without copy
+         ** @return The view, valid until the matrix is destroyed or reshaped
+         */
+        MatrixView<const DATA_TYPE> view() const;
+
+        /** @brief Access an element in the matrix in the frame of broadcasting
+         ** @param height_index The height index of the element
+         ** @param width_index The width index of the element
+         ** @return The element
+         */
+        const DATA_TYPE& get_broadcast_value(size_t height_index, size_t width_index) const;
+
+        /** @brief Get the height of the matrix
+         ** @return The height of the matrix
+         */
+        size_t get_height() const;
+
+        /** @brief Get the width of the matrix
+         ** @return The width of the matrix
+         */
+        size_t get_width() const;
+
+        /** \} */
+
+    private:
+        /// The height of the matrix
+        size_t height_;
+        /// The width of the matrix
+        size_t width_;
+        /// The matrix data
+        data_array_t data_;
+    };
+
+    /** @brief Sort a matrix
+     ** @param matrix The matrix to sort
+     ** @param compare The compare function, std::less by default
+     ** @return The new sorted matrix
+     */
+    template <typename DATA_TYPE, class Compare = std::less<DATA_TYPE>>
+    DynamicMatrix<DATA_TYPE> sort(const DynamicMatrix<DATA_TYPE>& matrix, const Compare& compare = Compare());
+
+    /** @brief Sort the rows of a matrix
+     ** @param matrix The matrix to sort
+     ** @param compare The compare function, std::less by default
+     ** @return The new sorted matrix
+     */
+    template <typename DATA_TYPE, class Compare = std::less<DATA_TYPE>>
+    DynamicMatrix<DATA_TYPE> sort_rows(const DynamicMatrix<DATA_TYPE>& matrix, const Compare& compare = Compare());
+
+    /** @brief Sort the columns of a matrix
+     ** @param matrix The matrix to sort
+     ** @param compare The compare function, std::less by default
+     ** @return The new sorted matrix
+     */
+    template <typename DATA_TYPE, class Compare = std::less<DATA_TYPE>>
+    DynamicMatrix<DATA_TYPE> sort_columns(const DynamicMatrix<DATA_TYPE>& matrix, const Compare& compare = Compare());
+
+    /** @brief Sort the rows of a matrix by the values of one of its columns
+     ** @param matrix The matrix to sort
+     ** @param column_index The index of the column to sort by
+     ** @param compare The compare function, std::less by default
+     ** @return The new sorted matrix
+     */
+    template <typename DATA_TYPE, class Compare = std::less<DATA_TYPE>>
+    DynamicMatrix<DATA_TYPE> sort_rows_by_column(const DynamicMatrix<DATA_TYPE>& matrix,
+                                                 size_t column_index,
+                                                 const Compare& compare = Compare());
+
+    /** @brief Compute the indexes that sort a matrix as it was a flat array
+     ** @param matrix The matrix
+     ** @param compare The compare function, std::less by default
+     ** @return The flat indexes of the elements in their sorted order
+     */
+    template <typename DATA_TYPE, class Compare = std::less<DATA_TYPE>>
+    DynamicMatrix<size_t> argsort(const DynamicMatrix<DATA_TYPE>& matrix, const Compare& compare = Compare());
+
+    /** @brief Compute the indexes that sort each row of a matrix
+     ** @param matrix The matrix
+     ** @param compare The compare function, std::less by default
+     ** @return The column indexes of the elements of each row in their sorted order
+     */
+    template <typename DATA_TYPE, class Compare = std::less<DATA_TYPE>>
+    DynamicMatrix<size_t> argsort_rows(const DynamicMatrix<DATA_TYPE>& matrix, const Compare& compare = Compare());
+
+    /** @brief Compute the indexes that sort each column of a matrix
+     ** @param matrix The matrix
+     ** @param compare The compare function, std::less by default
+     ** @return The row indexes of the elements of each column in their sorted order
+     */
+    template <typename DATA_TYPE, class Compare = std::less<DATA_TYPE>>
+    DynamicMatrix<size_t> argsort_columns(const DynamicMatrix<DATA_TYPE>& matrix, const Compare& compare = Compare());
+
+    /** @brief Transpose a matrix
+     ** @param matrix The matrix
+     ** @return The new transposed matrix
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> transpose(const DynamicMatrix<DATA_TYPE>& matrix);
+
+    /** @brief Apply a function to every element in a matrix
+     ** @param matrix The matrix
+     ** @param function The function to apply
+     ** @return The matrix with the new elements
+     */
+    template <typename DATA_TYPE, class Function>
+    DynamicMatrix<DATA_TYPE> apply(const DynamicMatrix<DATA_TYPE>& matrix, const Function& function);
+
+    /** @brief Sum of all the element in a matrix
+     ** @param matrix The matrix
+     ** @return The sum
+     */
+    template <typename DATA_TYPE>
+    DATA_TYPE sum(const DynamicMatrix<DATA_TYPE>& matrix);
+
+    /** @brief Sum of all the element in a matrix, the chunks being reduced in parallel
+     ** @param matrix The matrix
+     ** @param execution How the work is split
+     ** @return The sum
+     */
+    template <typename DATA_TYPE>
+    DATA_TYPE sum(const DynamicMatrix<DATA_TYPE>& matrix, ml::computation::statistic::Execution execution);
+
+    /** @brief Sum of all the columns of a matrix
+     ** @param matrix The matrix
+     ** @return The row matrix containing the sums
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> sum_columns(const DynamicMatrix<DATA_TYPE>& matrix);
+
+    /** @brief Sum of all the rows of a matrix
+     ** @param matrix The matrix
+     ** @return The column matrix containing the sums
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> sum_rows(const DynamicMatrix<DATA_TYPE>& matrix);
+
+    /** @brief Min of all the element in a matrix
+     ** @param matrix The matrix
+     ** @return The min
+     */
+    template <typename DATA_TYPE>
+    DATA_TYPE min(const DynamicMatrix<DATA_TYPE>& matrix);
+
+    /** @brief Min of all the columns of a matrix
+     ** @param matrix The matrix
+     ** @return The row matrix containing the minimums
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> min_columns(const DynamicMatrix<DATA_TYPE>& matrix);
+
+    /** @brief Min of all the rows of a matrix
+     ** @param matrix The matrix
+     ** @return The column matrix containing the minimums
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> min_rows(const DynamicMatrix<DATA_TYPE>& matrix);
+
+    /** @brief Max of all the element in a matrix
+     ** @param matrix The matrix
+     ** @return The max
+     */
+    template <typename DATA_TYPE>
+    DATA_TYPE max(const DynamicMatrix<DATA_TYPE>& matrix);
+
+    /** @brief Max of all the columns of a matrix
+     ** @param matrix The matrix
+     ** @return The row matrix containing the maximums
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> max_columns(const DynamicMatrix<DATA_TYPE>& matrix);
+
+    /** @brief Max of all the rows of a matrix
+     ** @param matrix The matrix
+     ** @return The column matrix containing the maximums
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> max_rows(const DynamicMatrix<DATA_TYPE>& matrix);
+
+    /** @brief Mean of all the element in a matrix
+     ** @param matrix The matrix
+     ** @return The mean
+     */
+    template <typename DATA_TYPE>
+    DATA_TYPE mean(const DynamicMatrix<DATA_TYPE>& matrix);
+
+    /** @brief Mean of all the element in a matrix, the chunks being reduced in parallel
+     ** @param matrix The matrix
+     ** @param execution How the work is split
+     ** @return The mean
+     */
+    template <typename DATA_TYPE>
+    DATA_TYPE mean(const DynamicMatrix<DATA_TYPE>& matrix, ml::computation::statistic::Execution execution);
+
+    /** @brief Mean of all the columns of a matrix
+     ** @param matrix The matrix
+     ** @return The row matrix containing the means
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> mean_columns(const DynamicMatrix<DATA_TYPE>& matrix);
+
+    /** @brief Mean of all the rows of a matrix
+     ** @param matrix The matrix
+     ** @return The column matrix containing the means
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> mean_rows(const DynamicMatrix<DATA_TYPE>& matrix);
+
+    /** @brief Median of all the element in a matrix
+     ** @param matrix The matrix
+     ** @return The median
+     */
+    template <typename DATA_TYPE>
+    DATA_TYPE median(const DynamicMatrix<DATA_TYPE>& matrix);
+
+    /** @brief Median of all the columns of a matrix
+     ** @param matrix The matrix
+     ** @return The row matrix containing the medians
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> median_columns(const DynamicMatrix<DATA_TYPE>& matrix);
+
+    /** @brief Median of all the rows of a matrix
+     ** @param matrix The matrix
+     ** @return The column matrix containing the medians
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> median_rows(const DynamicMatrix<DATA_TYPE>& matrix);
+
+    /** @brief Variance of all the element in a matrix
+     ** @param matrix The matrix
+     ** @param ddof The divisor used in the calculation is N - ddof, 0 by default
+     ** @return The variance
+     */
+    template <typename DATA_TYPE>
+    DATA_TYPE variance(const DynamicMatrix<DATA_TYPE>& matrix, size_t ddof = 0);
+
+    /** @brief Variance of all the element in a matrix, the chunks being reduced in parallel
+     ** @param matrix The matrix
+     ** @param ddof The divisor used in the calculation is N - ddof
+     ** @param execution How the work is split
+     ** @return The variance
+     */
+    template <typename DATA_TYPE>
+    DATA_TYPE variance(const DynamicMatrix<DATA_TYPE>& matrix,
+                       size_t ddof,
+                       ml::computation::statistic::Execution execution);
+
+    /** @brief Variance of all the columns of a matrix
+     ** @param matrix The matrix
+     ** @param ddof The divisor used in the calculation is N - ddof, 0 by default
+     ** @return The row matrix containing the variances
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> variance_columns(const DynamicMatrix<DATA_TYPE>& matrix, size_t ddof = 0);
+
+    /** @brief Variance of all the rows of a matrix
+     ** @param matrix The matrix
+     ** @param ddof The divisor used in the calculation is N - ddof, 0 by default
+     ** @return The column matrix containing the variances
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> variance_rows(const DynamicMatrix<DATA_TYPE>& matrix, size_t ddof = 0);
+
+    /** @brief Standard deviation of all the element in a matrix
+     ** @param matrix The matrix
+     ** @param ddof The divisor used in the calculation is N - ddof, 0 by default
+     ** @return The standard deviation
+     */
+    template <typename DATA_TYPE>
+    DATA_TYPE standard_deviation(const DynamicMatrix<DATA_TYPE>& matrix, size_t ddof = 0);
+
+    /** @brief Standard deviation of all the element in a matrix, the chunks being reduced in parallel
+     ** @param matrix The matrix
+     ** @param ddof The divisor used in the calculation is N - ddof
+     ** @param execution How the work is split
+     ** @return The standard deviation
+     */
+    template <typename DATA_TYPE>
+    DATA_TYPE standard_deviation(const DynamicMatrix<DATA_TYPE>& matrix,
+                                 size_t ddof,
+                                 ml::computation::statistic::Execution execution);
+
+    /** @brief Standard deviation of all the columns of a matrix
+     ** @param matrix The matrix
+     ** @param ddof The divisor used in the calculation is N - ddof, 0 by default
+     ** @return The row matrix containing the standard deviations
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> standard_deviation_columns(const DynamicMatrix<DATA_TYPE>& matrix, size_t ddof = 0);
+
+    /** @brief Standard deviation of all the rows of a matrix
+     ** @param matrix The matrix
+     ** @param ddof The divisor used in the calculation is N - ddof, 0 by default
+     ** @return The column matrix containing the standard deviations
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> standard_deviation_rows(const DynamicMatrix<DATA_TYPE>& matrix, size_t ddof = 0);
+
+    /** @brief Sum-product of all the element in a matrix
+     ** @param matrix The matrix
+     ** @return The sum-product
+     */
+    template <typename DATA_TYPE>
+    DATA_TYPE sum_product(const DynamicMatrix<DATA_TYPE>& matrix);
+
+    /** @brief Sum-product of all the columns of a matrix
+     ** @param matrix The matrix
+     ** @return The row matrix containing the sum-products
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> sum_product_columns(const DynamicMatrix<DATA_TYPE>& matrix);
+
+    /** @brief Sum-product of all the rows of a matrix
+     ** @param matrix The matrix
+     ** @return The column matrix containing the sum-products
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> sum_product_rows(const DynamicMatrix<DATA_TYPE>& matrix);
+
+    /** @brief Peak to peak of all the element in a matrix
+     ** @param matrix The matrix
+     ** @return The peak to peak
+     */
+    template <typename DATA_TYPE>
+    DATA_TYPE peak_to_peak(const DynamicMatrix<DATA_TYPE>& matrix);
+
+    /** @brief Peak to peak of all the columns of a matrix
+     ** @param matrix The matrix
+     ** @return The row matrix containing the peak to peaks
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> peak_to_peak_columns(const DynamicMatrix<DATA_TYPE>& matrix);
+
+    /** @brief Peak to peak of all the rows of a matrix
+     ** @param matrix The matrix
+     ** @return The column matrix containing the peak to peaks
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> peak_to_peak_rows(const DynamicMatrix<DATA_TYPE>& matrix);
+
+    /** @brief Sum, min, max, mean, variance, standard deviation and peak to peak of all the element in a matrix,
+     ** computed in one pass
+     ** @param matrix The matrix
+     ** @param ddof The divisor used in the calculation of the variance is N - ddof, 0 by default
+     ** @return The statistics
+     */
+    template <typename DATA_TYPE>
+    ml::computation::statistic::Description<DATA_TYPE> describe(const DynamicMatrix<DATA_TYPE>& matrix,
+                                                                size_t ddof = 0);
+
+    /** @brief Statistics of describe of all the columns of a matrix, computed in one sweep over the rows
+     ** @param matrix The matrix
+     ** @param ddof The divisor used in the calculation of the variance is N - ddof, 0 by default
+     ** @return The row matrices containing the statistics
+     */
+    template <typename DATA_TYPE>
+    ml::computation::statistic::Description<DynamicMatrix<DATA_TYPE>>
+    describe_columns(const DynamicMatrix<DATA_TYPE>& matrix, size_t ddof = 0);
+
+    /** @brief Statistics of describe of all the rows of a matrix
+     ** @param matrix The matrix
+     ** @param ddof The divisor used in the calculation of the variance is N - ddof, 0 by default
+     ** @return The column matrices containing the statistics
+     */
+    template <typename DATA_TYPE>
+    ml::computation::statistic::Description<DynamicMatrix<DATA_TYPE>>
+    describe_rows(const DynamicMatrix<DATA_TYPE>& matrix, size_t ddof = 0);
+
+    /** @brief Negate a matrix
+     ** @param matrix The matrix
+     ** @return The new matrix containing the result of the operation
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> negate(const DynamicMatrix<DATA_TYPE>& matrix);
+
+    /** @brief Compute a classic matrix addition, broadcasting implemented
+     ** @param lhs The matrix at the left of the operator
+     ** @param rhs The matrix at the right of the operator
+     ** @return The new matrix containing the result of the operation
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> plus(const DynamicMatrix<DATA_TYPE>& lhs, const DynamicMatrix<DATA_TYPE>& rhs);
+
+    /** @brief Compute a classic matrix subtraction, broadcasting implemented
+     ** @param lhs The matrix at the left of the operator
+     ** @param rhs The matrix at the right of the operator
+     ** @return The new matrix containing the result of the operation
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> minus(const DynamicMatrix<DATA_TYPE>& lhs, const DynamicMatrix<DATA_TYPE>& rhs);
+
+    /** @brief Compute an element-wise multiplication, broadcasting implemented
+     ** @param lhs The matrix at the left of the operator
+     ** @param rhs The matrix at the right of the operator
+     ** @return The new matrix containing the result of the operation
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> multiplies(const DynamicMatrix<DATA_TYPE>& lhs, const DynamicMatrix<DATA_TYPE>& rhs);
+
+    /** @brief Compute an element-wise division, broadcasting implemented
+     ** @param lhs The matrix at the left of the operator
+     ** @param rhs The matrix at the right of the operator
+     ** @return The new matrix containing the result of the operation
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> divides(const DynamicMatrix<DATA_TYPE>& lhs, const DynamicMatrix<DATA_TYPE>& rhs);
+
+    /** @brief Compute an element-wise modulus, broadcasting implemented
+     ** @param lhs The matrix at the left of the operator
+     ** @param rhs The matrix at the right of the operator
+     ** @return The new matrix containing the result of the operation
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> modulus(const DynamicMatrix<DATA_TYPE>& lhs, const DynamicMatrix<DATA_TYPE>& rhs);
+
+    /** @brief Addition of each element of a matrix with a scalar
+     ** @param matrix The matrix
+     ** @param scalar The scalar
+     ** @return The new matrix containing the result of the operation
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> plus_scalar(const DynamicMatrix<DATA_TYPE>& matrix, const DATA_TYPE& scalar);
+
+    /** @brief Subtraction of each element of a matrix with a scalar
+     ** @param matrix The matrix
+     ** @param scalar The scalar
+     ** @return The new matrix containing the result of the operation
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> minus_scalar(const DynamicMatrix<DATA_TYPE>& matrix, const DATA_TYPE& scalar);
+
+    /** @brief Multiplication of each element of a matrix with a scalar
+     ** @param matrix The matrix
+     ** @param scalar The scalar
+     ** @return The new matrix containing the result of the operation
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> multiplies_scalar(const DynamicMatrix<DATA_TYPE>& matrix, const DATA_TYPE& scalar);
+
+    /** @brief Division of each element of a matrix with a scalar
+     ** @param matrix The matrix
+     ** @param scalar The scalar
+     ** @return The new matrix containing the result of the operation
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> divides_scalar(const DynamicMatrix<DATA_TYPE>& matrix, const DATA_TYPE& scalar);
+
+    /** @brief Modulus of each element of a matrix with a scalar
+     ** @param matrix The matrix
+     ** @param scalar The scalar
+     ** @return The new matrix containing the result of the operation
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> modulus_scalar(const DynamicMatrix<DATA_TYPE>& matrix, const DATA_TYPE& scalar);
+
+    /** @brief Compute a classic multiplication of two matrix
+     ** @param lhs The matrix at the left of the operator
+     ** @param rhs The matrix at the right of the operator
+     ** @return The new matrix containing the result of the operation
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> multiplies_matrix(const DynamicMatrix<DATA_TYPE>& lhs,
+                                               const DynamicMatrix<DATA_TYPE>& rhs);
+
+    /** @brief Compare matrix, check the shapes then element by element if the matrix are equals
+     ** @param lhs The first matrix
+     ** @param rhs The second matrix
+     ** @return True if the matrix have the same shape and contain the same elements, false otherwise
+     */
+    template <typename DATA_TYPE>
+    bool compare(const DynamicMatrix<DATA_TYPE>& lhs, const DynamicMatrix<DATA_TYPE>& rhs);
+
+    /** @brief Equal operator, check the shapes then element by element if the matrix are equals
+     ** @param lhs The matrix at the left of the operator
+     ** @param rhs The matrix at the right of the operator
+     ** @return True if the matrix have the same shape and contain the same elements, false otherwise
+     */
+    template <typename DATA_TYPE>
+    bool operator==(const DynamicMatrix<DATA_TYPE>& lhs, const DynamicMatrix<DATA_TYPE>& rhs);
+
+    /** @brief Not equal operator, check the shapes then element by element if the matrix are not equals
+     ** @param lhs The matrix at the left of the operator
+     ** @param rhs The matrix at the right of the operator
+     ** @return False if the matrix have the same shape and contain the same elements, true otherwise
+     */
+    template <typename DATA_TYPE>
+    bool operator!=(const DynamicMatrix<DATA_TYPE>& lhs, const DynamicMatrix<DATA_TYPE>& rhs);
+
+    /** @brief Print a matrix
+     ** @param matrix The matrix to print
+     ** @param os The stream to print on
+     ** @return The reference to the stream
+     */
+    template <typename DATA_TYPE>
+    std::ostream& print(const DynamicMatrix<DATA_TYPE>& matrix, std::ostream& os);
+
+    /** @brief Print a matrix
+     ** @param os The stream to print on
+     ** @param matrix The matrix to print
+     ** @return The reference to the stream
+     */
+    template <typename DATA_TYPE>
+    std::ostream& operator<<(std::ostream& os, const DynamicMatrix<DATA_TYPE>& matrix);
+} // namespace ml::data_structure::matrix
+
+#include "data_structure/matrix/dynamic_matrix.hxx"
+#include "data_structure/matrix/dynamic_matrix_apply.hxx"
+#include "data_structure/matrix/dynamic_matrix_arithmetic_operations.hxx"
+#include "data_structure/matrix/dynamic_matrix_comparison.hxx"
+#include "data_structure/matrix/dynamic_matrix_fill.hxx"
+#include "data_structure/matrix/dynamic_matrix_multiplies_matrix.hxx"
+#include "data_structure/matrix/dynamic_matrix_print.hxx"
+#include "data_structure/matrix/dynamic_matrix_sort.hxx"
+#include "data_structure/matrix/dynamic_matrix_statistics.hxx"
+#include "data_structure/matrix/dynamic_matrix_transpose.hxx"
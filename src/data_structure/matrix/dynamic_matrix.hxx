@@ -0,0 +1,170 @@
+/**
+ ** @file src/data_structure/matrix/dynamic_matrix.hxx
+ ** @brief Constructors and accessors of ml::data_structure::matrix::DynamicMatrix
+ */
+
+#include <stdexcept>
+
+namespace ml::data_structure::matrix
+{
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE>::DynamicMatrix()
+        : height_(0)
+        , width_(0)
+        , data_()
+    {}
+
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE>::DynamicMatrix(size_t height, size_t width)
+        : height_(height)
+        , width_(width)
+        , data_(height * width)
+    {}
+
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE>::DynamicMatrix(size_t height, size_t width, const DATA_TYPE& value)
+        : height_(height)
+        , width_(width)
+        , data_(height * width, value)
+    {}
+
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE>::DynamicMatrix(size_t height, size_t width, const DynamicMatrix::data_array_t& data)
+        : height_(height)
+        , width_(width)
+        , data_(data)
+    {
+        if (this->data_.size() != height * width)
+            throw std::invalid_argument("The data size does not match the shape of the matrix");
+    }
+
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE>::DynamicMatrix(size_t height, size_t width, DynamicMatrix::data_array_t&& data)
+        : height_(height)
+        , width_(width)
+        , data_(std::move(data))
+    {
+        if (this->data_.size() != height * width)
+            throw std::invalid_argument("The data size does not match the shape of the matrix");
+    }
+
+    template <typename DATA_TYPE>
+    template <size_t HEIGHT, size_t WIDTH>
+    DynamicMatrix<DATA_TYPE>::DynamicMatrix(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix)
+        : height_(HEIGHT)
+        , width_(WIDTH)
+        , data_(matrix.data().cbegin(), matrix.data().cend())
+    {}
+
+    template <typename DATA_TYPE>
+    template <class Expression, typename>
+    DynamicMatrix<DATA_TYPE>::DynamicMatrix(const Expression& expression)
+        : height_(expression.get_height())
+        , width_(expression.get_width())
+        , data_(height_ * width_)
+    {
+        static_assert(std::is_same_v<typename Expression::matrix_t, DynamicMatrix<DATA_TYPE>>,
+                      "The expression does not evaluate to this matrix type");
+
+        evaluate_expression(*this, expression);
+    }
+
+    template <typename DATA_TYPE>
+    template <class Expression, typename>
+    inline DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::operator=(const Expression& expression)
+    {
+        static_assert(std::is_same_v<typename Expression::matrix_t, DynamicMatrix<DATA_TYPE>>,
+                      "The expression does not evaluate to this matrix type");
+
+        // A reshaped matrix can only be a broadcast operand of the expression, so it is read until the end, and a view
+        // over the matrix may read an element already overwritten, both are computed into a new buffer
+        if (height_ != expression.get_height() || width_ != expression.get_width()
+            || is_aliasing(expression, data_.data(), data_.data() + data_.size()))
+            return *this = DynamicMatrix<DATA_TYPE>(expression);
+
+        evaluate_expression(*this, expression);
+        return *this;
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE& DynamicMatrix<DATA_TYPE>::operator()(size_t height_index, size_t width_index)
+    {
+        return data_[height_index * width_ + width_index];
+    }
+
+    template <typename DATA_TYPE>
+    inline const DATA_TYPE& DynamicMatrix<DATA_TYPE>::operator()(size_t height_index, size_t width_index) const
+    {
+        return data_[height_index * width_ + width_index];
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE& DynamicMatrix<DATA_TYPE>::at(size_t height_index, size_t width_index)
+    {
+        if (height_index >= height_)
+            throw std::out_of_range("height_index out of range");
+        if (width_index >= width_)
+            throw std::out_of_range("width_index out of range");
+
+        return (*this)(height_index, width_index);
+    }
+
+    template <typename DATA_TYPE>
+    inline const DATA_TYPE& DynamicMatrix<DATA_TYPE>::at(size_t height_index, size_t width_index) const
+    {
+        if (height_index >= height_)
+            throw std::out_of_range("height_index out of range");
+        if (width_index >= width_)
+            throw std::out_of_range("width_index out of range");
+
+        return (*this)(height_index, width_index);
+    }
+
+    template <typename DATA_TYPE>
+    inline typename DynamicMatrix<DATA_TYPE>::data_array_t& DynamicMatrix<DATA_TYPE>::data()
+    {
+        return this->data_;
+    }
+
+    template <typename DATA_TYPE>
+    inline const typename DynamicMatrix<DATA_TYPE>::data_array_t& DynamicMatrix<DATA_TYPE>::data() const
+    {
+        return this->data_;
+    }
+
+    template <typename DATA_TYPE>
+    inline MatrixView<DATA_TYPE> DynamicMatrix<DATA_TYPE>::view()
+    {
+        return MatrixView<DATA_TYPE>(data_.data(), height_, width_, width_, 1);
+    }
+
+    template <typename DATA_TYPE>
+    inline MatrixView<const DATA_TYPE> DynamicMatrix<DATA_TYPE>::view() const
+    {
+        return MatrixView<const DATA_TYPE>(data_.data(), height_, width_, width_, 1);
+    }
+
+    template <typename DATA_TYPE>
+    inline const DATA_TYPE& DynamicMatrix<DATA_TYPE>::get_broadcast_value(size_t height_index,
+                                                                          size_t width_index) const
+    {
+        if (height_ == 1)
+            height_index = 0;
+        if (width_ == 1)
+            width_index = 0;
+
+        return (*this)(height_index, width_index);
+    }
+
+    template <typename DATA_TYPE>
+    inline size_t DynamicMatrix<DATA_TYPE>::get_height() const
+    {
+        return height_;
+    }
+
+    template <typename DATA_TYPE>
+    inline size_t DynamicMatrix<DATA_TYPE>::get_width() const
+    {
+        return width_;
+    }
+} // namespace ml::data_structure::matrix
@@ -0,0 +1,32 @@
+/**
+ ** @file src/data_structure/matrix/dynamic_matrix_apply.hxx
+ ** @brief Apply implementations for ml::data_structure::matrix::DynamicMatrix
+ */
+
+#include "computation/simd.hh"
+
+namespace ml::data_structure::matrix
+{
+    template <typename DATA_TYPE>
+    template <class Function>
+    DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::apply(const Function& function)
+    {
+        auto* data = this->data_.data();
+        const size_t size = this->data_.size();
+
+        ml::computation::simd::dispatch([&]() {
+            for (size_t i = 0; i < size; i++)
+                data[i] = function(data[i]);
+        });
+
+        return *this;
+    }
+
+    template <typename DATA_TYPE, class Function>
+    inline DynamicMatrix<DATA_TYPE> apply(const DynamicMatrix<DATA_TYPE>& matrix, const Function& function)
+    {
+        DynamicMatrix<DATA_TYPE> matrix_result = matrix;
+        matrix_result.apply(function);
+        return matrix_result;
+    }
+} // namespace ml::data_structure::matrix
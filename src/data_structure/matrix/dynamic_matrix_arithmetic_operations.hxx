@@ -0,0 +1,283 @@
+/**
+ ** @file src/data_structure/matrix/dynamic_matrix_arithmetic_operations.hxx
+ ** @brief Arithmetic operations implementations for ml::data_structure::matrix::DynamicMatrix
+ */
+
+#include "computation/broadcast.hh"
+
+namespace ml::data_structure::matrix
+{
+    template <typename DATA_TYPE, class Operation>
+    inline static DynamicMatrix<DATA_TYPE>& arithmetic_operation_in_place(DynamicMatrix<DATA_TYPE>& lhs,
+                                                                          const DynamicMatrix<DATA_TYPE>& rhs,
+                                                                          const Operation& operation)
+    {
+        if (lhs.get_height() != rhs.get_height() || lhs.get_width() != rhs.get_width())
+            throw std::invalid_argument("The matrix are not compatible");
+
+        ml::computation::broadcast::apply(lhs.data().data(),
+                                          lhs.get_height(),
+                                          lhs.get_width(),
+                                          rhs.data().data(),
+                                          rhs.get_height(),
+                                          rhs.get_width(),
+                                          lhs.data().data(),
+                                          operation);
+
+        return lhs;
+    }
+
+    template <typename DATA_TYPE, class Operation>
+    static DynamicMatrix<DATA_TYPE> arithmetic_operation(const DynamicMatrix<DATA_TYPE>& lhs,
+                                                         const DynamicMatrix<DATA_TYPE>& rhs,
+                                                         const Operation& operation)
+    {
+        const size_t matrix_result_height = MAX(lhs.get_height(), rhs.get_height());
+        const size_t matrix_result_width = MAX(lhs.get_width(), rhs.get_width());
+
+        if ((lhs.get_height() != matrix_result_height && lhs.get_height() != 1)
+            || (rhs.get_height() != matrix_result_height && rhs.get_height() != 1)
+            || (lhs.get_width() != matrix_result_width && lhs.get_width() != 1)
+            || (rhs.get_width() != matrix_result_width && rhs.get_width() != 1))
+        {
+            throw std::invalid_argument("The matrix are not compatible");
+        }
+
+        DynamicMatrix<DATA_TYPE> matrix_result(matrix_result_height, matrix_result_width);
+
+        ml::computation::broadcast::apply(lhs.data().data(),
+                                          lhs.get_height(),
+                                          lhs.get_width(),
+                                          rhs.data().data(),
+                                          rhs.get_height(),
+                                          rhs.get_width(),
+                                          matrix_result.data().data(),
+                                          operation);
+
+        return matrix_result;
+    }
+
+    template <typename DATA_TYPE, class Operation>
+    inline static DynamicMatrix<DATA_TYPE>& arithmetic_scalar_operation_in_place(DynamicMatrix<DATA_TYPE>& matrix,
+                                                                                 const DATA_TYPE& scalar,
+                                                                                 const Operation& operation)
+    {
+        ml::computation::broadcast::apply(matrix.data().data(),
+                                          matrix.get_height(),
+                                          matrix.get_width(),
+                                          &scalar,
+                                          1,
+                                          1,
+                                          matrix.data().data(),
+                                          operation);
+
+        return matrix;
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::negate()
+    {
+        for (auto& element : this->data_)
+            element = -element;
+
+        return *this;
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> negate(const DynamicMatrix<DATA_TYPE>& matrix)
+    {
+        DynamicMatrix<DATA_TYPE> matrix_result = matrix;
+        matrix_result.negate();
+        return matrix_result;
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::plus(const DynamicMatrix<DATA_TYPE>& rhs)
+    {
+        return arithmetic_operation_in_place(*this, rhs, std::plus<>{});
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> plus(const DynamicMatrix<DATA_TYPE>& lhs, const DynamicMatrix<DATA_TYPE>& rhs)
+    {
+        return ml::data_structure::matrix::arithmetic_operation(lhs, rhs, std::plus<>{});
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::operator+=(const DynamicMatrix<DATA_TYPE>& rhs)
+    {
+        return this->plus(rhs);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::minus(const DynamicMatrix<DATA_TYPE>& rhs)
+    {
+        return arithmetic_operation_in_place(*this, rhs, std::minus<>{});
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> minus(const DynamicMatrix<DATA_TYPE>& lhs, const DynamicMatrix<DATA_TYPE>& rhs)
+    {
+        return ml::data_structure::matrix::arithmetic_operation(lhs, rhs, std::minus<>{});
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::operator-=(const DynamicMatrix<DATA_TYPE>& rhs)
+    {
+        return this->minus(rhs);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::multiplies(const DynamicMatrix<DATA_TYPE>& rhs)
+    {
+        return arithmetic_operation_in_place(*this, rhs, std::multiplies<>{});
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> multiplies(const DynamicMatrix<DATA_TYPE>& lhs, const DynamicMatrix<DATA_TYPE>& rhs)
+    {
+        return ml::data_structure::matrix::arithmetic_operation(lhs, rhs, std::multiplies<>{});
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::operator*=(const DynamicMatrix<DATA_TYPE>& rhs)
+    {
+        return this->multiplies(rhs);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::divides(const DynamicMatrix<DATA_TYPE>& rhs)
+    {
+        return arithmetic_operation_in_place(*this, rhs, std::divides<>{});
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> divides(const DynamicMatrix<DATA_TYPE>& lhs, const DynamicMatrix<DATA_TYPE>& rhs)
+    {
+        return ml::data_structure::matrix::arithmetic_operation(lhs, rhs, std::divides<>{});
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::operator/=(const DynamicMatrix<DATA_TYPE>& rhs)
+    {
+        return this->divides(rhs);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::modulus(const DynamicMatrix<DATA_TYPE>& rhs)
+    {
+        return arithmetic_operation_in_place(*this, rhs, std::modulus<>{});
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> modulus(const DynamicMatrix<DATA_TYPE>& lhs, const DynamicMatrix<DATA_TYPE>& rhs)
+    {
+        return ml::data_structure::matrix::arithmetic_operation(lhs, rhs, std::modulus<>{});
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::operator%=(const DynamicMatrix<DATA_TYPE>& rhs)
+    {
+        return this->modulus(rhs);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::plus_scalar(const DATA_TYPE& scalar)
+    {
+        return arithmetic_scalar_operation_in_place(*this, scalar, std::plus<>{});
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> plus_scalar(const DynamicMatrix<DATA_TYPE>& matrix, const DATA_TYPE& scalar)
+    {
+        DynamicMatrix<DATA_TYPE> matrix_result = matrix;
+        matrix_result.plus_scalar(scalar);
+        return matrix_result;
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::operator+=(const DATA_TYPE& scalar)
+    {
+        return this->plus_scalar(scalar);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::minus_scalar(const DATA_TYPE& scalar)
+    {
+        return arithmetic_scalar_operation_in_place(*this, scalar, std::minus<>{});
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> minus_scalar(const DynamicMatrix<DATA_TYPE>& matrix, const DATA_TYPE& scalar)
+    {
+        DynamicMatrix<DATA_TYPE> matrix_result = matrix;
+        matrix_result.minus_scalar(scalar);
+        return matrix_result;
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::operator-=(const DATA_TYPE& scalar)
+    {
+        return this->minus_scalar(scalar);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::multiplies_scalar(const DATA_TYPE& scalar)
+    {
+        return arithmetic_scalar_operation_in_place(*this, scalar, std::multiplies<>{});
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> multiplies_scalar(const DynamicMatrix<DATA_TYPE>& matrix, const DATA_TYPE& scalar)
+    {
+        DynamicMatrix<DATA_TYPE> matrix_result = matrix;
+        matrix_result.multiplies_scalar(scalar);
+        return matrix_result;
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::operator*=(const DATA_TYPE& scalar)
+    {
+        return this->multiplies_scalar(scalar);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::divides_scalar(const DATA_TYPE& scalar)
+    {
+        return arithmetic_scalar_operation_in_place(*this, scalar, std::divides<>{});
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> divides_scalar(const DynamicMatrix<DATA_TYPE>& matrix, const DATA_TYPE& scalar)
+    {
+        DynamicMatrix<DATA_TYPE> matrix_result = matrix;
+        matrix_result.divides_scalar(scalar);
+        return matrix_result;
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::operator/=(const DATA_TYPE& scalar)
+    {
+        return this->divides_scalar(scalar);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::modulus_scalar(const DATA_TYPE& scalar)
+    {
+        return arithmetic_scalar_operation_in_place(*this, scalar, std::modulus<>{});
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> modulus_scalar(const DynamicMatrix<DATA_TYPE>& matrix, const DATA_TYPE& scalar)
+    {
+        DynamicMatrix<DATA_TYPE> matrix_result = matrix;
+        matrix_result.modulus_scalar(scalar);
+        return matrix_result;
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::operator%=(const DATA_TYPE& scalar)
+    {
+        return this->modulus_scalar(scalar);
+    }
+} // namespace ml::data_structure::matrix
@@ -0,0 +1,26 @@
+/**
+ ** @file src/data_structure/matrix/dynamic_matrix_comparison.hxx
+ ** @brief Comparison functions implementations for ml::data_structure::matrix::DynamicMatrix
+ */
+
+namespace ml::data_structure::matrix
+{
+    template <typename DATA_TYPE>
+    bool compare(const DynamicMatrix<DATA_TYPE>& lhs, const DynamicMatrix<DATA_TYPE>& rhs)
+    {
+        return lhs.get_height() == rhs.get_height() && lhs.get_width() == rhs.get_width()
+            && lhs.data() == rhs.data();
+    }
+
+    template <typename DATA_TYPE>
+    bool operator==(const DynamicMatrix<DATA_TYPE>& lhs, const DynamicMatrix<DATA_TYPE>& rhs)
+    {
+        return ml::data_structure::matrix::compare(lhs, rhs);
+    }
+
+    template <typename DATA_TYPE>
+    bool operator!=(const DynamicMatrix<DATA_TYPE>& lhs, const DynamicMatrix<DATA_TYPE>& rhs)
+    {
+        return !ml::data_structure::matrix::compare(lhs, rhs);
+    }
+} // namespace ml::data_structure::matrix
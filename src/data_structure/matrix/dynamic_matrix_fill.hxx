@@ -0,0 +1,61 @@
+/**
+ ** @file src/data_structure/matrix/dynamic_matrix_fill.hxx
+ ** @brief Fill implementations for ml::data_structure::matrix::DynamicMatrix
+ */
+
+namespace ml::data_structure::matrix
+{
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::fill(const DATA_TYPE& value)
+    {
+        std::fill(this->data_.begin(), this->data_.end(), value);
+        return *this;
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::fill_row(size_t row_index, const DATA_TYPE& value)
+    {
+        std::fill(this->data_.begin() + row_index * width_, this->data_.begin() + (row_index + 1) * width_, value);
+        return *this;
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::fill_column(size_t column_index, const DATA_TYPE& value)
+    {
+        const auto stride = static_cast<typename column_iterator_t::difference_type>(width_);
+        column_iterator_t column_begin(this->data_.begin() + column_index, stride);
+
+        std::fill(column_begin, column_begin + height_, value);
+        return *this;
+    }
+
+    template <typename DATA_TYPE>
+    template <class Generator>
+    inline DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::fill_generator(const Generator& generator)
+    {
+        ml::generator::generate(this->data_.data(), this->data_.data() + this->data_.size(), generator);
+        return *this;
+    }
+
+    template <typename DATA_TYPE>
+    template <class Generator>
+    inline DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::fill_row_generator(size_t row_index,
+                                                                                 const Generator& generator)
+    {
+        ml::generator::generate(
+            this->data_.data() + row_index * width_, this->data_.data() + (row_index + 1) * width_, generator);
+        return *this;
+    }
+
+    template <typename DATA_TYPE>
+    template <class Generator>
+    inline DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::fill_column_generator(size_t column_index,
+                                                                                    const Generator& generator)
+    {
+        const auto stride = static_cast<typename column_iterator_t::difference_type>(width_);
+        column_iterator_t column_begin(this->data_.begin() + column_index, stride);
+
+        std::generate(column_begin, column_begin + height_, generator);
+        return *this;
+    }
+} // namespace ml::data_structure::matrix
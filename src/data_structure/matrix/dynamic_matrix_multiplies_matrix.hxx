@@ -0,0 +1,27 @@
+/**
+ ** @file src/data_structure/matrix/dynamic_matrix_multiplies_matrix.hxx
+ ** @brief Multiplies Matrix implementations for ml::data_structure::matrix::DynamicMatrix
+ */
+
+#include "computation/gemm.hh"
+
+namespace ml::data_structure::matrix
+{
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> multiplies_matrix(const DynamicMatrix<DATA_TYPE>& lhs, const DynamicMatrix<DATA_TYPE>& rhs)
+    {
+        if (lhs.get_width() != rhs.get_height())
+            throw std::invalid_argument("The matrix are not compatible");
+
+        const size_t m = lhs.get_height();
+        const size_t n = lhs.get_width();
+        const size_t p = rhs.get_width();
+
+        DynamicMatrix<DATA_TYPE> new_matrix(m, p);
+
+        ml::computation::gemm::multiply<DATA_TYPE>(
+            m, n, p, lhs.data().data(), n, 1, rhs.data().data(), p, 1, new_matrix.data().data(), p);
+
+        return new_matrix;
+    }
+} // namespace ml::data_structure::matrix
@@ -0,0 +1,35 @@
+/**
+ ** @file src/data_structure/matrix/dynamic_matrix_print.hxx
+ ** @brief Print implementations for ml::data_structure::matrix::DynamicMatrix
+ */
+
+#include <iomanip>
+
+namespace ml::data_structure::matrix
+{
+    template <typename DATA_TYPE>
+    std::ostream& print(const DynamicMatrix<DATA_TYPE>& matrix, std::ostream& os)
+    {
+        std::ios_base::fmtflags f(os.flags());
+
+        for (size_t i = 0; i < matrix.get_height(); i++)
+        {
+            os << "| ";
+
+            for (size_t j = 0; j < matrix.get_width(); j++)
+                os << std::fixed << std::setw(7) << std::setprecision(4) << matrix(i, j) << " ";
+
+            os << "|" << std::endl;
+        }
+
+        os.flags(f);
+
+        return os;
+    }
+
+    template <typename DATA_TYPE>
+    inline std::ostream& operator<<(std::ostream& os, const DynamicMatrix<DATA_TYPE>& matrix)
+    {
+        return ml::data_structure::matrix::print(matrix, os);
+    }
+} // namespace ml::data_structure::matrix
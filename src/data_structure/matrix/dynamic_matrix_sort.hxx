@@ -0,0 +1,144 @@
+/**
+ ** @file src/data_structure/matrix/dynamic_matrix_sort.hxx
+ ** @brief Sort implementations for ml::data_structure::matrix::DynamicMatrix
+ */
+
+namespace ml::data_structure::matrix
+{
+    template <typename DATA_TYPE>
+    template <class Compare>
+    DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::sort(const Compare& compare)
+    {
+        ml::computation::sort::sort(this->data_.data(), this->data_.data() + this->data_.size(), compare);
+        return *this;
+    }
+
+    template <typename DATA_TYPE, class Compare>
+    inline DynamicMatrix<DATA_TYPE> sort(const DynamicMatrix<DATA_TYPE>& matrix, const Compare& compare)
+    {
+        DynamicMatrix<DATA_TYPE> matrix_result = matrix;
+        matrix_result.sort(compare);
+        return matrix_result;
+    }
+
+    template <typename DATA_TYPE>
+    template <class Compare>
+    DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::sort_rows(const Compare& compare)
+    {
+        const auto row_stride = static_cast<ptrdiff_t>(width_);
+        ml::computation::sort::sort_rows(height_, width_, this->data_.data(), row_stride, compare);
+        return *this;
+    }
+
+    template <typename DATA_TYPE, class Compare>
+    inline DynamicMatrix<DATA_TYPE> sort_rows(const DynamicMatrix<DATA_TYPE>& matrix, const Compare& compare)
+    {
+        DynamicMatrix<DATA_TYPE> matrix_result = matrix;
+        matrix_result.sort_rows(compare);
+        return matrix_result;
+    }
+
+    template <typename DATA_TYPE>
+    template <class Compare>
+    DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::sort_columns(const Compare& compare)
+    {
+        const auto row_stride = static_cast<ptrdiff_t>(width_);
+        ml::computation::sort::sort_columns(height_, width_, this->data_.data(), row_stride, compare);
+        return *this;
+    }
+
+    template <typename DATA_TYPE, class Compare>
+    inline DynamicMatrix<DATA_TYPE> sort_columns(const DynamicMatrix<DATA_TYPE>& matrix, const Compare& compare)
+    {
+        DynamicMatrix<DATA_TYPE> matrix_result = matrix;
+        matrix_result.sort_columns(compare);
+        return matrix_result;
+    }
+
+    template <typename DATA_TYPE>
+    template <class Compare>
+    DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::sort_rows_by_column(size_t column_index,
+                                                                           const Compare& compare)
+    {
+        if (column_index >= width_)
+            throw std::out_of_range("column_index out of range");
+
+        const auto row_stride = static_cast<ptrdiff_t>(width_);
+        std::vector<size_t> permutation(height_);
+        ml::computation::sort::argsort(
+            height_, this->data_.data() + column_index, row_stride, permutation.data(), 1, compare);
+
+        // The rows are gathered in a new buffer which replaces the current one
+        data_array_t data(this->data_.size());
+        ml::computation::sort::gather_rows(
+            height_, width_, this->data_.data(), row_stride, permutation.data(), data.data(), row_stride);
+        this->data_.swap(data);
+        return *this;
+    }
+
+    template <typename DATA_TYPE, class Compare>
+    inline DynamicMatrix<DATA_TYPE> sort_rows_by_column(const DynamicMatrix<DATA_TYPE>& matrix,
+                                                        size_t column_index,
+                                                        const Compare& compare)
+    {
+        DynamicMatrix<DATA_TYPE> matrix_result = matrix;
+        matrix_result.sort_rows_by_column(column_index, compare);
+        return matrix_result;
+    }
+
+    template <typename DATA_TYPE>
+    template <class Compare>
+    inline DynamicMatrix<size_t> DynamicMatrix<DATA_TYPE>::argsort(const Compare& compare) const
+    {
+        return ml::data_structure::matrix::argsort(*this, compare);
+    }
+
+    template <typename DATA_TYPE, class Compare>
+    inline DynamicMatrix<size_t> argsort(const DynamicMatrix<DATA_TYPE>& matrix, const Compare& compare)
+    {
+        DynamicMatrix<size_t> indexes(matrix.get_height(), matrix.get_width());
+        ml::computation::sort::argsort(
+            matrix.data().size(), matrix.data().data(), 1, indexes.data().data(), 1, compare);
+        return indexes;
+    }
+
+    template <typename DATA_TYPE>
+    template <class Compare>
+    inline DynamicMatrix<size_t> DynamicMatrix<DATA_TYPE>::argsort_rows(const Compare& compare) const
+    {
+        return ml::data_structure::matrix::argsort_rows(*this, compare);
+    }
+
+    template <typename DATA_TYPE, class Compare>
+    inline DynamicMatrix<size_t> argsort_rows(const DynamicMatrix<DATA_TYPE>& matrix, const Compare& compare)
+    {
+        DynamicMatrix<size_t> indexes(matrix.get_height(), matrix.get_width());
+        ml::computation::sort::argsort_rows(matrix.get_height(),
+                                            matrix.get_width(),
+                                            matrix.data().data(),
+                                            static_cast<ptrdiff_t>(matrix.get_width()),
+                                            indexes.data().data(),
+                                            compare);
+        return indexes;
+    }
+
+    template <typename DATA_TYPE>
+    template <class Compare>
+    inline DynamicMatrix<size_t> DynamicMatrix<DATA_TYPE>::argsort_columns(const Compare& compare) const
+    {
+        return ml::data_structure::matrix::argsort_columns(*this, compare);
+    }
+
+    template <typename DATA_TYPE, class Compare>
+    inline DynamicMatrix<size_t> argsort_columns(const DynamicMatrix<DATA_TYPE>& matrix, const Compare& compare)
+    {
+        DynamicMatrix<size_t> indexes(matrix.get_height(), matrix.get_width());
+        ml::computation::sort::argsort_columns(matrix.get_height(),
+                                               matrix.get_width(),
+                                               matrix.data().data(),
+                                               static_cast<ptrdiff_t>(matrix.get_width()),
+                                               indexes.data().data(),
+                                               compare);
+        return indexes;
+    }
+} // namespace ml::data_structure::matrix
@@ -0,0 +1,527 @@
+/**
+ ** @file src/data_structure/matrix/dynamic_matrix_statistics.hxx
+ ** @brief Statistic functions implementations for ml::data_structure::matrix::DynamicMatrix
+ */
+
+#include <cmath>
+#include <vector>
+
+#include "computation/statistic.hh"
+
+namespace ml::data_structure::matrix
+{
+    template <typename DATA_TYPE, class Function>
+    static DATA_TYPE statistic(const DynamicMatrix<DATA_TYPE>& matrix, const Function& function)
+    {
+        return function(matrix.data().cbegin(), matrix.data().cend());
+    }
+
+    template <typename DATA_TYPE, class Function>
+    static DynamicMatrix<DATA_TYPE> statistic_columns(const DynamicMatrix<DATA_TYPE>& matrix, const Function& function)
+    {
+        using column_const_iterator_t = typename DynamicMatrix<DATA_TYPE>::column_const_iterator_t;
+
+        DynamicMatrix<DATA_TYPE> row_matrix(1, matrix.get_width());
+        const auto stride = static_cast<typename column_const_iterator_t::difference_type>(matrix.get_width());
+        const auto height = static_cast<typename column_const_iterator_t::difference_type>(matrix.get_height());
+
+        // The columns are traversed in place with the runtime stride, nothing is gathered
+        for (size_t j = 0; j < matrix.get_width(); j++)
+        {
+            column_const_iterator_t column_begin(matrix.data().cbegin() + j, stride);
+            row_matrix(0, j) = function(column_begin, column_begin + height);
+        }
+
+        return row_matrix;
+    }
+
+    template <typename DATA_TYPE, class Kernel>
+    static DynamicMatrix<DATA_TYPE> reduce_columns(const DynamicMatrix<DATA_TYPE>& matrix, const Kernel& kernel)
+    {
+        DynamicMatrix<DATA_TYPE> row_matrix(1, matrix.get_width());
+        kernel(matrix.get_height(),
+               matrix.get_width(),
+               matrix.data().data(),
+               static_cast<ptrdiff_t>(matrix.get_width()),
+               row_matrix.data().data());
+
+        return row_matrix;
+    }
+
+    template <typename DATA_TYPE, class Function>
+    static DynamicMatrix<DATA_TYPE> statistic_rows(const DynamicMatrix<DATA_TYPE>& matrix, const Function& function)
+    {
+        DynamicMatrix<DATA_TYPE> column_matrix(matrix.get_height(), 1);
+        const size_t width = matrix.get_width();
+
+        for (size_t i = 0; i < matrix.get_height(); i++)
+        {
+            column_matrix(i, 0) =
+                function(matrix.data().cbegin() + (i * width), matrix.data().cbegin() + ((i + 1) * width));
+        }
+
+        return column_matrix;
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE DynamicMatrix<DATA_TYPE>::sum() const
+    {
+        return ml::data_structure::matrix::sum(*this);
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE sum(const DynamicMatrix<DATA_TYPE>& matrix)
+    {
+        return statistic(matrix, [](const auto& begin, const auto& end) {
+            return ml::computation::statistic::sum(begin, end);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE sum(const DynamicMatrix<DATA_TYPE>& matrix, ml::computation::statistic::Execution execution)
+    {
+        return statistic(matrix, [execution](const auto& begin, const auto& end) {
+            return ml::computation::statistic::sum(begin, end, execution);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> DynamicMatrix<DATA_TYPE>::sum_columns() const
+    {
+        return ml::data_structure::matrix::sum_columns(*this);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> sum_columns(const DynamicMatrix<DATA_TYPE>& matrix)
+    {
+        return reduce_columns(matrix, ml::computation::statistic::sum_columns<DATA_TYPE>);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> DynamicMatrix<DATA_TYPE>::sum_rows() const
+    {
+        return ml::data_structure::matrix::sum_rows(*this);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> sum_rows(const DynamicMatrix<DATA_TYPE>& matrix)
+    {
+        return statistic_rows(matrix, [](const auto& begin, const auto& end) {
+            return ml::computation::statistic::sum(begin, end);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE DynamicMatrix<DATA_TYPE>::min() const
+    {
+        return ml::data_structure::matrix::min(*this);
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE min(const DynamicMatrix<DATA_TYPE>& matrix)
+    {
+        return statistic(matrix, [](const auto& begin, const auto& end) {
+            return *std::min_element(begin, end);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> DynamicMatrix<DATA_TYPE>::min_columns() const
+    {
+        return ml::data_structure::matrix::min_columns(*this);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> min_columns(const DynamicMatrix<DATA_TYPE>& matrix)
+    {
+        return reduce_columns(matrix, ml::computation::statistic::min_columns<DATA_TYPE>);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> DynamicMatrix<DATA_TYPE>::min_rows() const
+    {
+        return ml::data_structure::matrix::min_rows(*this);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> min_rows(const DynamicMatrix<DATA_TYPE>& matrix)
+    {
+        return statistic_rows(matrix, [](const auto& begin, const auto& end) {
+            return *std::min_element(begin, end);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE DynamicMatrix<DATA_TYPE>::max() const
+    {
+        return ml::data_structure::matrix::max(*this);
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE max(const DynamicMatrix<DATA_TYPE>& matrix)
+    {
+        return statistic(matrix, [](const auto& begin, const auto& end) {
+            return *std::max_element(begin, end);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> DynamicMatrix<DATA_TYPE>::max_columns() const
+    {
+        return ml::data_structure::matrix::max_columns(*this);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> max_columns(const DynamicMatrix<DATA_TYPE>& matrix)
+    {
+        return reduce_columns(matrix, ml::computation::statistic::max_columns<DATA_TYPE>);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> DynamicMatrix<DATA_TYPE>::max_rows() const
+    {
+        return ml::data_structure::matrix::max_rows(*this);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> max_rows(const DynamicMatrix<DATA_TYPE>& matrix)
+    {
+        return statistic_rows(matrix, [](const auto& begin, const auto& end) {
+            return *std::max_element(begin, end);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE DynamicMatrix<DATA_TYPE>::mean() const
+    {
+        return ml::data_structure::matrix::mean(*this);
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE mean(const DynamicMatrix<DATA_TYPE>& matrix)
+    {
+        return statistic(matrix, [](const auto& begin, const auto& end) {
+            return ml::computation::statistic::mean(begin, end);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE mean(const DynamicMatrix<DATA_TYPE>& matrix, ml::computation::statistic::Execution execution)
+    {
+        return statistic(matrix, [execution](const auto& begin, const auto& end) {
+            return ml::computation::statistic::mean(begin, end, execution);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> DynamicMatrix<DATA_TYPE>::mean_columns() const
+    {
+        return ml::data_structure::matrix::mean_columns(*this);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> mean_columns(const DynamicMatrix<DATA_TYPE>& matrix)
+    {
+        return reduce_columns(matrix, ml::computation::statistic::mean_columns<DATA_TYPE>);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> DynamicMatrix<DATA_TYPE>::mean_rows() const
+    {
+        return ml::data_structure::matrix::mean_rows(*this);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> mean_rows(const DynamicMatrix<DATA_TYPE>& matrix)
+    {
+        return statistic_rows(matrix, [](const auto& begin, const auto& end) {
+            return ml::computation::statistic::mean(begin, end);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE DynamicMatrix<DATA_TYPE>::median() const
+    {
+        return ml::data_structure::matrix::median(*this);
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE median(const DynamicMatrix<DATA_TYPE>& matrix)
+    {
+        return statistic(matrix, [](const auto& begin, const auto& end) {
+            return ml::computation::statistic::median(begin, end);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> DynamicMatrix<DATA_TYPE>::median_columns() const
+    {
+        return ml::data_structure::matrix::median_columns(*this);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> median_columns(const DynamicMatrix<DATA_TYPE>& matrix)
+    {
+        DynamicMatrix<DATA_TYPE> row_matrix(1, matrix.get_width());
+
+        // The gathered column is not read again, so the selection reorders it instead of a copy
+        std::vector<DATA_TYPE> column(matrix.get_height());
+
+        for (size_t j = 0; j < matrix.get_width(); j++)
+        {
+            for (size_t i = 0; i < matrix.get_height(); i++)
+                column[i] = matrix(i, j);
+
+            row_matrix(0, j) = ml::computation::statistic::median_in_place(column.begin(), column.end());
+        }
+
+        return row_matrix;
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> DynamicMatrix<DATA_TYPE>::median_rows() const
+    {
+        return ml::data_structure::matrix::median_rows(*this);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> median_rows(const DynamicMatrix<DATA_TYPE>& matrix)
+    {
+        std::vector<DATA_TYPE> buffer(matrix.get_width());
+
+        return statistic_rows(matrix, [&buffer](const auto& begin, const auto& end) {
+            return ml::computation::statistic::median(begin, end, buffer);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE DynamicMatrix<DATA_TYPE>::variance(size_t ddof) const
+    {
+        return ml::data_structure::matrix::variance(*this, ddof);
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE variance(const DynamicMatrix<DATA_TYPE>& matrix, size_t ddof)
+    {
+        return statistic(matrix, [ddof](const auto& begin, const auto& end) {
+            return ml::computation::statistic::variance(begin, end, ddof);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE variance(const DynamicMatrix<DATA_TYPE>& matrix,
+                              size_t ddof,
+                              ml::computation::statistic::Execution execution)
+    {
+        return statistic(matrix, [ddof, execution](const auto& begin, const auto& end) {
+            return ml::computation::statistic::variance(begin, end, ddof, execution);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> DynamicMatrix<DATA_TYPE>::variance_columns(size_t ddof) const
+    {
+        return ml::data_structure::matrix::variance_columns(*this, ddof);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> variance_columns(const DynamicMatrix<DATA_TYPE>& matrix, size_t ddof)
+    {
+        DynamicMatrix<DATA_TYPE> row_matrix(1, matrix.get_width());
+        ml::computation::statistic::variance_columns(matrix.get_height(),
+                                                     matrix.get_width(),
+                                                     matrix.data().data(),
+                                                     matrix.get_width(),
+                                                     row_matrix.data().data(),
+                                                     ddof);
+
+        return row_matrix;
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> DynamicMatrix<DATA_TYPE>::variance_rows(size_t ddof) const
+    {
+        return ml::data_structure::matrix::variance_rows(*this, ddof);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> variance_rows(const DynamicMatrix<DATA_TYPE>& matrix, size_t ddof)
+    {
+        return statistic_rows(matrix, [ddof](const auto& begin, const auto& end) {
+            return ml::computation::statistic::variance(begin, end, ddof);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE DynamicMatrix<DATA_TYPE>::standard_deviation(size_t ddof) const
+    {
+        return ml::data_structure::matrix::standard_deviation(*this, ddof);
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE standard_deviation(const DynamicMatrix<DATA_TYPE>& matrix, size_t ddof)
+    {
+        return statistic(matrix, [ddof](const auto& begin, const auto& end) {
+            return ml::computation::statistic::standard_deviation(begin, end, ddof);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE standard_deviation(const DynamicMatrix<DATA_TYPE>& matrix,
+                                        size_t ddof,
+                                        ml::computation::statistic::Execution execution)
+    {
+        return statistic(matrix, [ddof, execution](const auto& begin, const auto& end) {
+            return ml::computation::statistic::standard_deviation(begin, end, ddof, execution);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> DynamicMatrix<DATA_TYPE>::standard_deviation_columns(size_t ddof) const
+    {
+        return ml::data_structure::matrix::standard_deviation_columns(*this, ddof);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> standard_deviation_columns(const DynamicMatrix<DATA_TYPE>& matrix, size_t ddof)
+    {
+        return variance_columns(matrix, ddof).apply([](const auto& value) { return std::sqrt(value); });
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> DynamicMatrix<DATA_TYPE>::standard_deviation_rows(size_t ddof) const
+    {
+        return ml::data_structure::matrix::standard_deviation_rows(*this, ddof);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> standard_deviation_rows(const DynamicMatrix<DATA_TYPE>& matrix, size_t ddof)
+    {
+        return statistic_rows(matrix, [ddof](const auto& begin, const auto& end) {
+            return ml::computation::statistic::standard_deviation(begin, end, ddof);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE DynamicMatrix<DATA_TYPE>::sum_product() const
+    {
+        return ml::data_structure::matrix::sum_product(*this);
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE sum_product(const DynamicMatrix<DATA_TYPE>& matrix)
+    {
+        return statistic(matrix, [](const auto& begin, const auto& end) {
+            return ml::computation::statistic::sum_product(begin, end);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> DynamicMatrix<DATA_TYPE>::sum_product_columns() const
+    {
+        return ml::data_structure::matrix::sum_product_columns(*this);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> sum_product_columns(const DynamicMatrix<DATA_TYPE>& matrix)
+    {
+        return reduce_columns(matrix, ml::computation::statistic::sum_product_columns<DATA_TYPE>);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> DynamicMatrix<DATA_TYPE>::sum_product_rows() const
+    {
+        return ml::data_structure::matrix::sum_product_rows(*this);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> sum_product_rows(const DynamicMatrix<DATA_TYPE>& matrix)
+    {
+        return statistic_rows(matrix, [](const auto& begin, const auto& end) {
+            return ml::computation::statistic::sum_product(begin, end);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE DynamicMatrix<DATA_TYPE>::peak_to_peak() const
+    {
+        return ml::data_structure::matrix::peak_to_peak(*this);
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE peak_to_peak(const DynamicMatrix<DATA_TYPE>& matrix)
+    {
+        return statistic(matrix, [](const auto& begin, const auto& end) {
+            return ml::computation::statistic::peak_to_peak(begin, end);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> DynamicMatrix<DATA_TYPE>::peak_to_peak_columns() const
+    {
+        return ml::data_structure::matrix::peak_to_peak_columns(*this);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> peak_to_peak_columns(const DynamicMatrix<DATA_TYPE>& matrix)
+    {
+        return statistic_columns(matrix, [](const auto& begin, const auto& end) {
+            return ml::computation::statistic::peak_to_peak(begin, end);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> DynamicMatrix<DATA_TYPE>::peak_to_peak_rows() const
+    {
+        return ml::data_structure::matrix::peak_to_peak_rows(*this);
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> peak_to_peak_rows(const DynamicMatrix<DATA_TYPE>& matrix)
+    {
+        return statistic_rows(matrix, [](const auto& begin, const auto& end) {
+            return ml::computation::statistic::peak_to_peak(begin, end);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline ml::computation::statistic::Description<DATA_TYPE> DynamicMatrix<DATA_TYPE>::describe(size_t ddof) const
+    {
+        return ml::data_structure::matrix::describe(*this, ddof);
+    }
+
+    template <typename DATA_TYPE>
+    inline ml::computation::statistic::Description<DATA_TYPE> describe(const DynamicMatrix<DATA_TYPE>& matrix,
+                                                                       size_t ddof)
+    {
+        return ml::computation::statistic::describe(matrix.data().cbegin(), matrix.data().cend(), ddof);
+    }
+
+    template <typename DATA_TYPE>
+    inline ml::computation::statistic::Description<DynamicMatrix<DATA_TYPE>>
+    DynamicMatrix<DATA_TYPE>::describe_columns(size_t ddof) const
+    {
+        return ml::data_structure::matrix::describe_columns(*this, ddof);
+    }
+
+    template <typename DATA_TYPE>
+    inline ml::computation::statistic::Description<DynamicMatrix<DATA_TYPE>>
+    describe_columns(const DynamicMatrix<DATA_TYPE>& matrix, size_t ddof)
+    {
+        return describe_columns(matrix.view(), ddof);
+    }
+
+    template <typename DATA_TYPE>
+    inline ml::computation::statistic::Description<DynamicMatrix<DATA_TYPE>>
+    DynamicMatrix<DATA_TYPE>::describe_rows(size_t ddof) const
+    {
+        return ml::data_structure::matrix::describe_rows(*this, ddof);
+    }
+
+    template <typename DATA_TYPE>
+    inline ml::computation::statistic::Description<DynamicMatrix<DATA_TYPE>>
+    describe_rows(const DynamicMatrix<DATA_TYPE>& matrix, size_t ddof)
+    {
+        return describe_rows(matrix.view(), ddof);
+    }
+} // namespace ml::data_structure::matrix
@@ -0,0 +1,46 @@
+/**
+ ** @file src/data_structure/matrix/dynamic_matrix_transpose.hxx
+ ** @brief Transpose implementations for ml::data_structure::matrix::DynamicMatrix
+ */
+
+#include <utility>
+
+#include "computation/transpose.hh"
+
+namespace ml::data_structure::matrix
+{
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<DATA_TYPE> DynamicMatrix<DATA_TYPE>::transpose() const
+    {
+        return ml::data_structure::matrix::transpose(*this);
+    }
+
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE>& DynamicMatrix<DATA_TYPE>::transpose_in_place()
+    {
+        if (this->height_ == this->width_)
+        {
+            ml::computation::transpose::in_place(this->height_, this->data_.data());
+            return *this;
+        }
+
+        data_array_t data(this->data_.size());
+        ml::computation::transpose::copy(this->height_, this->width_, this->data_.data(), data.data());
+
+        this->data_ = std::move(data);
+        std::swap(this->height_, this->width_);
+
+        return *this;
+    }
+
+    template <typename DATA_TYPE>
+    DynamicMatrix<DATA_TYPE> transpose(const DynamicMatrix<DATA_TYPE>& matrix)
+    {
+        DynamicMatrix<DATA_TYPE> new_matrix(matrix.get_width(), matrix.get_height());
+
+        ml::computation::transpose::copy(
+            matrix.get_height(), matrix.get_width(), matrix.data().data(), new_matrix.data().data());
+
+        return new_matrix;
+    }
+} // namespace ml::data_structure::matrix
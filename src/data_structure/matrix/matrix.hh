@@ -9,7 +9,13 @@
 #include <functional>
 #include <ostream>
 
+#include "computation/sort.hh"
+#include "computation/statistic.hh"
 #include "data_structure/iterator/step_iterator.hh"
+#include "data_structure/iterator/unchecked_step_iterator.hh"
+#include "data_structure/matrix/matrix_expression.hh"
+#include "data_structure/matrix/matrix_view.hh"
+#include "generator/generator.hh"
 
 #define MAX(a, b) ((a) > (b) ? (a) : (b))
 #define ADD(a, b) ((a) + (b))
@@ -29,6 +35,12 @@ namespace ml::data_structure::matrix
         /// ConstStepIterator for the columns of the matrix
         using column_const_step_iterator_t =
             ml::data_structure::iterator::StepIterator<typename data_array_t::const_iterator, WIDTH>;
+        /// Iterator for the columns of the matrix without bound checking, for the internal loops
+        using column_iterator_t =
+            ml::data_structure::iterator::UncheckedStepIterator<typename data_array_t::iterator, WIDTH>;
+        /// Const iterator for the columns of the matrix without bound checking, for the internal loops
+        using column_const_iterator_t =
+            ml::data_structure::iterator::UncheckedStepIterator<typename data_array_t::const_iterator, WIDTH>;
 
         /** @name Constructors
          ** \{ */
@@ -46,6 +58,19 @@ namespace ml::data_structure::matrix
          */
         explicit Matrix(const data_array_t& data);
 
+        /** @brief Instantiate a new matrix from a lazy expression, computing every element in one pass
+         ** @param expression The expression, it must evaluate to this matrix type
+         */
+        template <class Expression, typename = std::enable_if_t<is_lazy_matrix_expression_v<Expression>>>
+        Matrix(const Expression& expression);
+
+        /** @brief Compute a lazy expression in one pass directly into the matrix
+         ** @param expression The expression, it must evaluate to this matrix type
+         ** @return The reference to the current matrix
+         */
+        template <class Expression, typename = std::enable_if_t<is_lazy_matrix_expression_v<Expression>>>
+        Matrix<DATA_TYPE, HEIGHT, WIDTH>& operator=(const Expression& expression);
+
         /** \} */
 
         /** @name Matrix Operations
@@ -115,11 +140,46 @@ namespace ml::data_structure::matrix
         template <class Compare = std::less<DATA_TYPE>>
         Matrix<DATA_TYPE, HEIGHT, WIDTH>& sort_columns(const Compare& compare = Compare());
 
+        /** @brief Sort the rows of the matrix in place by the values of one of its columns
+         ** @details The rows are stably ordered by the column, then moved in a single gather pass
+         ** @param column_index The index of the column to sort by
+         ** @param compare The compare function, std::less by default
+         ** @return The reference to the current matrix
+         */
+        template <class Compare = std::less<DATA_TYPE>>
+        Matrix<DATA_TYPE, HEIGHT, WIDTH>& sort_rows_by_column(size_t column_index, const Compare& compare = Compare());
+
+        /** @brief Compute the indexes that sort the matrix as it was a flat array
+         ** @param compare The compare function, std::less by default
+         ** @return The flat indexes of the elements in their sorted order, equivalent elements keep their order
+         */
+        template <class Compare = std::less<DATA_TYPE>>
+        Matrix<size_t, HEIGHT, WIDTH> argsort(const Compare& compare = Compare()) const;
+
+        /** @brief Compute the indexes that sort each row of the matrix
+         ** @param compare The compare function, std::less by default
+         ** @return The column indexes of the elements of each row in their sorted order
+         */
+        template <class Compare = std::less<DATA_TYPE>>
+        Matrix<size_t, HEIGHT, WIDTH> argsort_rows(const Compare& compare = Compare()) const;
+
+        /** @brief Compute the indexes that sort each column of the matrix
+         ** @param compare The compare function, std::less by default
+         ** @return The row indexes of the elements of each column in their sorted order
+         */
+        template <class Compare = std::less<DATA_TYPE>>
+        Matrix<size_t, HEIGHT, WIDTH> argsort_columns(const Compare& compare = Compare()) const;
+
         /** @brief Transpose the matrix
          ** @return The new transposed matrix
          */
         Matrix<DATA_TYPE, WIDTH, HEIGHT> transpose() const;
 
+        /** @brief Transpose the square matrix in place
+         ** @return The reference to the current matrix
+         */
+        Matrix<DATA_TYPE, HEIGHT, WIDTH>& transpose_in_place();
+
         /** @brief Extract a sub matrix from the current matrix
          ** @tparam START_HEIGHT_INDEX The starting height index in the matrix
          ** @tparam START_WIDTH_INDEX The starting width index in the matrix
@@ -283,6 +343,25 @@ namespace ml::data_structure::matrix
          */
         Matrix<DATA_TYPE, HEIGHT, 1> peak_to_peak_rows() const;
 
+        /** @brief Sum, min, max, mean, variance, standard deviation and peak to peak of all the element of the matrix,
+         ** computed in one pass
+         ** @param ddof The divisor used in the calculation of the variance is N - ddof, 0 by default
+         ** @return The statistics
+         */
+        ml::computation::statistic::Description<DATA_TYPE> describe(size_t ddof = 0) const;
+
+        /** @brief Statistics of describe of all the columns, computed in one sweep over the rows
+         ** @param ddof The divisor used in the calculation of the variance is N - ddof, 0 by default
+         ** @return The row matrices containing the statistics
+         */
+        ml::computation::statistic::Description<Matrix<DATA_TYPE, 1, WIDTH>> describe_columns(size_t ddof = 0) const;
+
+        /** @brief Statistics of describe of all the rows
+         ** @param ddof The divisor used in the calculation of the variance is N - ddof, 0 by default
+         ** @return The column matrices containing the statistics
+         */
+        ml::computation::statistic::Description<Matrix<DATA_TYPE, HEIGHT, 1>> describe_rows(size_t ddof = 0) const;
+
         /** \} */
 
         /** @name Arithmetic Operations
@@ -461,6 +540,16 @@ namespace ml::data_structure::matrix
          */
         const data_array_t& data() const;
 
+        /** @brief Get a view of the matrix allowing modifications, without copy
+         ** @return The view, valid until the matrix is destroyed or reshaped
+         */
+        MatrixView<DATA_TYPE> view();
+
+        /** @brief Get a read-only view of the matrix, without copy
+         ** @return The view, valid until the matrix is destroyed or reshaped
+         */
+        MatrixView<const DATA_TYPE> view() const;
+
         /** @brief Access an element in the matrix in the frame of broadcasting
          ** @param height_index The height index of the element
          ** @param width_index The width index of the element
@@ -512,6 +601,44 @@ namespace ml::data_structure::matrix
     Matrix<DATA_TYPE, HEIGHT, WIDTH> sort_columns(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix,
                                                   const Compare& compare = Compare());
 
+    /** @brief Sort the rows of a matrix by the values of one of its columns
+     ** @param matrix The matrix to sort
+     ** @param column_index The index of the column to sort by
+     ** @param compare The compare function, std::less by default
+     ** @return The new sorted matrix
+     */
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH, class Compare = std::less<DATA_TYPE>>
+    Matrix<DATA_TYPE, HEIGHT, WIDTH> sort_rows_by_column(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix,
+                                                         size_t column_index,
+                                                         const Compare& compare = Compare());
+
+    /** @brief Compute the indexes that sort a matrix as it was a flat array
+     ** @param matrix The matrix
+     ** @param compare The compare function, std::less by default
+     ** @return The flat indexes of the elements in their sorted order
+     */
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH, class Compare = std::less<DATA_TYPE>>
+    Matrix<size_t, HEIGHT, WIDTH> argsort(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix,
+                                          const Compare& compare = Compare());
+
+    /** @brief Compute the indexes that sort each row of a matrix
+     ** @param matrix The matrix
+     ** @param compare The compare function, std::less by default
+     ** @return The column indexes of the elements of each row in their sorted order
+     */
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH, class Compare = std::less<DATA_TYPE>>
+    Matrix<size_t, HEIGHT, WIDTH> argsort_rows(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix,
+                                               const Compare& compare = Compare());
+
+    /** @brief Compute the indexes that sort each column of a matrix
+     ** @param matrix The matrix
+     ** @param compare The compare function, std::less by default
+     ** @return The row indexes of the elements of each column in their sorted order
+     */
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH, class Compare = std::less<DATA_TYPE>>
+    Matrix<size_t, HEIGHT, WIDTH> argsort_columns(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix,
+                                                  const Compare& compare = Compare());
+
     /** @brief Transpose a matrix
      ** @param matrix The matrix
      ** @return The new transposed matrix
@@ -570,6 +697,14 @@ namespace ml::data_structure::matrix
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     DATA_TYPE sum(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix);
 
+    /** @brief Sum of all the element in a matrix, the chunks being reduced in parallel
+     ** @param matrix The matrix
+     ** @param execution How the work is split
+     ** @return The sum
+     */
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    DATA_TYPE sum(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix, ml::computation::statistic::Execution execution);
+
     /** @brief Sum of all the columns of a matrix
      ** @param matrix The matrix
      ** @return The row matrix containing the sums
@@ -633,6 +768,14 @@ namespace ml::data_structure::matrix
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     DATA_TYPE mean(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix);
 
+    /** @brief Mean of all the element in a matrix, the chunks being reduced in parallel
+     ** @param matrix The matrix
+     ** @param execution How the work is split
+     ** @return The mean
+     */
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    DATA_TYPE mean(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix, ml::computation::statistic::Execution execution);
+
     /** @brief Mean of all the columns of a matrix
      ** @param matrix The matrix
      ** @return The row matrix containing the means
@@ -676,6 +819,17 @@ namespace ml::data_structure::matrix
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     DATA_TYPE variance(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix, size_t ddof = 0);
 
+    /** @brief Variance of all the element in a matrix, the chunks being reduced in parallel
+     ** @param matrix The matrix
+     ** @param ddof The divisor used in the calculation is N - ddof
+     ** @param execution How the work is split
+     ** @return The variance
+     */
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    DATA_TYPE variance(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix,
+                       size_t ddof,
+                       ml::computation::statistic::Execution execution);
+
     /** @brief Variance of all the columns of a matrix
      ** @param matrix The matrix
      ** @param ddof The divisor used in the calculation is N - ddof, 0 by default
@@ -700,6 +854,17 @@ namespace ml::data_structure::matrix
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     DATA_TYPE standard_deviation(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix, size_t ddof = 0);
 
+    /** @brief Standard deviation of all the element in a matrix, the chunks being reduced in parallel
+     ** @param matrix The matrix
+     ** @param ddof The divisor used in the calculation is N - ddof
+     ** @param execution How the work is split
+     ** @return The standard deviation
+     */
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    DATA_TYPE standard_deviation(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix,
+                                 size_t ddof,
+                                 ml::computation::statistic::Execution execution);
+
     /** @brief Standard deviation of all the columns of a matrix
      ** @param matrix The matrix
      ** @param ddof The divisor used in the calculation is N - ddof, 0 by default
@@ -760,6 +925,34 @@ namespace ml::data_structure::matrix
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     Matrix<DATA_TYPE, HEIGHT, 1> peak_to_peak_rows(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix);
 
+    /** @brief Sum, min, max, mean, variance, standard deviation and peak to peak of all the element in a matrix,
+     ** computed in one pass
+     ** @param matrix The matrix
+     ** @param ddof The divisor used in the calculation of the variance is N - ddof, 0 by default
+     ** @return The statistics
+     */
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    ml::computation::statistic::Description<DATA_TYPE> describe(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix,
+                                                                size_t ddof = 0);
+
+    /** @brief Statistics of describe of all the columns of a matrix, computed in one sweep over the rows
+     ** @param matrix The matrix
+     ** @param ddof The divisor used in the calculation of the variance is N - ddof, 0 by default
+     ** @return The row matrices containing the statistics
+     */
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    ml::computation::statistic::Description<Matrix<DATA_TYPE, 1, WIDTH>>
+    describe_columns(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix, size_t ddof = 0);
+
+    /** @brief Statistics of describe of all the rows of a matrix
+     ** @param matrix The matrix
+     ** @param ddof The divisor used in the calculation of the variance is N - ddof, 0 by default
+     ** @return The column matrices containing the statistics
+     */
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    ml::computation::statistic::Description<Matrix<DATA_TYPE, HEIGHT, 1>>
+    describe_rows(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix, size_t ddof = 0);
+
     /** @brief Negate a matrix
      ** @param matrix The matrix
      ** @return The new matrix containing the result of the operation
@@ -865,74 +1058,6 @@ namespace ml::data_structure::matrix
     template <typename DATA_TYPE, size_t M, size_t N, size_t P>
     Matrix<DATA_TYPE, M, P> multiplies_matrix(const Matrix<DATA_TYPE, M, N>& lhs, const Matrix<DATA_TYPE, N, P>& rhs);
 
-    /** @brief Negate a matrix
-     ** @param matrix The matrix
-     ** @return The new matrix containing the result of the operation
-     */
-    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
-    Matrix<DATA_TYPE, HEIGHT, WIDTH> operator-(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix);
-
-    /** @brief Compute a classic matrix addition, broadcasting implemented
-     ** @param lhs The matrix at the left of the operator
-     ** @param rhs The matrix at the right of the operator
-     ** @return The new matrix containing the result of the operation
-     */
-    template <typename DATA_TYPE, size_t HEIGHT_1, size_t HEIGHT_2, size_t WIDTH_1, size_t WIDTH_2>
-    Matrix<DATA_TYPE, MAX(HEIGHT_1, HEIGHT_2), MAX(WIDTH_1, WIDTH_2)>
-    operator+(const Matrix<DATA_TYPE, HEIGHT_1, WIDTH_1>& lhs, const Matrix<DATA_TYPE, HEIGHT_2, WIDTH_2>& rhs);
-
-    /** @brief Compute a classic matrix subtraction, broadcasting implemented
-     ** @param lhs The matrix at the left of the operator
-     ** @param rhs The matrix at the right of the operator
-     ** @return The new matrix containing the result of the operation
-     */
-    template <typename DATA_TYPE, size_t HEIGHT_1, size_t HEIGHT_2, size_t WIDTH_1, size_t WIDTH_2>
-    Matrix<DATA_TYPE, MAX(HEIGHT_1, HEIGHT_2), MAX(WIDTH_1, WIDTH_2)>
-    operator-(const Matrix<DATA_TYPE, HEIGHT_1, WIDTH_1>& lhs, const Matrix<DATA_TYPE, HEIGHT_2, WIDTH_2>& rhs);
-
-    /** @brief Compute an element-wise multiplication, broadcasting implemented
-     ** @param lhs The matrix at the left of the operator
-     ** @param rhs The matrix at the right of the operator
-     ** @return The new matrix containing the result of the operation
-     */
-    template <typename DATA_TYPE, size_t HEIGHT_1, size_t HEIGHT_2, size_t WIDTH_1, size_t WIDTH_2>
-    Matrix<DATA_TYPE, MAX(HEIGHT_1, HEIGHT_2), MAX(WIDTH_1, WIDTH_2)>
-    operator*(const Matrix<DATA_TYPE, HEIGHT_1, WIDTH_1>& lhs, const Matrix<DATA_TYPE, HEIGHT_2, WIDTH_2>& rhs);
-
-    /** @brief Compute an element-wise division, broadcasting implemented
-     ** @param lhs The matrix at the left of the operator
-     ** @param rhs The matrix at the right of the operator
-     ** @return The new matrix containing the result of the operation
-     */
-    template <typename DATA_TYPE, size_t HEIGHT_1, size_t HEIGHT_2, size_t WIDTH_1, size_t WIDTH_2>
-    Matrix<DATA_TYPE, MAX(HEIGHT_1, HEIGHT_2), MAX(WIDTH_1, WIDTH_2)>
-    operator/(const Matrix<DATA_TYPE, HEIGHT_1, WIDTH_1>& lhs, const Matrix<DATA_TYPE, HEIGHT_2, WIDTH_2>& rhs);
-
-    /** @brief Compute an element-wise modulus, broadcasting implemented
-     ** @param lhs The matrix at the left of the operator
-     ** @param rhs The matrix at the right of the operator
-     ** @return The new matrix containing the result of the operation
-     */
-    template <typename DATA_TYPE, size_t HEIGHT_1, size_t HEIGHT_2, size_t WIDTH_1, size_t WIDTH_2>
-    Matrix<DATA_TYPE, MAX(HEIGHT_1, HEIGHT_2), MAX(WIDTH_1, WIDTH_2)>
-    operator%(const Matrix<DATA_TYPE, HEIGHT_1, WIDTH_1>& lhs, const Matrix<DATA_TYPE, HEIGHT_2, WIDTH_2>& rhs);
-
-    /** @brief Multiplication of each element of a matrix with a scalar
-     ** @param matrix The matrix
-     ** @param scalar The scalar
-     ** @return The new matrix containing the result of the operation
-     */
-    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
-    Matrix<DATA_TYPE, HEIGHT, WIDTH> operator*(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix, const DATA_TYPE& scalar);
-
-    /** @brief Division of each element of a matrix with a scalar
-     ** @param matrix The matrix
-     ** @param scalar The scalar
-     ** @return The new matrix containing the result of the operation
-     */
-    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
-    Matrix<DATA_TYPE, HEIGHT, WIDTH> operator/(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix, const DATA_TYPE& scalar);
-
     /** @brief Compare matrix, check element by element if the matrix are equals
      ** @param lhs The first matrix
      ** @param rhs The second matrix
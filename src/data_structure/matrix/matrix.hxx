@@ -20,6 +20,24 @@ namespace ml::data_structure::matrix
         : data_(data)
     {}
 
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    template <class Expression, typename>
+    Matrix<DATA_TYPE, HEIGHT, WIDTH>::Matrix(const Expression& expression)
+    {
+        *this = expression;
+    }
+
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    template <class Expression, typename>
+    inline Matrix<DATA_TYPE, HEIGHT, WIDTH>& Matrix<DATA_TYPE, HEIGHT, WIDTH>::operator=(const Expression& expression)
+    {
+        static_assert(std::is_same_v<typename Expression::matrix_t, Matrix<DATA_TYPE, HEIGHT, WIDTH>>,
+                      "The expression does not evaluate to this matrix type");
+
+        evaluate_expression(*this, expression);
+        return *this;
+    }
+
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     inline DATA_TYPE& Matrix<DATA_TYPE, HEIGHT, WIDTH>::operator()(size_t height_index, size_t width_index)
     {
@@ -66,6 +84,18 @@ namespace ml::data_structure::matrix
         return this->data_;
     }
 
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    inline MatrixView<DATA_TYPE> Matrix<DATA_TYPE, HEIGHT, WIDTH>::view()
+    {
+        return MatrixView<DATA_TYPE>(data_.data(), HEIGHT, WIDTH, WIDTH, 1);
+    }
+
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    inline MatrixView<const DATA_TYPE> Matrix<DATA_TYPE, HEIGHT, WIDTH>::view() const
+    {
+        return MatrixView<const DATA_TYPE>(data_.data(), HEIGHT, WIDTH, WIDTH, 1);
+    }
+
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     inline const DATA_TYPE& Matrix<DATA_TYPE, HEIGHT, WIDTH>::get_broadcast_value(size_t height_index,
                                                                                   size_t width_index) const
@@ -3,14 +3,21 @@
  ** @brief Apply implementations for ml::data_structure::matrix::Matrix
  */
 
+#include "computation/simd.hh"
+
 namespace ml::data_structure::matrix
 {
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     template <class Function>
     Matrix<DATA_TYPE, HEIGHT, WIDTH>& Matrix<DATA_TYPE, HEIGHT, WIDTH>::apply(const Function& function)
     {
-        for (auto& element : this->data_)
-            element = function(element);
+        auto* data = this->data_.data();
+        const size_t size = this->data_.size();
+
+        ml::computation::simd::dispatch([&]() {
+            for (size_t i = 0; i < size; i++)
+                data[i] = function(data[i]);
+        });
 
         return *this;
     }
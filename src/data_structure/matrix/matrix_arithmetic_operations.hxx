@@ -3,6 +3,8 @@
  ** @brief Arithmetic operations implementations for ml::data_structure::matrix::Matrix
  */
 
+#include "computation/broadcast.hh"
+
 namespace ml::data_structure::matrix
 {
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH, class Operation>
@@ -11,8 +13,14 @@ namespace ml::data_structure::matrix
                                   const Matrix<DATA_TYPE, HEIGHT, WIDTH>& rhs,
                                   const Operation& operation)
     {
-        for (size_t i = 0; i < lhs.data().size(); i++)
-            operation(lhs.data()[i], rhs.data()[i]);
+        ml::computation::broadcast::apply(lhs.data().data(),
+                                          lhs.get_height(),
+                                          lhs.get_width(),
+                                          rhs.data().data(),
+                                          rhs.get_height(),
+                                          rhs.get_width(),
+                                          lhs.data().data(),
+                                          operation);
 
         return lhs;
     }
@@ -37,11 +45,14 @@ namespace ml::data_structure::matrix
         {
             Matrix<DATA_TYPE, matrix_result_height, matrix_result_width> matrix_result;
 
-            for (size_t i = 0; i < matrix_result_height; i++)
-            {
-                for (size_t j = 0; j < matrix_result_width; j++)
-                    matrix_result(i, j) = operation(lhs.get_broadcast_value(i, j), rhs.get_broadcast_value(i, j));
-            }
+            ml::computation::broadcast::apply(lhs.data().data(),
+                                              HEIGHT_1,
+                                              WIDTH_1,
+                                              rhs.data().data(),
+                                              HEIGHT_2,
+                                              WIDTH_2,
+                                              matrix_result.data().data(),
+                                              operation);
 
             return matrix_result;
         }
@@ -53,8 +64,14 @@ namespace ml::data_structure::matrix
                                          const DATA_TYPE& scalar,
                                          const Operation& operation)
     {
-        for (auto& element : matrix.data())
-            operation(element, scalar);
+        ml::computation::broadcast::apply(matrix.data().data(),
+                                          matrix.get_height(),
+                                          matrix.get_width(),
+                                          &scalar,
+                                          1,
+                                          1,
+                                          matrix.data().data(),
+                                          operation);
 
         return matrix;
     }
@@ -76,18 +93,11 @@ namespace ml::data_structure::matrix
         return matrix_result;
     }
 
-    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
-    inline Matrix<DATA_TYPE, HEIGHT, WIDTH> operator-(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix)
-    {
-        return ml::data_structure::matrix::negate(matrix);
-    }
-
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     inline Matrix<DATA_TYPE, HEIGHT, WIDTH>&
     Matrix<DATA_TYPE, HEIGHT, WIDTH>::plus(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& rhs)
     {
-        return arithmetic_operation_in_place(
-            *this, rhs, [](DATA_TYPE& lhs, const DATA_TYPE& rhs) { return lhs += rhs; });
+        return arithmetic_operation_in_place(*this, rhs, std::plus<>{});
     }
 
     template <typename DATA_TYPE, size_t HEIGHT_1, size_t HEIGHT_2, size_t WIDTH_1, size_t WIDTH_2>
@@ -104,19 +114,11 @@ namespace ml::data_structure::matrix
         return this->plus(rhs);
     }
 
-    template <typename DATA_TYPE, size_t HEIGHT_1, size_t HEIGHT_2, size_t WIDTH_1, size_t WIDTH_2>
-    inline Matrix<DATA_TYPE, MAX(HEIGHT_1, HEIGHT_2), MAX(WIDTH_1, WIDTH_2)>
-    operator+(const Matrix<DATA_TYPE, HEIGHT_1, WIDTH_1>& lhs, const Matrix<DATA_TYPE, HEIGHT_2, WIDTH_2>& rhs)
-    {
-        return ml::data_structure::matrix::plus(lhs, rhs);
-    }
-
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     inline Matrix<DATA_TYPE, HEIGHT, WIDTH>&
     Matrix<DATA_TYPE, HEIGHT, WIDTH>::minus(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& rhs)
     {
-        return arithmetic_operation_in_place(
-            *this, rhs, [](DATA_TYPE& lhs, const DATA_TYPE& rhs) { return lhs -= rhs; });
+        return arithmetic_operation_in_place(*this, rhs, std::minus<>{});
     }
 
     template <typename DATA_TYPE, size_t HEIGHT_1, size_t HEIGHT_2, size_t WIDTH_1, size_t WIDTH_2>
@@ -133,18 +135,11 @@ namespace ml::data_structure::matrix
         return this->minus(rhs);
     }
 
-    template <typename DATA_TYPE, size_t HEIGHT_1, size_t HEIGHT_2, size_t WIDTH_1, size_t WIDTH_2>
-    inline Matrix<DATA_TYPE, MAX(HEIGHT_1, HEIGHT_2), MAX(WIDTH_1, WIDTH_2)>
-    operator-(const Matrix<DATA_TYPE, HEIGHT_1, WIDTH_1>& lhs, const Matrix<DATA_TYPE, HEIGHT_2, WIDTH_2>& rhs)
-    {
-        return ml::data_structure::matrix::minus(lhs, rhs);
-    }
-
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     inline Matrix<DATA_TYPE, HEIGHT, WIDTH>&
     Matrix<DATA_TYPE, HEIGHT, WIDTH>::multiplies(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& rhs)
     {
-        return arithmetic_operation_in_place(*this, rhs, [](DATA_TYPE& lhs, const DATA_TYPE& rhs) { return lhs *= rhs; });
+        return arithmetic_operation_in_place(*this, rhs, std::multiplies<>{});
     }
 
     template <typename DATA_TYPE, size_t HEIGHT_1, size_t HEIGHT_2, size_t WIDTH_1, size_t WIDTH_2>
@@ -161,19 +156,11 @@ namespace ml::data_structure::matrix
         return this->multiplies(rhs);
     }
 
-    template <typename DATA_TYPE, size_t HEIGHT_1, size_t HEIGHT_2, size_t WIDTH_1, size_t WIDTH_2>
-    inline Matrix<DATA_TYPE, MAX(HEIGHT_1, HEIGHT_2), MAX(WIDTH_1, WIDTH_2)>
-    operator*(const Matrix<DATA_TYPE, HEIGHT_1, WIDTH_1>& lhs, const Matrix<DATA_TYPE, HEIGHT_2, WIDTH_2>& rhs)
-    {
-        return ml::data_structure::matrix::multiplies(lhs, rhs);
-    }
-
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     inline Matrix<DATA_TYPE, HEIGHT, WIDTH>&
     Matrix<DATA_TYPE, HEIGHT, WIDTH>::divides(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& rhs)
     {
-        return arithmetic_operation_in_place(
-            *this, rhs, [](DATA_TYPE& lhs, const DATA_TYPE& rhs) { return lhs /= rhs; });
+        return arithmetic_operation_in_place(*this, rhs, std::divides<>{});
     }
 
     template <typename DATA_TYPE, size_t HEIGHT_1, size_t HEIGHT_2, size_t WIDTH_1, size_t WIDTH_2>
@@ -190,19 +177,11 @@ namespace ml::data_structure::matrix
         return this->divides(rhs);
     }
 
-    template <typename DATA_TYPE, size_t HEIGHT_1, size_t HEIGHT_2, size_t WIDTH_1, size_t WIDTH_2>
-    inline Matrix<DATA_TYPE, MAX(HEIGHT_1, HEIGHT_2), MAX(WIDTH_1, WIDTH_2)>
-    operator/(const Matrix<DATA_TYPE, HEIGHT_1, WIDTH_1>& lhs, const Matrix<DATA_TYPE, HEIGHT_2, WIDTH_2>& rhs)
-    {
-        return ml::data_structure::matrix::divides(lhs, rhs);
-    }
-
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     inline Matrix<DATA_TYPE, HEIGHT, WIDTH>&
     Matrix<DATA_TYPE, HEIGHT, WIDTH>::modulus(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& rhs)
     {
-        return arithmetic_operation_in_place(
-            *this, rhs, [](DATA_TYPE& lhs, const DATA_TYPE& rhs) { return lhs %= rhs; });
+        return arithmetic_operation_in_place(*this, rhs, std::modulus<>{});
     }
 
     template <typename DATA_TYPE, size_t HEIGHT_1, size_t HEIGHT_2, size_t WIDTH_1, size_t WIDTH_2>
@@ -219,18 +198,10 @@ namespace ml::data_structure::matrix
         return this->modulus(rhs);
     }
 
-    template <typename DATA_TYPE, size_t HEIGHT_1, size_t HEIGHT_2, size_t WIDTH_1, size_t WIDTH_2>
-    inline Matrix<DATA_TYPE, MAX(HEIGHT_1, HEIGHT_2), MAX(WIDTH_1, WIDTH_2)>
-    operator%(const Matrix<DATA_TYPE, HEIGHT_1, WIDTH_1>& lhs, const Matrix<DATA_TYPE, HEIGHT_2, WIDTH_2>& rhs)
-    {
-        return ml::data_structure::matrix::modulus(lhs, rhs);
-    }
-
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     inline Matrix<DATA_TYPE, HEIGHT, WIDTH>& Matrix<DATA_TYPE, HEIGHT, WIDTH>::plus_scalar(const DATA_TYPE& scalar)
     {
-        return arithmetic_scalar_operation_in_place(
-            *this, scalar, [](DATA_TYPE& element, const DATA_TYPE& scalar) { return element += scalar; });
+        return arithmetic_scalar_operation_in_place(*this, scalar, std::plus<>{});
     }
 
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
@@ -248,18 +219,10 @@ namespace ml::data_structure::matrix
         return this->plus_scalar(scalar);
     }
 
-    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
-    inline Matrix<DATA_TYPE, HEIGHT, WIDTH> operator+(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix,
-                                                      const DATA_TYPE& scalar)
-    {
-        return ml::data_structure::matrix::plus_scalar(matrix, scalar);
-    }
-
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     inline Matrix<DATA_TYPE, HEIGHT, WIDTH>& Matrix<DATA_TYPE, HEIGHT, WIDTH>::minus_scalar(const DATA_TYPE& scalar)
     {
-        return arithmetic_scalar_operation_in_place(
-            *this, scalar, [](DATA_TYPE& element, const DATA_TYPE& scalar) { return element -= scalar; });
+        return arithmetic_scalar_operation_in_place(*this, scalar, std::minus<>{});
     }
 
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
@@ -277,19 +240,11 @@ namespace ml::data_structure::matrix
         return this->minus_scalar(scalar);
     }
 
-    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
-    inline Matrix<DATA_TYPE, HEIGHT, WIDTH> operator-(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix,
-                                                      const DATA_TYPE& scalar)
-    {
-        return ml::data_structure::matrix::minus_scalar(matrix, scalar);
-    }
-
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     inline Matrix<DATA_TYPE, HEIGHT, WIDTH>&
     Matrix<DATA_TYPE, HEIGHT, WIDTH>::multiplies_scalar(const DATA_TYPE& scalar)
     {
-        return arithmetic_scalar_operation_in_place(
-            *this, scalar, [](DATA_TYPE& element, const DATA_TYPE& scalar) { return element *= scalar; });
+        return arithmetic_scalar_operation_in_place(*this, scalar, std::multiplies<>{});
     }
 
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
@@ -307,18 +262,10 @@ namespace ml::data_structure::matrix
         return this->multiplies_scalar(scalar);
     }
 
-    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
-    inline Matrix<DATA_TYPE, HEIGHT, WIDTH> operator*(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix,
-                                                      const DATA_TYPE& scalar)
-    {
-        return ml::data_structure::matrix::multiplies_scalar(matrix, scalar);
-    }
-
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     inline Matrix<DATA_TYPE, HEIGHT, WIDTH>& Matrix<DATA_TYPE, HEIGHT, WIDTH>::divides_scalar(const DATA_TYPE& scalar)
     {
-        return arithmetic_scalar_operation_in_place(
-            *this, scalar, [](DATA_TYPE& element, const DATA_TYPE& scalar) { return element /= scalar; });
+        return arithmetic_scalar_operation_in_place(*this, scalar, std::divides<>{});
     }
 
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
@@ -336,18 +283,10 @@ namespace ml::data_structure::matrix
         return this->divides_scalar(scalar);
     }
 
-    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
-    inline Matrix<DATA_TYPE, HEIGHT, WIDTH> operator/(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix,
-                                                      const DATA_TYPE& scalar)
-    {
-        return ml::data_structure::matrix::divides_scalar(matrix, scalar);
-    }
-
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     inline Matrix<DATA_TYPE, HEIGHT, WIDTH>& Matrix<DATA_TYPE, HEIGHT, WIDTH>::modulus_scalar(const DATA_TYPE& scalar)
     {
-        return arithmetic_scalar_operation_in_place(
-            *this, scalar, [](DATA_TYPE& element, const DATA_TYPE& scalar) { return element %= scalar; });
+        return arithmetic_scalar_operation_in_place(*this, scalar, std::modulus<>{});
     }
 
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
@@ -364,11 +303,4 @@ namespace ml::data_structure::matrix
     {
         return this->modulus_scalar(scalar);
     }
-
-    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
-    inline Matrix<DATA_TYPE, HEIGHT, WIDTH> operator%(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix,
-                                                      const DATA_TYPE& scalar)
-    {
-        return ml::data_structure::matrix::modulus_scalar(matrix, scalar);
-    }
 } // namespace ml::data_structure::matrix
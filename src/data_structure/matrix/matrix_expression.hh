@@ -0,0 +1,535 @@
+/**
+ ** @file src/data_structure/matrix/matrix_expression.hh
+ ** @brief Declaration of the lazy element-wise expressions of ml::data_structure::matrix
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+namespace ml::data_structure::matrix
+{
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    class Matrix;
+
+    template <typename DATA_TYPE>
+    class DynamicMatrix;
+
+    template <typename DATA_TYPE>
+    class MatrixView;
+
+    template <class Operation, class LHS, class RHS>
+    class BinaryExpression;
+
+    template <class Operation, class Expression>
+    class ScalarExpression;
+
+    template <class Operation, class Expression>
+    class UnaryExpression;
+
+    /** @brief Describe the operands of the element-wise expressions, empty for the other types
+     ** @details data_type_t is the type of the elements, matrix_t the matrix an expression evaluates to and operand_t
+     ** the way an expression holds the operand when it is an lvalue: matrices by reference, expressions by value so
+     ** that a whole expression can outlive the temporary nodes it is built from
+     */
+    template <class T>
+    struct matrix_expression_traits
+    {};
+
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    struct matrix_expression_traits<Matrix<DATA_TYPE, HEIGHT, WIDTH>>
+    {
+        using data_type_t = DATA_TYPE;
+        using matrix_t = Matrix<DATA_TYPE, HEIGHT, WIDTH>;
+        using operand_t = const matrix_t&;
+    };
+
+    template <typename DATA_TYPE>
+    struct matrix_expression_traits<DynamicMatrix<DATA_TYPE>>
+    {
+        using data_type_t = DATA_TYPE;
+        using matrix_t = DynamicMatrix<DATA_TYPE>;
+        using operand_t = const matrix_t&;
+    };
+
+    template <typename DATA_TYPE>
+    struct matrix_expression_traits<MatrixView<DATA_TYPE>>
+    {
+        using data_type_t = std::remove_const_t<DATA_TYPE>;
+        using matrix_t = DynamicMatrix<data_type_t>;
+        using operand_t = const MatrixView<DATA_TYPE>;
+    };
+
+    /// Type of the matrix resulting of the broadcasting of two matrix types
+    template <class LHS_MATRIX, class RHS_MATRIX>
+    struct broadcast_matrix;
+
+    template <typename DATA_TYPE, size_t HEIGHT_1, size_t HEIGHT_2, size_t WIDTH_1, size_t WIDTH_2>
+    struct broadcast_matrix<Matrix<DATA_TYPE, HEIGHT_1, WIDTH_1>, Matrix<DATA_TYPE, HEIGHT_2, WIDTH_2>>
+    {
+        using type =
+            Matrix<DATA_TYPE, (HEIGHT_1 > HEIGHT_2 ? HEIGHT_1 : HEIGHT_2), (WIDTH_1 > WIDTH_2 ? WIDTH_1 : WIDTH_2)>;
+    };
+
+    template <typename DATA_TYPE>
+    struct broadcast_matrix<DynamicMatrix<DATA_TYPE>, DynamicMatrix<DATA_TYPE>>
+    {
+        using type = DynamicMatrix<DATA_TYPE>;
+    };
+
+    /// True if the shape of the matrix type is only known at runtime
+    template <class MATRIX>
+    struct is_dynamic_matrix : std::false_type
+    {};
+
+    template <typename DATA_TYPE>
+    struct is_dynamic_matrix<DynamicMatrix<DATA_TYPE>> : std::true_type
+    {};
+
+    template <class Operation, class LHS, class RHS>
+    struct matrix_expression_traits<BinaryExpression<Operation, LHS, RHS>>
+    {
+        using data_type_t = typename matrix_expression_traits<std::decay_t<LHS>>::data_type_t;
+        using matrix_t =
+            typename broadcast_matrix<typename matrix_expression_traits<std::decay_t<LHS>>::matrix_t,
+                                      typename matrix_expression_traits<std::decay_t<RHS>>::matrix_t>::type;
+        using operand_t = const BinaryExpression<Operation, LHS, RHS>;
+    };
+
+    template <class Operation, class Expression>
+    struct matrix_expression_traits<ScalarExpression<Operation, Expression>>
+    {
+        using data_type_t = typename matrix_expression_traits<std::decay_t<Expression>>::data_type_t;
+        using matrix_t = typename matrix_expression_traits<std::decay_t<Expression>>::matrix_t;
+        using operand_t = const ScalarExpression<Operation, Expression>;
+    };
+
+    template <class Operation, class Expression>
+    struct matrix_expression_traits<UnaryExpression<Operation, Expression>>
+    {
+        using data_type_t = typename matrix_expression_traits<std::decay_t<Expression>>::data_type_t;
+        using matrix_t = typename matrix_expression_traits<std::decay_t<Expression>>::matrix_t;
+        using operand_t = const UnaryExpression<Operation, Expression>;
+    };
+
+    /// True if T is a matrix or a lazy expression of matrices
+    template <class T, class = void>
+    struct is_matrix_expression : std::false_type
+    {};
+
+    template <class T>
+    struct is_matrix_expression<T, std::void_t<typename matrix_expression_traits<T>::data_type_t>> : std::true_type
+    {};
+
+    template <class T>
+    constexpr bool is_matrix_expression_v = is_matrix_expression<T>::value;
+
+    /// True if T is a lazy expression of matrices, but not a matrix itself
+    template <class T, class = void>
+    struct is_lazy_matrix_expression : std::false_type
+    {};
+
+    template <class T>
+    struct is_lazy_matrix_expression<T, std::void_t<typename matrix_expression_traits<T>::matrix_t>>
+        : std::bool_constant<!std::is_same_v<T, typename matrix_expression_traits<T>::matrix_t>>
+    {};
+
+    template <class T>
+    constexpr bool is_lazy_matrix_expression_v = is_lazy_matrix_expression<T>::value;
+
+    /** @brief Type of an operand in the template arguments of an expression, from the type an operator deduced for it
+     ** @details An lvalue gives a const reference, an rvalue its plain type
+     */
+    template <class T>
+    using expression_argument_t =
+        std::conditional_t<std::is_lvalue_reference_v<T>, const std::decay_t<T>&, std::decay_t<T>>;
+
+    /** @brief Type an expression holds an operand with, from its template argument
+     ** @details An lvalue is held as its operand_t, an rvalue is moved into the expression: a node built on a
+     ** temporary matrix owns it, so the expression can outlive the full-expression that created it
+     */
+    template <class T>
+    using expression_operand_t = std::conditional_t<std::is_lvalue_reference_v<T>,
+                                                    typename matrix_expression_traits<std::decay_t<T>>::operand_t,
+                                                    std::decay_t<T>>;
+
+    /** @brief Lazy element-wise operation between two expressions, broadcasting implemented
+     ** @details LHS and RHS are expression_argument_t: a const reference for an lvalue operand, the type itself for an
+     ** rvalue one, which the expression then owns
+     */
+    template <class Operation, class LHS, class RHS>
+    class BinaryExpression
+    {
+    public:
+        /// The type of the elements
+        using data_type_t = typename matrix_expression_traits<BinaryExpression>::data_type_t;
+        /// The type of the matrix the expression evaluates to
+        using matrix_t = typename matrix_expression_traits<BinaryExpression>::matrix_t;
+
+        /** @brief Instantiate a new expression
+         ** @param lhs The expression at the left of the operator
+         ** @param rhs The expression at the right of the operator
+         ** @param operation The element-wise operation
+         */
+        BinaryExpression(LHS&& lhs, RHS&& rhs, const Operation& operation = Operation());
+
+        /** @brief Compute an element of the expression without bound checking
+         ** @param height_index The height index of the element
+         ** @param width_index The width index of the element
+         ** @return The element
+         */
+        data_type_t operator()(size_t height_index, size_t width_index) const;
+
+        /** @brief Compute an element of the expression in the frame of broadcasting
+         ** @param height_index The height index of the element
+         ** @param width_index The width index of the element
+         ** @return The element
+         */
+        data_type_t get_broadcast_value(size_t height_index, size_t width_index) const;
+
+        /** @brief Compute an element from its index in the row-major data, valid when no operand is broadcast
+         ** @param index The index of the element
+         ** @return The element
+         */
+        data_type_t get_flat_value(size_t index) const;
+
+        /** @brief Check if an operand of the expression, at any depth, is broadcast
+         ** @return True if at least one operand does not have the shape of its parent expression
+         */
+        bool is_broadcasting() const;
+
+        /** @brief Check if a view read by the expression, at any depth, overlaps a memory range
+         ** @param begin The first element of the range
+         ** @param end The element after the last element of the range
+         ** @return True if at least one view operand reads an element of the range
+         */
+        bool is_aliasing(const data_type_t* begin, const data_type_t* end) const;
+
+        /** @brief Get the height of the expression
+         ** @return The height of the expression
+         */
+        size_t get_height() const;
+
+        /** @brief Get the width of the expression
+         ** @return The width of the expression
+         */
+        size_t get_width() const;
+
+        /** @brief Compute every element of the expression in one pass
+         ** @return The new matrix containing the result of the expression
+         */
+        matrix_t evaluate() const;
+
+    private:
+        /// The expression at the left of the operator
+        expression_operand_t<LHS> lhs_;
+        /// The expression at the right of the operator
+        expression_operand_t<RHS> rhs_;
+        /// The element-wise operation
+        Operation operation_;
+        /// The height of the broadcast result
+        size_t height_;
+        /// The width of the broadcast result
+        size_t width_;
+    };
+
+    /// Lazy element-wise operation between an expression and a scalar, Expression is an expression_argument_t
+    template <class Operation, class Expression>
+    class ScalarExpression
+    {
+    public:
+        /// The type of the elements
+        using data_type_t = typename matrix_expression_traits<ScalarExpression>::data_type_t;
+        /// The type of the matrix the expression evaluates to
+        using matrix_t = typename matrix_expression_traits<ScalarExpression>::matrix_t;
+
+        /** @brief Instantiate a new expression
+         ** @param expression The expression at the left of the operator
+         ** @param scalar The scalar at the right of the operator, copied
+         ** @param operation The element-wise operation
+         */
+        ScalarExpression(Expression&& expression, const data_type_t& scalar, const Operation& operation = Operation());
+
+        /** @brief Compute an element of the expression without bound checking
+         ** @param height_index The height index of the element
+         ** @param width_index The width index of the element
+         ** @return The element
+         */
+        data_type_t operator()(size_t height_index, size_t width_index) const;
+
+        /** @brief Compute an element of the expression in the frame of broadcasting
+         ** @param height_index The height index of the element
+         ** @param width_index The width index of the element
+         ** @return The element
+         */
+        data_type_t get_broadcast_value(size_t height_index, size_t width_index) const;
+
+        /** @brief Compute an element from its index in the row-major data, valid when no operand is broadcast
+         ** @param index The index of the element
+         ** @return The element
+         */
+        data_type_t get_flat_value(size_t index) const;
+
+        /** @brief Check if an operand of the expression, at any depth, is broadcast
+         ** @return True if at least one operand does not have the shape of its parent expression
+         */
+        bool is_broadcasting() const;
+
+        /** @brief Check if a view read by the expression, at any depth, overlaps a memory range
+         ** @param begin The first element of the range
+         ** @param end The element after the last element of the range
+         ** @return True if at least one view operand reads an element of the range
+         */
+        bool is_aliasing(const data_type_t* begin, const data_type_t* end) const;
+
+        /** @brief Get the height of the expression
+         ** @return The height of the expression
+         */
+        size_t get_height() const;
+
+        /** @brief Get the width of the expression
+         ** @return The width of the expression
+         */
+        size_t get_width() const;
+
+        /** @brief Compute every element of the expression in one pass
+         ** @return The new matrix containing the result of the expression
+         */
+        matrix_t evaluate() const;
+
+    private:
+        /// The expression at the left of the operator
+        expression_operand_t<Expression> expression_;
+        /// The scalar at the right of the operator
+        data_type_t scalar_;
+        /// The element-wise operation
+        Operation operation_;
+    };
+
+    /// Lazy element-wise operation on one expression, Expression is an expression_argument_t
+    template <class Operation, class Expression>
+    class UnaryExpression
+    {
+    public:
+        /// The type of the elements
+        using data_type_t = typename matrix_expression_traits<UnaryExpression>::data_type_t;
+        /// The type of the matrix the expression evaluates to
+        using matrix_t = typename matrix_expression_traits<UnaryExpression>::matrix_t;
+
+        /** @brief Instantiate a new expression
+         ** @param expression The operand
+         ** @param operation The element-wise operation
+         */
+        explicit UnaryExpression(Expression&& expression, const Operation& operation = Operation());
+
+        /** @brief Compute an element of the expression without bound checking
+         ** @param height_index The height index of the element
+         ** @param width_index The width index of the element
+         ** @return The element
+         */
+        data_type_t operator()(size_t height_index, size_t width_index) const;
+
+        /** @brief Compute an element of the expression in the frame of broadcasting
+         ** @param height_index The height index of the element
+         ** @param width_index The width index of the element
+         ** @return The element
+         */
+        data_type_t get_broadcast_value(size_t height_index, size_t width_index) const;
+
+        /** @brief Compute an element from its index in the row-major data, valid when no operand is broadcast
+         ** @param index The index of the element
+         ** @return The element
+         */
+        data_type_t get_flat_value(size_t index) const;
+
+        /** @brief Check if an operand of the expression, at any depth, is broadcast
+         ** @return True if at least one operand does not have the shape of its parent expression
+         */
+        bool is_broadcasting() const;
+
+        /** @brief Check if a view read by the expression, at any depth, overlaps a memory range
+         ** @param begin The first element of the range
+         ** @param end The element after the last element of the range
+         ** @return True if at least one view operand reads an element of the range
+         */
+        bool is_aliasing(const data_type_t* begin, const data_type_t* end) const;
+
+        /** @brief Get the height of the expression
+         ** @return The height of the expression
+         */
+        size_t get_height() const;
+
+        /** @brief Get the width of the expression
+         ** @return The width of the expression
+         */
+        size_t get_width() const;
+
+        /** @brief Compute every element of the expression in one pass
+         ** @return The new matrix containing the result of the expression
+         */
+        matrix_t evaluate() const;
+
+    private:
+        /// The operand
+        expression_operand_t<Expression> expression_;
+        /// The element-wise operation
+        Operation operation_;
+    };
+
+    /** @brief Compute an element of an expression or a matrix from its index in the row-major data
+     ** @param expression The expression or the matrix
+     ** @param index The index of the element
+     ** @return The element
+     */
+    template <class Expression>
+    typename matrix_expression_traits<Expression>::data_type_t get_flat_value(const Expression& expression,
+                                                                               size_t index);
+
+    /** @brief Check if an operand of an expression, at any depth, is broadcast
+     ** @param expression The expression or the matrix
+     ** @return True if at least one operand does not have the shape of its parent expression, false for a matrix
+     */
+    template <class Expression>
+    bool is_broadcasting(const Expression& expression);
+
+    /** @brief Check if a view read by an expression, at any depth, overlaps a memory range
+     ** @details A matrix operand is only read at the position being computed, a view may be read at another one
+     ** @param expression The expression or the matrix
+     ** @param begin The first element of the range
+     ** @param end The element after the last element of the range
+     ** @return True if at least one view operand reads an element of the range, false for a matrix
+     */
+    template <class Expression>
+    bool is_aliasing(const Expression& expression,
+                     const typename matrix_expression_traits<Expression>::data_type_t* begin,
+                     const typename matrix_expression_traits<Expression>::data_type_t* end);
+
+    /** @brief Compute every element of an expression in one pass into a matrix of the same shape
+     ** @details Without broadcast operand the expression is computed over the flat data, which vectorizes
+     ** @param matrix The destination, its data must not be read by the expression at another position
+     ** @param expression The expression
+     */
+    template <class MATRIX, class Expression>
+    void evaluate_expression(MATRIX& matrix, const Expression& expression);
+
+    /** @brief Negate an expression lazily
+     ** @param expression The expression
+     ** @return The expression of the operation
+     */
+    template <class Expression, typename = std::enable_if_t<is_matrix_expression_v<std::decay_t<Expression>>>>
+    UnaryExpression<std::negate<>, expression_argument_t<Expression>> operator-(Expression&& expression);
+
+    /** @brief Compute a classic matrix addition lazily, broadcasting implemented
+     ** @param lhs The expression at the left of the operator
+     ** @param rhs The expression at the right of the operator
+     ** @return The expression of the operation
+     */
+    template <class LHS,
+              class RHS,
+              typename = std::enable_if_t<is_matrix_expression_v<std::decay_t<LHS>>
+                                          && is_matrix_expression_v<std::decay_t<RHS>>>>
+    BinaryExpression<std::plus<>, expression_argument_t<LHS>, expression_argument_t<RHS>>
+    operator+(LHS&& lhs, RHS&& rhs);
+
+    /** @brief Compute a classic matrix subtraction lazily, broadcasting implemented
+     ** @param lhs The expression at the left of the operator
+     ** @param rhs The expression at the right of the operator
+     ** @return The expression of the operation
+     */
+    template <class LHS,
+              class RHS,
+              typename = std::enable_if_t<is_matrix_expression_v<std::decay_t<LHS>>
+                                          && is_matrix_expression_v<std::decay_t<RHS>>>>
+    BinaryExpression<std::minus<>, expression_argument_t<LHS>, expression_argument_t<RHS>>
+    operator-(LHS&& lhs, RHS&& rhs);
+
+    /** @brief Compute an element-wise multiplication lazily, broadcasting implemented
+     ** @param lhs The expression at the left of the operator
+     ** @param rhs The expression at the right of the operator
+     ** @return The expression of the operation
+     */
+    template <class LHS,
+              class RHS,
+              typename = std::enable_if_t<is_matrix_expression_v<std::decay_t<LHS>>
+                                          && is_matrix_expression_v<std::decay_t<RHS>>>>
+    BinaryExpression<std::multiplies<>, expression_argument_t<LHS>, expression_argument_t<RHS>>
+    operator*(LHS&& lhs, RHS&& rhs);
+
+    /** @brief Compute an element-wise division lazily, broadcasting implemented
+     ** @param lhs The expression at the left of the operator
+     ** @param rhs The expression at the right of the operator
+     ** @return The expression of the operation
+     */
+    template <class LHS,
+              class RHS,
+              typename = std::enable_if_t<is_matrix_expression_v<std::decay_t<LHS>>
+                                          && is_matrix_expression_v<std::decay_t<RHS>>>>
+    BinaryExpression<std::divides<>, expression_argument_t<LHS>, expression_argument_t<RHS>>
+    operator/(LHS&& lhs, RHS&& rhs);
+
+    /** @brief Compute an element-wise modulus lazily, broadcasting implemented
+     ** @param lhs The expression at the left of the operator
+     ** @param rhs The expression at the right of the operator
+     ** @return The expression of the operation
+     */
+    template <class LHS,
+              class RHS,
+              typename = std::enable_if_t<is_matrix_expression_v<std::decay_t<LHS>>
+                                          && is_matrix_expression_v<std::decay_t<RHS>>>>
+    BinaryExpression<std::modulus<>, expression_argument_t<LHS>, expression_argument_t<RHS>>
+    operator%(LHS&& lhs, RHS&& rhs);
+
+    /** @brief Addition of each element of an expression with a scalar, lazily
+     ** @param expression The expression
+     ** @param scalar The scalar
+     ** @return The expression of the operation
+     */
+    template <class Expression>
+    ScalarExpression<std::plus<>, expression_argument_t<Expression>>
+    operator+(Expression&& expression,
+              const typename matrix_expression_traits<std::decay_t<Expression>>::data_type_t& scalar);
+
+    /** @brief Subtraction of each element of an expression with a scalar, lazily
+     ** @param expression The expression
+     ** @param scalar The scalar
+     ** @return The expression of the operation
+     */
+    template <class Expression>
+    ScalarExpression<std::minus<>, expression_argument_t<Expression>>
+    operator-(Expression&& expression,
+              const typename matrix_expression_traits<std::decay_t<Expression>>::data_type_t& scalar);
+
+    /** @brief Multiplication of each element of an expression with a scalar, lazily
+     ** @param expression The expression
+     ** @param scalar The scalar
+     ** @return The expression of the operation
+     */
+    template <class Expression>
+    ScalarExpression<std::multiplies<>, expression_argument_t<Expression>>
+    operator*(Expression&& expression,
+              const typename matrix_expression_traits<std::decay_t<Expression>>::data_type_t& scalar);
+
+    /** @brief Division of each element of an expression with a scalar, lazily
+     ** @param expression The expression
+     ** @param scalar The scalar
+     ** @return The expression of the operation
+     */
+    template <class Expression>
+    ScalarExpression<std::divides<>, expression_argument_t<Expression>>
+    operator/(Expression&& expression,
+              const typename matrix_expression_traits<std::decay_t<Expression>>::data_type_t& scalar);
+
+    /** @brief Modulus of each element of an expression with a scalar, lazily
+     ** @param expression The expression
+     ** @param scalar The scalar
+     ** @return The expression of the operation
+     */
+    template <class Expression>
+    ScalarExpression<std::modulus<>, expression_argument_t<Expression>>
+    operator%(Expression&& expression,
+              const typename matrix_expression_traits<std::decay_t<Expression>>::data_type_t& scalar);
+} // namespace ml::data_structure::matrix
+
+#include "data_structure/matrix/matrix_expression.hxx"
@@ -0,0 +1,375 @@
+/**
+ ** @file src/data_structure/matrix/matrix_expression.hxx
+ ** @brief Implementation of the lazy element-wise expressions of ml::data_structure::matrix
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include "computation/simd.hh"
+
+namespace ml::data_structure::matrix
+{
+    /** @brief Check that a dimension of an operand can be broadcast to the dimension of the result
+     ** @param size The dimension of the operand
+     ** @param result_size The dimension of the result
+     ** @return True if the operand has the dimension of the result or a dimension of one
+     */
+    inline static bool is_broadcastable(size_t size, size_t result_size)
+    {
+        return size == result_size || size == 1;
+    }
+
+    template <class Operation, class LHS, class RHS>
+    BinaryExpression<Operation, LHS, RHS>::BinaryExpression(LHS&& lhs, RHS&& rhs, const Operation& operation)
+        : lhs_(std::forward<LHS>(lhs))
+        , rhs_(std::forward<RHS>(rhs))
+        , operation_(operation)
+        , height_(std::max(lhs_.get_height(), rhs_.get_height()))
+        , width_(std::max(lhs_.get_width(), rhs_.get_width()))
+    {
+        if (!is_broadcastable(lhs_.get_height(), height_) || !is_broadcastable(rhs_.get_height(), height_)
+            || !is_broadcastable(lhs_.get_width(), width_) || !is_broadcastable(rhs_.get_width(), width_))
+            throw std::invalid_argument("The matrix are not compatible");
+    }
+
+    template <class Operation, class LHS, class RHS>
+    inline typename BinaryExpression<Operation, LHS, RHS>::data_type_t
+    BinaryExpression<Operation, LHS, RHS>::operator()(size_t height_index, size_t width_index) const
+    {
+        return operation_(lhs_.get_broadcast_value(height_index, width_index),
+                          rhs_.get_broadcast_value(height_index, width_index));
+    }
+
+    template <class Operation, class LHS, class RHS>
+    inline typename BinaryExpression<Operation, LHS, RHS>::data_type_t
+    BinaryExpression<Operation, LHS, RHS>::get_broadcast_value(size_t height_index, size_t width_index) const
+    {
+        if (get_height() == 1)
+            height_index = 0;
+        if (get_width() == 1)
+            width_index = 0;
+
+        return (*this)(height_index, width_index);
+    }
+
+    template <class Operation, class LHS, class RHS>
+    inline typename BinaryExpression<Operation, LHS, RHS>::data_type_t
+    BinaryExpression<Operation, LHS, RHS>::get_flat_value(size_t index) const
+    {
+        return operation_(ml::data_structure::matrix::get_flat_value(lhs_, index),
+                          ml::data_structure::matrix::get_flat_value(rhs_, index));
+    }
+
+    template <class Operation, class LHS, class RHS>
+    inline bool BinaryExpression<Operation, LHS, RHS>::is_broadcasting() const
+    {
+        return lhs_.get_height() != get_height() || lhs_.get_width() != get_width()
+               || rhs_.get_height() != get_height() || rhs_.get_width() != get_width()
+               || ml::data_structure::matrix::is_broadcasting(lhs_)
+               || ml::data_structure::matrix::is_broadcasting(rhs_);
+    }
+
+    template <class Operation, class LHS, class RHS>
+    inline bool BinaryExpression<Operation, LHS, RHS>::is_aliasing(const data_type_t* begin,
+                                                                   const data_type_t* end) const
+    {
+        return ml::data_structure::matrix::is_aliasing(lhs_, begin, end)
+               || ml::data_structure::matrix::is_aliasing(rhs_, begin, end);
+    }
+
+    template <class Operation, class LHS, class RHS>
+    inline size_t BinaryExpression<Operation, LHS, RHS>::get_height() const
+    {
+        // The shape of a fixed-size result is a compile-time constant, which lets the broadcast checks fold away
+        if constexpr (is_dynamic_matrix<matrix_t>::value)
+            return height_;
+        else
+            return matrix_t::get_height();
+    }
+
+    template <class Operation, class LHS, class RHS>
+    inline size_t BinaryExpression<Operation, LHS, RHS>::get_width() const
+    {
+        if constexpr (is_dynamic_matrix<matrix_t>::value)
+            return width_;
+        else
+            return matrix_t::get_width();
+    }
+
+    template <class Operation, class LHS, class RHS>
+    inline typename BinaryExpression<Operation, LHS, RHS>::matrix_t
+    BinaryExpression<Operation, LHS, RHS>::evaluate() const
+    {
+        return matrix_t(*this);
+    }
+
+    template <class Operation, class Expression>
+    ScalarExpression<Operation, Expression>::ScalarExpression(Expression&& expression,
+                                                              const data_type_t& scalar,
+                                                              const Operation& operation)
+        : expression_(std::forward<Expression>(expression))
+        , scalar_(scalar)
+        , operation_(operation)
+    {}
+
+    template <class Operation, class Expression>
+    inline typename ScalarExpression<Operation, Expression>::data_type_t
+    ScalarExpression<Operation, Expression>::operator()(size_t height_index, size_t width_index) const
+    {
+        return operation_(expression_(height_index, width_index), scalar_);
+    }
+
+    template <class Operation, class Expression>
+    inline typename ScalarExpression<Operation, Expression>::data_type_t
+    ScalarExpression<Operation, Expression>::get_broadcast_value(size_t height_index, size_t width_index) const
+    {
+        return operation_(expression_.get_broadcast_value(height_index, width_index), scalar_);
+    }
+
+    template <class Operation, class Expression>
+    inline typename ScalarExpression<Operation, Expression>::data_type_t
+    ScalarExpression<Operation, Expression>::get_flat_value(size_t index) const
+    {
+        return operation_(ml::data_structure::matrix::get_flat_value(expression_, index), scalar_);
+    }
+
+    template <class Operation, class Expression>
+    inline bool ScalarExpression<Operation, Expression>::is_broadcasting() const
+    {
+        return ml::data_structure::matrix::is_broadcasting(expression_);
+    }
+
+    template <class Operation, class Expression>
+    inline bool ScalarExpression<Operation, Expression>::is_aliasing(const data_type_t* begin,
+                                                                     const data_type_t* end) const
+    {
+        return ml::data_structure::matrix::is_aliasing(expression_, begin, end);
+    }
+
+    template <class Operation, class Expression>
+    inline size_t ScalarExpression<Operation, Expression>::get_height() const
+    {
+        return expression_.get_height();
+    }
+
+    template <class Operation, class Expression>
+    inline size_t ScalarExpression<Operation, Expression>::get_width() const
+    {
+        return expression_.get_width();
+    }
+
+    template <class Operation, class Expression>
+    inline typename ScalarExpression<Operation, Expression>::matrix_t
+    ScalarExpression<Operation, Expression>::evaluate() const
+    {
+        return matrix_t(*this);
+    }
+
+    template <class Operation, class Expression>
+    UnaryExpression<Operation, Expression>::UnaryExpression(Expression&& expression, const Operation& operation)
+        : expression_(std::forward<Expression>(expression))
+        , operation_(operation)
+    {}
+
+    template <class Operation, class Expression>
+    inline typename UnaryExpression<Operation, Expression>::data_type_t
+    UnaryExpression<Operation, Expression>::operator()(size_t height_index, size_t width_index) const
+    {
+        return operation_(expression_(height_index, width_index));
+    }
+
+    template <class Operation, class Expression>
+    inline typename UnaryExpression<Operation, Expression>::data_type_t
+    UnaryExpression<Operation, Expression>::get_broadcast_value(size_t height_index, size_t width_index) const
+    {
+        return operation_(expression_.get_broadcast_value(height_index, width_index));
+    }
+
+    template <class Operation, class Expression>
+    inline typename UnaryExpression<Operation, Expression>::data_type_t
+    UnaryExpression<Operation, Expression>::get_flat_value(size_t index) const
+    {
+        return operation_(ml::data_structure::matrix::get_flat_value(expression_, index));
+    }
+
+    template <class Operation, class Expression>
+    inline bool UnaryExpression<Operation, Expression>::is_broadcasting() const
+    {
+        return ml::data_structure::matrix::is_broadcasting(expression_);
+    }
+
+    template <class Operation, class Expression>
+    inline bool UnaryExpression<Operation, Expression>::is_aliasing(const data_type_t* begin,
+                                                                    const data_type_t* end) const
+    {
+        return ml::data_structure::matrix::is_aliasing(expression_, begin, end);
+    }
+
+    template <class Operation, class Expression>
+    inline size_t UnaryExpression<Operation, Expression>::get_height() const
+    {
+        return expression_.get_height();
+    }
+
+    template <class Operation, class Expression>
+    inline size_t UnaryExpression<Operation, Expression>::get_width() const
+    {
+        return expression_.get_width();
+    }
+
+    template <class Operation, class Expression>
+    inline typename UnaryExpression<Operation, Expression>::matrix_t
+    UnaryExpression<Operation, Expression>::evaluate() const
+    {
+        return matrix_t(*this);
+    }
+
+    template <class Expression>
+    inline typename matrix_expression_traits<Expression>::data_type_t get_flat_value(const Expression& expression,
+                                                                                      size_t index)
+    {
+        if constexpr (is_lazy_matrix_expression_v<Expression>)
+            return expression.get_flat_value(index);
+        else
+            return expression.data()[index];
+    }
+
+    template <class Expression>
+    inline bool is_broadcasting(const Expression& expression)
+    {
+        if constexpr (is_lazy_matrix_expression_v<Expression>)
+            return expression.is_broadcasting();
+        else
+            return false;
+    }
+
+    template <class Expression>
+    inline bool is_aliasing(const Expression& expression,
+                            const typename matrix_expression_traits<Expression>::data_type_t* begin,
+                            const typename matrix_expression_traits<Expression>::data_type_t* end)
+    {
+        if constexpr (is_lazy_matrix_expression_v<Expression>)
+            return expression.is_aliasing(begin, end);
+        else
+            return false;
+    }
+
+    template <class MATRIX, class Expression>
+    inline void evaluate_expression(MATRIX& matrix, const Expression& expression)
+    {
+        const size_t height = expression.get_height();
+        const size_t width = expression.get_width();
+        auto* data = matrix.data().data();
+
+        if (!expression.is_broadcasting())
+        {
+            ml::computation::simd::dispatch([&]() {
+                for (size_t i = 0; i < height * width; i++)
+                    data[i] = expression.get_flat_value(i);
+            });
+
+            return;
+        }
+
+        ml::computation::simd::dispatch([&]() {
+            for (size_t i = 0; i < height; i++)
+            {
+                for (size_t j = 0; j < width; j++)
+                    data[i * width + j] = expression(i, j);
+            }
+        });
+    }
+
+    template <class Expression, typename>
+    inline UnaryExpression<std::negate<>, expression_argument_t<Expression>> operator-(Expression&& expression)
+    {
+        return UnaryExpression<std::negate<>, expression_argument_t<Expression>>(std::forward<Expression>(expression));
+    }
+
+    template <class LHS, class RHS, typename>
+    inline BinaryExpression<std::plus<>, expression_argument_t<LHS>, expression_argument_t<RHS>>
+    operator+(LHS&& lhs, RHS&& rhs)
+    {
+        return BinaryExpression<std::plus<>, expression_argument_t<LHS>, expression_argument_t<RHS>>(
+            std::forward<LHS>(lhs), std::forward<RHS>(rhs));
+    }
+
+    template <class LHS, class RHS, typename>
+    inline BinaryExpression<std::minus<>, expression_argument_t<LHS>, expression_argument_t<RHS>>
+    operator-(LHS&& lhs, RHS&& rhs)
+    {
+        return BinaryExpression<std::minus<>, expression_argument_t<LHS>, expression_argument_t<RHS>>(
+            std::forward<LHS>(lhs), std::forward<RHS>(rhs));
+    }
+
+    template <class LHS, class RHS, typename>
+    inline BinaryExpression<std::multiplies<>, expression_argument_t<LHS>, expression_argument_t<RHS>>
+    operator*(LHS&& lhs, RHS&& rhs)
+    {
+        return BinaryExpression<std::multiplies<>, expression_argument_t<LHS>, expression_argument_t<RHS>>(
+            std::forward<LHS>(lhs), std::forward<RHS>(rhs));
+    }
+
+    template <class LHS, class RHS, typename>
+    inline BinaryExpression<std::divides<>, expression_argument_t<LHS>, expression_argument_t<RHS>>
+    operator/(LHS&& lhs, RHS&& rhs)
+    {
+        return BinaryExpression<std::divides<>, expression_argument_t<LHS>, expression_argument_t<RHS>>(
+            std::forward<LHS>(lhs), std::forward<RHS>(rhs));
+    }
+
+    template <class LHS, class RHS, typename>
+    inline BinaryExpression<std::modulus<>, expression_argument_t<LHS>, expression_argument_t<RHS>>
+    operator%(LHS&& lhs, RHS&& rhs)
+    {
+        return BinaryExpression<std::modulus<>, expression_argument_t<LHS>, expression_argument_t<RHS>>(
+            std::forward<LHS>(lhs), std::forward<RHS>(rhs));
+    }
+
+    template <class Expression>
+    inline ScalarExpression<std::plus<>, expression_argument_t<Expression>>
+    operator+(Expression&& expression,
+              const typename matrix_expression_traits<std::decay_t<Expression>>::data_type_t& scalar)
+    {
+        return ScalarExpression<std::plus<>, expression_argument_t<Expression>>(
+            std::forward<Expression>(expression), scalar);
+    }
+
+    template <class Expression>
+    inline ScalarExpression<std::minus<>, expression_argument_t<Expression>>
+    operator-(Expression&& expression,
+              const typename matrix_expression_traits<std::decay_t<Expression>>::data_type_t& scalar)
+    {
+        return ScalarExpression<std::minus<>, expression_argument_t<Expression>>(
+            std::forward<Expression>(expression), scalar);
+    }
+
+    template <class Expression>
+    inline ScalarExpression<std::multiplies<>, expression_argument_t<Expression>>
+    operator*(Expression&& expression,
+              const typename matrix_expression_traits<std::decay_t<Expression>>::data_type_t& scalar)
+    {
+        return ScalarExpression<std::multiplies<>, expression_argument_t<Expression>>(
+            std::forward<Expression>(expression), scalar);
+    }
+
+    template <class Expression>
+    inline ScalarExpression<std::divides<>, expression_argument_t<Expression>>
+    operator/(Expression&& expression,
+              const typename matrix_expression_traits<std::decay_t<Expression>>::data_type_t& scalar)
+    {
+        return ScalarExpression<std::divides<>, expression_argument_t<Expression>>(
+            std::forward<Expression>(expression), scalar);
+    }
+
+    template <class Expression>
+    inline ScalarExpression<std::modulus<>, expression_argument_t<Expression>>
+    operator%(Expression&& expression,
+              const typename matrix_expression_traits<std::decay_t<Expression>>::data_type_t& scalar)
+    {
+        return ScalarExpression<std::modulus<>, expression_argument_t<Expression>>(
+            std::forward<Expression>(expression), scalar);
+    }
+} // namespace ml::data_structure::matrix
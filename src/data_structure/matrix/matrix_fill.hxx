@@ -24,12 +24,8 @@ namespace ml::data_structure::matrix
     inline Matrix<DATA_TYPE, HEIGHT, WIDTH>& Matrix<DATA_TYPE, HEIGHT, WIDTH>::fill_column(size_t column_index,
                                                                                            const DATA_TYPE& value)
     {
-        auto first_it = this->data_.begin() + column_index;
-        auto last_it = this->data().begin() + column_index + (HEIGHT - 1) * WIDTH;
-        column_step_iterator_t column_begin(first_it, first_it, last_it);
-        column_step_iterator_t column_end(this->data_.end(), first_it, last_it);
-
-        std::fill(column_begin, column_end, value);
+        const auto column_it = this->data_.begin() + column_index;
+        std::fill(column_iterator_t(column_it), column_iterator_t(column_it, HEIGHT), value);
         return *this;
     }
 
@@ -38,7 +34,7 @@ namespace ml::data_structure::matrix
     inline Matrix<DATA_TYPE, HEIGHT, WIDTH>&
     Matrix<DATA_TYPE, HEIGHT, WIDTH>::fill_generator(const Generator& generator)
     {
-        std::generate(this->data_.begin(), this->data_.end(), generator);
+        ml::generator::generate(this->data_.data(), this->data_.data() + HEIGHT * WIDTH, generator);
         return *this;
     }
 
@@ -47,8 +43,8 @@ namespace ml::data_structure::matrix
     inline Matrix<DATA_TYPE, HEIGHT, WIDTH>&
     Matrix<DATA_TYPE, HEIGHT, WIDTH>::fill_row_generator(size_t row_index, const Generator& generator)
     {
-        std::generate(
-            this->data_.begin() + row_index * WIDTH, this->data_.begin() + (row_index + 1) * WIDTH, generator);
+        ml::generator::generate(
+            this->data_.data() + row_index * WIDTH, this->data_.data() + (row_index + 1) * WIDTH, generator);
         return *this;
     }
 
@@ -57,12 +53,8 @@ namespace ml::data_structure::matrix
     inline Matrix<DATA_TYPE, HEIGHT, WIDTH>&
     Matrix<DATA_TYPE, HEIGHT, WIDTH>::fill_column_generator(size_t column_index, const Generator& generator)
     {
-        auto first_it = this->data_.begin() + column_index;
-        auto last_it = this->data().begin() + column_index + (HEIGHT - 1) * WIDTH;
-        column_step_iterator_t column_begin(first_it, first_it, last_it);
-        column_step_iterator_t column_end(this->data_.end(), first_it, last_it);
-
-        std::generate(column_begin, column_end, generator);
+        const auto column_it = this->data_.begin() + column_index;
+        std::generate(column_iterator_t(column_it), column_iterator_t(column_it, HEIGHT), generator);
         return *this;
     }
 } // namespace ml::data_structure::matrix
@@ -3,21 +3,17 @@
  ** @brief Multiplies Matrix implementations for ml::data_structure::matrix::Matrix
  */
 
+#include "computation/gemm.hh"
+
 namespace ml::data_structure::matrix
 {
     template <typename DATA_TYPE, size_t M, size_t N, size_t P>
     Matrix<DATA_TYPE, M, P> multiplies_matrix(const Matrix<DATA_TYPE, M, N>& lhs, const Matrix<DATA_TYPE, N, P>& rhs)
     {
-        Matrix<DATA_TYPE, M, P> new_matrix(0);
+        Matrix<DATA_TYPE, M, P> new_matrix;
 
-        for (size_t i = 0; i < M; i++)
-        {
-            for (size_t j = 0; j < P; j++)
-            {
-                for (size_t k = 0; k < N; k++)
-                    new_matrix(i, j) += lhs(i, k) * rhs(k, j);
-            }
-        }
+        ml::computation::gemm::multiply<DATA_TYPE>(
+            M, N, P, lhs.data().data(), N, 1, rhs.data().data(), P, 1, new_matrix.data().data(), P);
 
         return new_matrix;
     }
@@ -9,7 +9,7 @@ namespace ml::data_structure::matrix
     template <class Compare>
     Matrix<DATA_TYPE, HEIGHT, WIDTH>& Matrix<DATA_TYPE, HEIGHT, WIDTH>::sort(const Compare& compare)
     {
-        std::sort(this->data_.begin(), this->data_.end(), compare);
+        ml::computation::sort::sort(this->data_.data(), this->data_.data() + HEIGHT * WIDTH, compare);
         return *this;
     }
 
@@ -25,11 +25,7 @@ namespace ml::data_structure::matrix
     template <class Compare>
     Matrix<DATA_TYPE, HEIGHT, WIDTH>& Matrix<DATA_TYPE, HEIGHT, WIDTH>::sort_rows(const Compare& compare)
     {
-        for (size_t i = 0; i < HEIGHT; i++)
-        {
-            std::sort(this->data_.begin() + (i * WIDTH), this->data_.begin() + ((i + 1) * WIDTH), compare);
-        }
-
+        ml::computation::sort::sort_rows(HEIGHT, WIDTH, this->data_.data(), static_cast<ptrdiff_t>(WIDTH), compare);
         return *this;
     }
 
@@ -46,16 +42,7 @@ namespace ml::data_structure::matrix
     template <class Compare>
     Matrix<DATA_TYPE, HEIGHT, WIDTH>& Matrix<DATA_TYPE, HEIGHT, WIDTH>::sort_columns(const Compare& compare)
     {
-        for (size_t j = 0; j < WIDTH; j++)
-        {
-            auto first_it = this->data_.begin() + j;
-            auto last_it = this->data().begin() + j + (HEIGHT - 1) * WIDTH;
-            column_step_iterator_t column_begin(first_it, first_it, last_it);
-            column_step_iterator_t column_end(this->data_.end(), first_it, last_it);
-
-            std::sort(column_begin, column_end, compare);
-        }
-
+        ml::computation::sort::sort_columns(HEIGHT, WIDTH, this->data_.data(), static_cast<ptrdiff_t>(WIDTH), compare);
         return *this;
     }
 
@@ -67,4 +54,82 @@ namespace ml::data_structure::matrix
         matrix_result.sort_columns(compare);
         return matrix_result;
     }
-} // namespace ml::data_structure::matrix
\ No newline at end of file
+
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    template <class Compare>
+    Matrix<DATA_TYPE, HEIGHT, WIDTH>& Matrix<DATA_TYPE, HEIGHT, WIDTH>::sort_rows_by_column(size_t column_index,
+                                                                                           const Compare& compare)
+    {
+        if (column_index >= WIDTH)
+            throw std::out_of_range("column_index out of range");
+
+        constexpr auto row_stride = static_cast<ptrdiff_t>(WIDTH);
+        std::vector<size_t> permutation(HEIGHT);
+        ml::computation::sort::argsort(
+            HEIGHT, this->data_.data() + column_index, row_stride, permutation.data(), 1, compare);
+
+        const std::vector<DATA_TYPE> source(this->data_.cbegin(), this->data_.cend());
+        ml::computation::sort::gather_rows(
+            HEIGHT, WIDTH, source.data(), row_stride, permutation.data(), this->data_.data(), row_stride);
+        return *this;
+    }
+
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH, class Compare>
+    inline Matrix<DATA_TYPE, HEIGHT, WIDTH> sort_rows_by_column(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix,
+                                                                size_t column_index,
+                                                                const Compare& compare)
+    {
+        Matrix<DATA_TYPE, HEIGHT, WIDTH> matrix_result = matrix;
+        matrix_result.sort_rows_by_column(column_index, compare);
+        return matrix_result;
+    }
+
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    template <class Compare>
+    inline Matrix<size_t, HEIGHT, WIDTH> Matrix<DATA_TYPE, HEIGHT, WIDTH>::argsort(const Compare& compare) const
+    {
+        return ml::data_structure::matrix::argsort(*this, compare);
+    }
+
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH, class Compare>
+    inline Matrix<size_t, HEIGHT, WIDTH> argsort(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix, const Compare& compare)
+    {
+        Matrix<size_t, HEIGHT, WIDTH> indexes;
+        ml::computation::sort::argsort(HEIGHT * WIDTH, matrix.data().data(), 1, indexes.data().data(), 1, compare);
+        return indexes;
+    }
+
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    template <class Compare>
+    inline Matrix<size_t, HEIGHT, WIDTH> Matrix<DATA_TYPE, HEIGHT, WIDTH>::argsort_rows(const Compare& compare) const
+    {
+        return ml::data_structure::matrix::argsort_rows(*this, compare);
+    }
+
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH, class Compare>
+    inline Matrix<size_t, HEIGHT, WIDTH> argsort_rows(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix,
+                                                      const Compare& compare)
+    {
+        Matrix<size_t, HEIGHT, WIDTH> indexes;
+        ml::computation::sort::argsort_rows(
+            HEIGHT, WIDTH, matrix.data().data(), static_cast<ptrdiff_t>(WIDTH), indexes.data().data(), compare);
+        return indexes;
+    }
+
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    template <class Compare>
+    inline Matrix<size_t, HEIGHT, WIDTH> Matrix<DATA_TYPE, HEIGHT, WIDTH>::argsort_columns(const Compare& compare) const
+    {
+        return ml::data_structure::matrix::argsort_columns(*this, compare);
+    }
+
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH, class Compare>
+    inline Matrix<size_t, HEIGHT, WIDTH> argsort_columns(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix,
+                                                         const Compare& compare)
+    {
+        Matrix<size_t, HEIGHT, WIDTH> indexes;
+        ml::computation::sort::argsort_columns(
+            HEIGHT, WIDTH, matrix.data().data(), static_cast<ptrdiff_t>(WIDTH), indexes.data().data(), compare);
+        return indexes;
+    }
+} // namespace ml::data_structure::matrix
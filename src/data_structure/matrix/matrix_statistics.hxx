@@ -3,6 +3,9 @@
  ** @brief Statistic functions implementations for ml::data_structure::matrix::Matrix
  */
 
+#include <cmath>
+#include <vector>
+
 #include "computation/statistic.hh"
 
 namespace ml::data_structure::matrix
@@ -19,21 +22,27 @@ namespace ml::data_structure::matrix
     {
         Matrix<DATA_TYPE, 1, WIDTH> row_matrix;
 
+        using column_const_iterator_t = typename Matrix<DATA_TYPE, HEIGHT, WIDTH>::column_const_iterator_t;
+
         for (size_t j = 0; j < WIDTH; j++)
         {
-            auto first_it = matrix.data().cbegin() + j;
-            auto last_it = matrix.data().cbegin() + j + (HEIGHT - 1) * WIDTH;
-            typename Matrix<DATA_TYPE, HEIGHT, WIDTH>::column_const_step_iterator_t column_begin(
-                first_it, first_it, last_it);
-            typename Matrix<DATA_TYPE, HEIGHT, WIDTH>::column_const_step_iterator_t column_end(
-                matrix.data().cend(), first_it, last_it);
-
-            row_matrix(0, j) = function(column_begin, column_end);
+            const auto column_it = matrix.data().cbegin() + j;
+            row_matrix(0, j) = function(column_const_iterator_t(column_it), column_const_iterator_t(column_it, HEIGHT));
         }
 
         return row_matrix;
     }
 
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH, class Kernel>
+    static Matrix<DATA_TYPE, 1, WIDTH> reduce_columns(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix,
+                                                      const Kernel& kernel)
+    {
+        Matrix<DATA_TYPE, 1, WIDTH> row_matrix;
+        kernel(HEIGHT, WIDTH, matrix.data().data(), WIDTH, row_matrix.data().data());
+
+        return row_matrix;
+    }
+
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH, class Function>
     static Matrix<DATA_TYPE, HEIGHT, 1> statistic_rows(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix,
                                                        const Function& function)
@@ -62,6 +71,15 @@ namespace ml::data_structure::matrix
             matrix, [](const auto& begin, const auto& end) { return ml::computation::statistic::sum(begin, end); });
     }
 
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    inline DATA_TYPE sum(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix,
+                         ml::computation::statistic::Execution execution)
+    {
+        return statistic(matrix, [execution](const auto& begin, const auto& end) {
+            return ml::computation::statistic::sum(begin, end, execution);
+        });
+    }
+
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     inline Matrix<DATA_TYPE, 1, WIDTH> Matrix<DATA_TYPE, HEIGHT, WIDTH>::sum_columns() const
     {
@@ -71,8 +89,7 @@ namespace ml::data_structure::matrix
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     inline Matrix<DATA_TYPE, 1, WIDTH> sum_columns(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix)
     {
-        return statistic_columns(
-            matrix, [](const auto& begin, const auto& end) { return ml::computation::statistic::sum(begin, end); });
+        return reduce_columns(matrix, ml::computation::statistic::sum_columns<DATA_TYPE>);
     }
 
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
@@ -109,8 +126,7 @@ namespace ml::data_structure::matrix
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     inline Matrix<DATA_TYPE, 1, WIDTH> min_columns(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix)
     {
-        return statistic_columns(matrix,
-                                 [](const auto& begin, const auto& end) { return *std::min_element(begin, end); });
+        return reduce_columns(matrix, ml::computation::statistic::min_columns<DATA_TYPE>);
     }
 
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
@@ -146,8 +162,7 @@ namespace ml::data_structure::matrix
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     inline Matrix<DATA_TYPE, 1, WIDTH> max_columns(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix)
     {
-        return statistic_columns(matrix,
-                                 [](const auto& begin, const auto& end) { return *std::max_element(begin, end); });
+        return reduce_columns(matrix, ml::computation::statistic::max_columns<DATA_TYPE>);
     }
 
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
@@ -175,6 +190,15 @@ namespace ml::data_structure::matrix
             matrix, [](const auto& begin, const auto& end) { return ml::computation::statistic::mean(begin, end); });
     }
 
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    inline DATA_TYPE mean(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix,
+                          ml::computation::statistic::Execution execution)
+    {
+        return statistic(matrix, [execution](const auto& begin, const auto& end) {
+            return ml::computation::statistic::mean(begin, end, execution);
+        });
+    }
+
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     inline Matrix<DATA_TYPE, 1, WIDTH> Matrix<DATA_TYPE, HEIGHT, WIDTH>::mean_columns() const
     {
@@ -184,8 +208,7 @@ namespace ml::data_structure::matrix
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     inline Matrix<DATA_TYPE, 1, WIDTH> mean_columns(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix)
     {
-        return statistic_columns(
-            matrix, [](const auto& begin, const auto& end) { return ml::computation::statistic::mean(begin, end); });
+        return reduce_columns(matrix, ml::computation::statistic::mean_columns<DATA_TYPE>);
     }
 
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
@@ -223,8 +246,11 @@ namespace ml::data_structure::matrix
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     inline Matrix<DATA_TYPE, 1, WIDTH> median_columns(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix)
     {
-        return statistic_columns(
-            matrix, [](const auto& begin, const auto& end) { return ml::computation::statistic::median(begin, end); });
+        std::vector<DATA_TYPE> buffer(HEIGHT);
+
+        return statistic_columns(matrix, [&buffer](const auto& begin, const auto& end) {
+            return ml::computation::statistic::median(begin, end, buffer);
+        });
     }
 
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
@@ -236,8 +262,11 @@ namespace ml::data_structure::matrix
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     inline Matrix<DATA_TYPE, HEIGHT, 1> median_rows(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix)
     {
-        return statistic_rows(
-            matrix, [](const auto& begin, const auto& end) { return ml::computation::statistic::median(begin, end); });
+        std::vector<DATA_TYPE> buffer(WIDTH);
+
+        return statistic_rows(matrix, [&buffer](const auto& begin, const auto& end) {
+            return ml::computation::statistic::median(begin, end, buffer);
+        });
     }
 
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
@@ -254,6 +283,16 @@ namespace ml::data_structure::matrix
         });
     }
 
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    inline DATA_TYPE variance(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix,
+                              size_t ddof,
+                              ml::computation::statistic::Execution execution)
+    {
+        return statistic(matrix, [ddof, execution](const auto& begin, const auto& end) {
+            return ml::computation::statistic::variance(begin, end, ddof, execution);
+        });
+    }
+
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     inline Matrix<DATA_TYPE, 1, WIDTH> Matrix<DATA_TYPE, HEIGHT, WIDTH>::variance_columns(size_t ddof) const
     {
@@ -263,9 +302,11 @@ namespace ml::data_structure::matrix
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     inline Matrix<DATA_TYPE, 1, WIDTH> variance_columns(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix, size_t ddof)
     {
-        return statistic_columns(matrix, [ddof](const auto& begin, const auto& end) {
-            return ml::computation::statistic::variance(begin, end, ddof);
-        });
+        Matrix<DATA_TYPE, 1, WIDTH> row_matrix;
+        ml::computation::statistic::variance_columns(
+            HEIGHT, WIDTH, matrix.data().data(), WIDTH, row_matrix.data().data(), ddof);
+
+        return row_matrix;
     }
 
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
@@ -296,6 +337,16 @@ namespace ml::data_structure::matrix
         });
     }
 
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    inline DATA_TYPE standard_deviation(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix,
+                                        size_t ddof,
+                                        ml::computation::statistic::Execution execution)
+    {
+        return statistic(matrix, [ddof, execution](const auto& begin, const auto& end) {
+            return ml::computation::statistic::standard_deviation(begin, end, ddof, execution);
+        });
+    }
+
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     inline Matrix<DATA_TYPE, 1, WIDTH> Matrix<DATA_TYPE, HEIGHT, WIDTH>::standard_deviation_columns(size_t ddof) const
     {
@@ -306,9 +357,7 @@ namespace ml::data_structure::matrix
     inline Matrix<DATA_TYPE, 1, WIDTH> standard_deviation_columns(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix,
                                                                   size_t ddof)
     {
-        return statistic_columns(matrix, [ddof](const auto& begin, const auto& end) {
-            return ml::computation::statistic::standard_deviation(begin, end, ddof);
-        });
+        return variance_columns(matrix, ddof).apply([](const auto& value) { return std::sqrt(value); });
     }
 
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
@@ -349,9 +398,7 @@ namespace ml::data_structure::matrix
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     inline Matrix<DATA_TYPE, 1, WIDTH> sum_product_columns(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix)
     {
-        return statistic_columns(matrix, [](const auto& begin, const auto& end) {
-            return ml::computation::statistic::sum_product(begin, end);
-        });
+        return reduce_columns(matrix, ml::computation::statistic::sum_product_columns<DATA_TYPE>);
     }
 
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
@@ -409,4 +456,54 @@ namespace ml::data_structure::matrix
             return ml::computation::statistic::peak_to_peak(begin, end);
         });
     }
+
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    inline ml::computation::statistic::Description<DATA_TYPE>
+    Matrix<DATA_TYPE, HEIGHT, WIDTH>::describe(size_t ddof) const
+    {
+        return ml::data_structure::matrix::describe(*this, ddof);
+    }
+
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    inline ml::computation::statistic::Description<DATA_TYPE> describe(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix,
+                                                                       size_t ddof)
+    {
+        return ml::computation::statistic::describe(matrix.data().cbegin(), matrix.data().cend(), ddof);
+    }
+
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    inline ml::computation::statistic::Description<Matrix<DATA_TYPE, 1, WIDTH>>
+    Matrix<DATA_TYPE, HEIGHT, WIDTH>::describe_columns(size_t ddof) const
+    {
+        return ml::data_structure::matrix::describe_columns(*this, ddof);
+    }
+
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    inline ml::computation::statistic::Description<Matrix<DATA_TYPE, 1, WIDTH>>
+    describe_columns(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix, size_t ddof)
+    {
+        auto description = ml::computation::statistic::make_description(Matrix<DATA_TYPE, 1, WIDTH>());
+        ml::computation::statistic::describe_columns(
+            HEIGHT, WIDTH, matrix.data().data(), WIDTH, ml::computation::statistic::get_data(description), ddof);
+
+        return description;
+    }
+
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    inline ml::computation::statistic::Description<Matrix<DATA_TYPE, HEIGHT, 1>>
+    Matrix<DATA_TYPE, HEIGHT, WIDTH>::describe_rows(size_t ddof) const
+    {
+        return ml::data_structure::matrix::describe_rows(*this, ddof);
+    }
+
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    inline ml::computation::statistic::Description<Matrix<DATA_TYPE, HEIGHT, 1>>
+    describe_rows(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix, size_t ddof)
+    {
+        auto description = ml::computation::statistic::make_description(Matrix<DATA_TYPE, HEIGHT, 1>());
+        ml::computation::statistic::describe_rows(
+            HEIGHT, WIDTH, matrix.data().data(), WIDTH, ml::computation::statistic::get_data(description), ddof);
+
+        return description;
+    }
 } // namespace ml::data_structure::matrix
@@ -3,6 +3,8 @@
  ** @brief Transpose implementations for ml::data_structure::matrix::Matrix
  */
 
+#include "computation/transpose.hh"
+
 namespace ml::data_structure::matrix
 {
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
@@ -11,17 +13,23 @@ namespace ml::data_structure::matrix
         return ml::data_structure::matrix::transpose(*this);
     }
 
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    Matrix<DATA_TYPE, HEIGHT, WIDTH>& Matrix<DATA_TYPE, HEIGHT, WIDTH>::transpose_in_place()
+    {
+        static_assert(HEIGHT == WIDTH, "Only a square matrix can be transposed in place");
+
+        ml::computation::transpose::in_place(HEIGHT, this->data_.data());
+
+        return *this;
+    }
+
     template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
     Matrix<DATA_TYPE, WIDTH, HEIGHT> transpose(const Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix)
     {
         Matrix<DATA_TYPE, WIDTH, HEIGHT> new_matrix;
 
-        for (size_t i = 0; i < HEIGHT; i++)
-        {
-            for (size_t j = 0; j < WIDTH; j++)
-                new_matrix(j, i) = matrix(i, j);
-        }
+        ml::computation::transpose::copy(HEIGHT, WIDTH, matrix.data().data(), new_matrix.data().data());
 
         return new_matrix;
     }
-} // namespace ml::data_structure::matrix
\ No newline at end of file
+} // namespace ml::data_structure::matrix
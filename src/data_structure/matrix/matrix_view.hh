@@ -0,0 +1,416 @@
+/**
+ ** @file src/data_structure/matrix/matrix_view.hh
+ ** @brief Declaration of ml::data_structure::matrix::MatrixView and related functions
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "computation/statistic.hh"
+#include "data_structure/matrix/matrix_expression.hh"
+
+namespace ml::data_structure::matrix
+{
+    /** @brief A non-owning view over the elements of a matrix, each dimension having its own stride
+     ** @details The transposed, block, row and column views only change the strides, no element is ever copied. A
+     ** view is read-only when DATA_TYPE is const, it must not outlive the matrix it was taken from.
+     */
+    template <typename DATA_TYPE>
+    class MatrixView
+    {
+    public:
+        /// The type of the elements, without the const qualifier of a read-only view
+        using data_type_t = std::remove_const_t<DATA_TYPE>;
+        /// The type of the matrix a view is copied to
+        using matrix_t = DynamicMatrix<data_type_t>;
+
+        /** @name Constructors
+         ** \{ */
+
+        /// @brief Instantiate a new empty view
+        MatrixView();
+
+        /** @brief Instantiate a new view
+         ** @param data The address of the first element
+         ** @param height The height of the view
+         ** @param width The width of the view
+         ** @param row_stride The distance in elements between two consecutive rows
+         ** @param column_stride The distance in elements between two consecutive columns
+         */
+        MatrixView(DATA_TYPE* data, size_t height, size_t width, ptrdiff_t row_stride, ptrdiff_t column_stride);
+
+        /** @brief Instantiate a read-only view from a view allowing modifications
+         ** @param view The view
+         */
+        template <typename OTHER_TYPE, typename = std::enable_if_t<std::is_same_v<const OTHER_TYPE, DATA_TYPE>>>
+        MatrixView(const MatrixView<OTHER_TYPE>& view);
+
+        /** \} */
+
+        /** @name Views
+         ** \{ */
+
+        /** @brief Get the transposed view, the strides are swapped
+         ** @return The transposed view
+         */
+        MatrixView<DATA_TYPE> transpose() const;
+
+        /** @brief Get a view of a rectangular block of the view
+         ** @param height_index The height index of the first element of the block
+         ** @param width_index The width index of the first element of the block
+         ** @param height The height of the block
+         ** @param width The width of the block
+         ** @return The view of the block
+         */
+        MatrixView<DATA_TYPE> block(size_t height_index, size_t width_index, size_t height, size_t width) const;
+
+        /** @brief Get the view of a row
+         ** @param height_index The index of the row
+         ** @return The view of the row, of height one
+         */
+        MatrixView<DATA_TYPE> row(size_t height_index) const;
+
+        /** @brief Get the view of a column
+         ** @param width_index The index of the column
+         ** @return The view of the column, of width one
+         */
+        MatrixView<DATA_TYPE> column(size_t width_index) const;
+
+        /** \} */
+
+        /** @name Accessors
+         ** \{ */
+
+        /** @brief Access an element of the view without bound checking
+         ** @param height_index The height index of the element
+         ** @param width_index The width index of the element
+         ** @return The reference to the element
+         */
+        DATA_TYPE& operator()(size_t height_index, size_t width_index) const;
+
+        /** @brief Access an element of the view with bound checking
+         ** @param height_index The height index of the element
+         ** @param width_index The width index of the element
+         ** @return The reference to the element
+         */
+        DATA_TYPE& at(size_t height_index, size_t width_index) const;
+
+        /** @brief Access an element in the view in the frame of broadcasting
+         ** @param height_index The height index of the element
+         ** @param width_index The width index of the element
+         ** @return The element
+         */
+        DATA_TYPE& get_broadcast_value(size_t height_index, size_t width_index) const;
+
+        /** @brief Access an element from its index in the row-major order, valid when the view is contiguous
+         ** @param index The index of the element
+         ** @return The element
+         */
+        DATA_TYPE& get_flat_value(size_t index) const;
+
+        /** @brief Get the address of the first element
+         ** @return The address of the first element
+         */
+        DATA_TYPE* data() const;
+
+        /** @brief Get the height of the view
+         ** @return The height of the view
+         */
+        size_t get_height() const;
+
+        /** @brief Get the width of the view
+         ** @return The width of the view
+         */
+        size_t get_width() const;
+
+        /** @brief Get the distance in elements between two consecutive rows
+         ** @return The row stride
+         */
+        ptrdiff_t get_row_stride() const;
+
+        /** @brief Get the distance in elements between two consecutive columns
+         ** @return The column stride
+         */
+        ptrdiff_t get_column_stride() const;
+
+        /** @brief Check if the elements are stored one after the other in the row-major order
+         ** @return True if the view can be read as a flat array
+         */
+        bool is_contiguous() const;
+
+        /** \} */
+
+        /** @name Lazy Expression
+         ** \{ */
+
+        /** @brief Check if the view can not be read from the row-major index of its elements
+         ** @return True if the view is not contiguous
+         */
+        bool is_broadcasting() const;
+
+        /** @brief Check if the view reads an element of a memory range
+         ** @param begin The first element of the range
+         ** @param end The element after the last element of the range
+         ** @return True if the memory spanned by the view overlaps the range
+         */
+        bool is_aliasing(const data_type_t* begin, const data_type_t* end) const;
+
+        /** @brief Copy the elements of the view into a new matrix
+         ** @return The new matrix
+         */
+        matrix_t evaluate() const;
+
+        /** \} */
+
+    private:
+        /// The address of the first element
+        DATA_TYPE* data_;
+        /// The height of the view
+        size_t height_;
+        /// The width of the view
+        size_t width_;
+        /// The distance in elements between two consecutive rows
+        ptrdiff_t row_stride_;
+        /// The distance in elements between two consecutive columns
+        ptrdiff_t column_stride_;
+    };
+
+    /** @brief Compute a classic multiplication of two views, without copying them
+     ** @param lhs The view at the left of the operator
+     ** @param rhs The view at the right of the operator
+     ** @return The new matrix containing the result of the operation
+     */
+    template <typename LHS_TYPE, typename RHS_TYPE>
+    DynamicMatrix<std::remove_const_t<LHS_TYPE>> multiplies_matrix(const MatrixView<LHS_TYPE>& lhs,
+                                                                   const MatrixView<RHS_TYPE>& rhs);
+
+    /** @brief Compute the sum of a view
+     ** @param view The view
+     ** @return The sum
+     */
+    template <typename DATA_TYPE>
+    std::remove_const_t<DATA_TYPE> sum(const MatrixView<DATA_TYPE>& view);
+
+    /** @brief Compute the sum of each column of a view
+     ** @param view The view
+     ** @return The new row matrix containing the sums
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<std::remove_const_t<DATA_TYPE>> sum_columns(const MatrixView<DATA_TYPE>& view);
+
+    /** @brief Compute the sum of each row of a view
+     ** @param view The view
+     ** @return The new column matrix containing the sums
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<std::remove_const_t<DATA_TYPE>> sum_rows(const MatrixView<DATA_TYPE>& view);
+
+    /** @brief Compute the min of a view
+     ** @param view The view
+     ** @return The min
+     */
+    template <typename DATA_TYPE>
+    std::remove_const_t<DATA_TYPE> min(const MatrixView<DATA_TYPE>& view);
+
+    /** @brief Compute the min of each column of a view
+     ** @param view The view
+     ** @return The new row matrix containing the mins
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<std::remove_const_t<DATA_TYPE>> min_columns(const MatrixView<DATA_TYPE>& view);
+
+    /** @brief Compute the min of each row of a view
+     ** @param view The view
+     ** @return The new column matrix containing the mins
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<std::remove_const_t<DATA_TYPE>> min_rows(const MatrixView<DATA_TYPE>& view);
+
+    /** @brief Compute the max of a view
+     ** @param view The view
+     ** @return The max
+     */
+    template <typename DATA_TYPE>
+    std::remove_const_t<DATA_TYPE> max(const MatrixView<DATA_TYPE>& view);
+
+    /** @brief Compute the max of each column of a view
+     ** @param view The view
+     ** @return The new row matrix containing the maxs
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<std::remove_const_t<DATA_TYPE>> max_columns(const MatrixView<DATA_TYPE>& view);
+
+    /** @brief Compute the max of each row of a view
+     ** @param view The view
+     ** @return The new column matrix containing the maxs
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<std::remove_const_t<DATA_TYPE>> max_rows(const MatrixView<DATA_TYPE>& view);
+
+    /** @brief Compute the mean of a view
+     ** @param view The view
+     ** @return The mean
+     */
+    template <typename DATA_TYPE>
+    std::remove_const_t<DATA_TYPE> mean(const MatrixView<DATA_TYPE>& view);
+
+    /** @brief Compute the mean of each column of a view
+     ** @param view The view
+     ** @return The new row matrix containing the means
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<std::remove_const_t<DATA_TYPE>> mean_columns(const MatrixView<DATA_TYPE>& view);
+
+    /** @brief Compute the mean of each row of a view
+     ** @param view The view
+     ** @return The new column matrix containing the means
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<std::remove_const_t<DATA_TYPE>> mean_rows(const MatrixView<DATA_TYPE>& view);
+
+    /** @brief Compute the median of a view
+     ** @param view The view
+     ** @return The median
+     */
+    template <typename DATA_TYPE>
+    std::remove_const_t<DATA_TYPE> median(const MatrixView<DATA_TYPE>& view);
+
+    /** @brief Compute the median of each column of a view
+     ** @param view The view
+     ** @return The new row matrix containing the medians
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<std::remove_const_t<DATA_TYPE>> median_columns(const MatrixView<DATA_TYPE>& view);
+
+    /** @brief Compute the median of each row of a view
+     ** @param view The view
+     ** @return The new column matrix containing the medians
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<std::remove_const_t<DATA_TYPE>> median_rows(const MatrixView<DATA_TYPE>& view);
+
+    /** @brief Compute the variance of a view
+     ** @param view The view
+     ** @param ddof The divisor used in the calculation is N - ddof, 0 by default
+     ** @return The variance
+     */
+    template <typename DATA_TYPE>
+    std::remove_const_t<DATA_TYPE> variance(const MatrixView<DATA_TYPE>& view, size_t ddof = 0);
+
+    /** @brief Compute the variance of each column of a view
+     ** @param view The view
+     ** @param ddof The divisor used in the calculation is N - ddof, 0 by default
+     ** @return The new row matrix containing the variances
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<std::remove_const_t<DATA_TYPE>> variance_columns(const MatrixView<DATA_TYPE>& view, size_t ddof = 0);
+
+    /** @brief Compute the variance of each row of a view
+     ** @param view The view
+     ** @param ddof The divisor used in the calculation is N - ddof, 0 by default
+     ** @return The new column matrix containing the variances
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<std::remove_const_t<DATA_TYPE>> variance_rows(const MatrixView<DATA_TYPE>& view, size_t ddof = 0);
+
+    /** @brief Compute the standard deviation of a view
+     ** @param view The view
+     ** @param ddof The divisor used in the calculation is N - ddof, 0 by default
+     ** @return The standard deviation
+     */
+    template <typename DATA_TYPE>
+    std::remove_const_t<DATA_TYPE> standard_deviation(const MatrixView<DATA_TYPE>& view, size_t ddof = 0);
+
+    /** @brief Compute the standard deviation of each column of a view
+     ** @param view The view
+     ** @param ddof The divisor used in the calculation is N - ddof, 0 by default
+     ** @return The new row matrix containing the standard deviations
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<std::remove_const_t<DATA_TYPE>> standard_deviation_columns(const MatrixView<DATA_TYPE>& view,
+                                                                             size_t ddof = 0);
+
+    /** @brief Compute the standard deviation of each row of a view
+     ** @param view The view
+     ** @param ddof The divisor used in the calculation is N - ddof, 0 by default
+     ** @return The new column matrix containing the standard deviations
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<std::remove_const_t<DATA_TYPE>> standard_deviation_rows(const MatrixView<DATA_TYPE>& view,
+                                                                          size_t ddof = 0);
+
+    /** @brief Compute the sum-product of a view
+     ** @param view The view
+     ** @return The sum-product
+     */
+    template <typename DATA_TYPE>
+    std::remove_const_t<DATA_TYPE> sum_product(const MatrixView<DATA_TYPE>& view);
+
+    /** @brief Compute the sum-product of each column of a view
+     ** @param view The view
+     ** @return The new row matrix containing the sum-products
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<std::remove_const_t<DATA_TYPE>> sum_product_columns(const MatrixView<DATA_TYPE>& view);
+
+    /** @brief Compute the sum-product of each row of a view
+     ** @param view The view
+     ** @return The new column matrix containing the sum-products
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<std::remove_const_t<DATA_TYPE>> sum_product_rows(const MatrixView<DATA_TYPE>& view);
+
+    /** @brief Compute the peak to peak of a view
+     ** @param view The view
+     ** @return The peak to peak
+     */
+    template <typename DATA_TYPE>
+    std::remove_const_t<DATA_TYPE> peak_to_peak(const MatrixView<DATA_TYPE>& view);
+
+    /** @brief Compute the peak to peak of each column of a view
+     ** @param view The view
+     ** @return The new row matrix containing the peak to peaks
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<std::remove_const_t<DATA_TYPE>> peak_to_peak_columns(const MatrixView<DATA_TYPE>& view);
+
+    /** @brief Compute the peak to peak of each row of a view
+     ** @param view The view
+     ** @return The new column matrix containing the peak to peaks
+     */
+    template <typename DATA_TYPE>
+    DynamicMatrix<std::remove_const_t<DATA_TYPE>> peak_to_peak_rows(const MatrixView<DATA_TYPE>& view);
+
+    /** @brief Compute the sum, min, max, mean, variance, standard deviation and peak to peak of a view in one pass
+     ** @param view The view
+     ** @param ddof The divisor used in the calculation of the variance is N - ddof, 0 by default
+     ** @return The statistics
+     */
+    template <typename DATA_TYPE>
+    ml::computation::statistic::Description<std::remove_const_t<DATA_TYPE>> describe(const MatrixView<DATA_TYPE>& view,
+                                                                                     size_t ddof = 0);
+
+    /** @brief Compute the statistics of describe of each column of a view
+     ** @param view The view
+     ** @param ddof The divisor used in the calculation of the variance is N - ddof, 0 by default
+     ** @return The new row matrices containing the statistics
+     */
+    template <typename DATA_TYPE>
+    ml::computation::statistic::Description<DynamicMatrix<std::remove_const_t<DATA_TYPE>>>
+    describe_columns(const MatrixView<DATA_TYPE>& view, size_t ddof = 0);
+
+    /** @brief Compute the statistics of describe of each row of a view
+     ** @param view The view
+     ** @param ddof The divisor used in the calculation of the variance is N - ddof, 0 by default
+     ** @return The new column matrices containing the statistics
+     */
+    template <typename DATA_TYPE>
+    ml::computation::statistic::Description<DynamicMatrix<std::remove_const_t<DATA_TYPE>>>
+    describe_rows(const MatrixView<DATA_TYPE>& view, size_t ddof = 0);
+} // namespace ml::data_structure::matrix
+
+#include "data_structure/matrix/matrix_view.hxx"
+#include "data_structure/matrix/matrix_view_multiplies_matrix.hxx"
+#include "data_structure/matrix/matrix_view_statistics.hxx"
@@ -0,0 +1,177 @@
+/**
+ ** @file src/data_structure/matrix/matrix_view.hxx
+ ** @brief Constructors and accessors of ml::data_structure::matrix::MatrixView
+ */
+
+#include <functional>
+#include <stdexcept>
+
+namespace ml::data_structure::matrix
+{
+    template <typename DATA_TYPE>
+    MatrixView<DATA_TYPE>::MatrixView()
+        : data_(nullptr)
+        , height_(0)
+        , width_(0)
+        , row_stride_(0)
+        , column_stride_(0)
+    {}
+
+    template <typename DATA_TYPE>
+    MatrixView<DATA_TYPE>::MatrixView(
+        DATA_TYPE* data, size_t height, size_t width, ptrdiff_t row_stride, ptrdiff_t column_stride)
+        : data_(data)
+        , height_(height)
+        , width_(width)
+        , row_stride_(row_stride)
+        , column_stride_(column_stride)
+    {}
+
+    template <typename DATA_TYPE>
+    template <typename OTHER_TYPE, typename>
+    MatrixView<DATA_TYPE>::MatrixView(const MatrixView<OTHER_TYPE>& view)
+        : data_(view.data())
+        , height_(view.get_height())
+        , width_(view.get_width())
+        , row_stride_(view.get_row_stride())
+        , column_stride_(view.get_column_stride())
+    {}
+
+    template <typename DATA_TYPE>
+    inline MatrixView<DATA_TYPE> MatrixView<DATA_TYPE>::transpose() const
+    {
+        return MatrixView<DATA_TYPE>(data_, width_, height_, column_stride_, row_stride_);
+    }
+
+    template <typename DATA_TYPE>
+    inline MatrixView<DATA_TYPE>
+    MatrixView<DATA_TYPE>::block(size_t height_index, size_t width_index, size_t height, size_t width) const
+    {
+        if (height_index > height_ || height > height_ - height_index)
+            throw std::out_of_range("height_index out of range");
+        if (width_index > width_ || width > width_ - width_index)
+            throw std::out_of_range("width_index out of range");
+
+        return MatrixView<DATA_TYPE>(data_ + static_cast<ptrdiff_t>(height_index) * row_stride_
+                                         + static_cast<ptrdiff_t>(width_index) * column_stride_,
+                                     height,
+                                     width,
+                                     row_stride_,
+                                     column_stride_);
+    }
+
+    template <typename DATA_TYPE>
+    inline MatrixView<DATA_TYPE> MatrixView<DATA_TYPE>::row(size_t height_index) const
+    {
+        return block(height_index, 0, 1, width_);
+    }
+
+    template <typename DATA_TYPE>
+    inline MatrixView<DATA_TYPE> MatrixView<DATA_TYPE>::column(size_t width_index) const
+    {
+        return block(0, width_index, height_, 1);
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE& MatrixView<DATA_TYPE>::operator()(size_t height_index, size_t width_index) const
+    {
+        return data_[static_cast<ptrdiff_t>(height_index) * row_stride_
+                     + static_cast<ptrdiff_t>(width_index) * column_stride_];
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE& MatrixView<DATA_TYPE>::at(size_t height_index, size_t width_index) const
+    {
+        if (height_index >= height_)
+            throw std::out_of_range("height_index out of range");
+        if (width_index >= width_)
+            throw std::out_of_range("width_index out of range");
+
+        return (*this)(height_index, width_index);
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE& MatrixView<DATA_TYPE>::get_broadcast_value(size_t height_index, size_t width_index) const
+    {
+        if (height_ == 1)
+            height_index = 0;
+        if (width_ == 1)
+            width_index = 0;
+
+        return (*this)(height_index, width_index);
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE& MatrixView<DATA_TYPE>::get_flat_value(size_t index) const
+    {
+        return data_[index];
+    }
+
+    template <typename DATA_TYPE>
+    inline DATA_TYPE* MatrixView<DATA_TYPE>::data() const
+    {
+        return data_;
+    }
+
+    template <typename DATA_TYPE>
+    inline size_t MatrixView<DATA_TYPE>::get_height() const
+    {
+        return height_;
+    }
+
+    template <typename DATA_TYPE>
+    inline size_t MatrixView<DATA_TYPE>::get_width() const
+    {
+        return width_;
+    }
+
+    template <typename DATA_TYPE>
+    inline ptrdiff_t MatrixView<DATA_TYPE>::get_row_stride() const
+    {
+        return row_stride_;
+    }
+
+    template <typename DATA_TYPE>
+    inline ptrdiff_t MatrixView<DATA_TYPE>::get_column_stride() const
+    {
+        return column_stride_;
+    }
+
+    template <typename DATA_TYPE>
+    inline bool MatrixView<DATA_TYPE>::is_contiguous() const
+    {
+        // The stride of a dimension of size one is never used
+        return (width_ <= 1 || column_stride_ == 1)
+               && (height_ <= 1 || row_stride_ == static_cast<ptrdiff_t>(width_));
+    }
+
+    template <typename DATA_TYPE>
+    inline bool MatrixView<DATA_TYPE>::is_broadcasting() const
+    {
+        return !is_contiguous();
+    }
+
+    template <typename DATA_TYPE>
+    bool MatrixView<DATA_TYPE>::is_aliasing(const data_type_t* begin, const data_type_t* end) const
+    {
+        if (height_ == 0 || width_ == 0)
+            return false;
+
+        const data_type_t* first = data_;
+        const data_type_t* last = data_;
+        const ptrdiff_t height_extent = static_cast<ptrdiff_t>(height_ - 1) * row_stride_;
+        const ptrdiff_t width_extent = static_cast<ptrdiff_t>(width_ - 1) * column_stride_;
+
+        (height_extent < 0 ? first : last) += height_extent;
+        (width_extent < 0 ? first : last) += width_extent;
+
+        // The range and the view may come from different buffers, std::less gives a total order over pointers
+        return std::less<const data_type_t*>()(first, end) && !std::less<const data_type_t*>()(last, begin);
+    }
+
+    template <typename DATA_TYPE>
+    inline typename MatrixView<DATA_TYPE>::matrix_t MatrixView<DATA_TYPE>::evaluate() const
+    {
+        return matrix_t(*this);
+    }
+} // namespace ml::data_structure::matrix
@@ -0,0 +1,43 @@
+/**
+ ** @file src/data_structure/matrix/matrix_view_multiplies_matrix.hxx
+ ** @brief Multiplies Matrix implementations for ml::data_structure::matrix::MatrixView
+ */
+
+#include <stdexcept>
+
+#include "computation/gemm.hh"
+
+namespace ml::data_structure::matrix
+{
+    template <typename LHS_TYPE, typename RHS_TYPE>
+    DynamicMatrix<std::remove_const_t<LHS_TYPE>> multiplies_matrix(const MatrixView<LHS_TYPE>& lhs,
+                                                                   const MatrixView<RHS_TYPE>& rhs)
+    {
+        static_assert(std::is_same_v<std::remove_const_t<LHS_TYPE>, std::remove_const_t<RHS_TYPE>>,
+                      "The views must have the same data type");
+
+        if (lhs.get_width() != rhs.get_height())
+            throw std::invalid_argument("The matrix are not compatible");
+
+        const size_t m = lhs.get_height();
+        const size_t n = lhs.get_width();
+        const size_t p = rhs.get_width();
+
+        DynamicMatrix<std::remove_const_t<LHS_TYPE>> new_matrix(m, p);
+
+        // The packing of the blocked kernel reads the operands through their strides, a view is never copied
+        ml::computation::gemm::multiply<std::remove_const_t<LHS_TYPE>>(m,
+                                                                       n,
+                                                                       p,
+                                                                       lhs.data(),
+                                                                       lhs.get_row_stride(),
+                                                                       lhs.get_column_stride(),
+                                                                       rhs.data(),
+                                                                       rhs.get_row_stride(),
+                                                                       rhs.get_column_stride(),
+                                                                       new_matrix.data().data(),
+                                                                       p);
+
+        return new_matrix;
+    }
+} // namespace ml::data_structure::matrix
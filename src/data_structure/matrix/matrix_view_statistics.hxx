@@ -0,0 +1,424 @@
+/**
+ ** @file src/data_structure/matrix/matrix_view_statistics.hxx
+ ** @brief Statistic functions implementations for ml::data_structure::matrix::MatrixView
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "computation/statistic.hh"
+#include "data_structure/iterator/strided_iterator.hh"
+
+namespace ml::data_structure::matrix
+{
+    template <typename DATA_TYPE, class Function>
+    static std::remove_const_t<DATA_TYPE> statistic(const MatrixView<DATA_TYPE>& view,
+                                                    std::vector<std::remove_const_t<DATA_TYPE>>& buffer,
+                                                    const Function& function)
+    {
+        const size_t count = view.get_height() * view.get_width();
+
+        if (view.is_contiguous())
+        {
+            const std::remove_const_t<DATA_TYPE>* data = view.data();
+            return function(data, data + count);
+        }
+
+        // A single row or column is a strided range, traversed in place with the runtime stride
+        if (view.get_height() == 1 || view.get_width() == 1)
+        {
+            using iterator_t = ml::data_structure::iterator::StridedIterator<const std::remove_const_t<DATA_TYPE>*>;
+
+            const ptrdiff_t stride = view.get_width() == 1 ? view.get_row_stride() : view.get_column_stride();
+            iterator_t begin(view.data(), stride);
+            return function(begin, begin + static_cast<ptrdiff_t>(count));
+        }
+
+        // A strided view is gathered in a contiguous buffer, reused from one row or column to the next
+        buffer.resize(count);
+        for (size_t i = 0; i < view.get_height(); i++)
+        {
+            for (size_t j = 0; j < view.get_width(); j++)
+                buffer[i * view.get_width() + j] = view(i, j);
+        }
+
+        const std::remove_const_t<DATA_TYPE>* data = buffer.data();
+        return function(data, data + count);
+    }
+
+    template <typename DATA_TYPE, class Function>
+    static std::remove_const_t<DATA_TYPE> statistic(const MatrixView<DATA_TYPE>& view, const Function& function)
+    {
+        std::vector<std::remove_const_t<DATA_TYPE>> buffer;
+        return statistic(view, buffer, function);
+    }
+
+    template <typename DATA_TYPE, class Function>
+    static DynamicMatrix<std::remove_const_t<DATA_TYPE>> statistic_columns(const MatrixView<DATA_TYPE>& view,
+                                                                           const Function& function)
+    {
+        DynamicMatrix<std::remove_const_t<DATA_TYPE>> row_matrix(1, view.get_width());
+        std::vector<std::remove_const_t<DATA_TYPE>> buffer;
+
+        for (size_t j = 0; j < view.get_width(); j++)
+            row_matrix(0, j) = statistic(view.column(j), buffer, function);
+
+        return row_matrix;
+    }
+
+    template <typename DATA_TYPE, class Kernel, class Function>
+    static DynamicMatrix<std::remove_const_t<DATA_TYPE>>
+    reduce_columns(const MatrixView<DATA_TYPE>& view, const Kernel& kernel, const Function& function)
+    {
+        // The rows must be contiguous to be swept, the columns of a transposed view are contiguous themselves
+        if (view.get_width() > 1 && view.get_column_stride() != 1)
+            return statistic_columns(view, function);
+
+        DynamicMatrix<std::remove_const_t<DATA_TYPE>> row_matrix(1, view.get_width());
+        kernel(view.get_height(),
+               view.get_width(),
+               static_cast<const std::remove_const_t<DATA_TYPE>*>(view.data()),
+               view.get_row_stride(),
+               row_matrix.data().data());
+
+        return row_matrix;
+    }
+
+    template <typename DATA_TYPE, class Function>
+    static DynamicMatrix<std::remove_const_t<DATA_TYPE>> statistic_rows(const MatrixView<DATA_TYPE>& view,
+                                                                        const Function& function)
+    {
+        DynamicMatrix<std::remove_const_t<DATA_TYPE>> column_matrix(view.get_height(), 1);
+        std::vector<std::remove_const_t<DATA_TYPE>> buffer;
+
+        for (size_t i = 0; i < view.get_height(); i++)
+            column_matrix(i, 0) = statistic(view.row(i), buffer, function);
+
+        return column_matrix;
+    }
+
+    template <typename DATA_TYPE>
+    inline std::remove_const_t<DATA_TYPE> sum(const MatrixView<DATA_TYPE>& view)
+    {
+        return statistic(view, [](const auto& begin, const auto& end) {
+            return ml::computation::statistic::sum(begin, end);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<std::remove_const_t<DATA_TYPE>> sum_columns(const MatrixView<DATA_TYPE>& view)
+    {
+        return reduce_columns(view,
+                              ml::computation::statistic::sum_columns<std::remove_const_t<DATA_TYPE>>,
+                              [](const auto& begin, const auto& end) {
+                                  return ml::computation::statistic::sum(begin, end);
+                              });
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<std::remove_const_t<DATA_TYPE>> sum_rows(const MatrixView<DATA_TYPE>& view)
+    {
+        return statistic_rows(view, [](const auto& begin, const auto& end) {
+            return ml::computation::statistic::sum(begin, end);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline std::remove_const_t<DATA_TYPE> min(const MatrixView<DATA_TYPE>& view)
+    {
+        return statistic(view, [](const auto& begin, const auto& end) {
+            return *std::min_element(begin, end);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<std::remove_const_t<DATA_TYPE>> min_columns(const MatrixView<DATA_TYPE>& view)
+    {
+        return reduce_columns(view,
+                              ml::computation::statistic::min_columns<std::remove_const_t<DATA_TYPE>>,
+                              [](const auto& begin, const auto& end) { return *std::min_element(begin, end); });
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<std::remove_const_t<DATA_TYPE>> min_rows(const MatrixView<DATA_TYPE>& view)
+    {
+        return statistic_rows(view, [](const auto& begin, const auto& end) {
+            return *std::min_element(begin, end);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline std::remove_const_t<DATA_TYPE> max(const MatrixView<DATA_TYPE>& view)
+    {
+        return statistic(view, [](const auto& begin, const auto& end) {
+            return *std::max_element(begin, end);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<std::remove_const_t<DATA_TYPE>> max_columns(const MatrixView<DATA_TYPE>& view)
+    {
+        return reduce_columns(view,
+                              ml::computation::statistic::max_columns<std::remove_const_t<DATA_TYPE>>,
+                              [](const auto& begin, const auto& end) { return *std::max_element(begin, end); });
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<std::remove_const_t<DATA_TYPE>> max_rows(const MatrixView<DATA_TYPE>& view)
+    {
+        return statistic_rows(view, [](const auto& begin, const auto& end) {
+            return *std::max_element(begin, end);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline std::remove_const_t<DATA_TYPE> mean(const MatrixView<DATA_TYPE>& view)
+    {
+        return statistic(view, [](const auto& begin, const auto& end) {
+            return ml::computation::statistic::mean(begin, end);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<std::remove_const_t<DATA_TYPE>> mean_columns(const MatrixView<DATA_TYPE>& view)
+    {
+        return reduce_columns(view,
+                              ml::computation::statistic::mean_columns<std::remove_const_t<DATA_TYPE>>,
+                              [](const auto& begin, const auto& end) {
+                                  return ml::computation::statistic::mean(begin, end);
+                              });
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<std::remove_const_t<DATA_TYPE>> mean_rows(const MatrixView<DATA_TYPE>& view)
+    {
+        return statistic_rows(view, [](const auto& begin, const auto& end) {
+            return ml::computation::statistic::mean(begin, end);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline std::remove_const_t<DATA_TYPE> median(const MatrixView<DATA_TYPE>& view)
+    {
+        return statistic(view, [](const auto& begin, const auto& end) {
+            return ml::computation::statistic::median(begin, end);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<std::remove_const_t<DATA_TYPE>> median_columns(const MatrixView<DATA_TYPE>& view)
+    {
+        std::vector<std::remove_const_t<DATA_TYPE>> buffer;
+
+        return statistic_columns(view, [&buffer](const auto& begin, const auto& end) {
+            return ml::computation::statistic::median(begin, end, buffer);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<std::remove_const_t<DATA_TYPE>> median_rows(const MatrixView<DATA_TYPE>& view)
+    {
+        std::vector<std::remove_const_t<DATA_TYPE>> buffer;
+
+        return statistic_rows(view, [&buffer](const auto& begin, const auto& end) {
+            return ml::computation::statistic::median(begin, end, buffer);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline std::remove_const_t<DATA_TYPE> variance(const MatrixView<DATA_TYPE>& view, size_t ddof)
+    {
+        return statistic(view, [ddof](const auto& begin, const auto& end) {
+            return ml::computation::statistic::variance(begin, end, ddof);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<std::remove_const_t<DATA_TYPE>>
+    variance_columns(const MatrixView<DATA_TYPE>& view, size_t ddof)
+    {
+        // The rows must be contiguous to be swept, the columns of a transposed view are contiguous themselves
+        if (view.get_width() > 1 && view.get_column_stride() != 1)
+        {
+            return statistic_columns(view, [ddof](const auto& begin, const auto& end) {
+                return ml::computation::statistic::variance(begin, end, ddof);
+            });
+        }
+
+        DynamicMatrix<std::remove_const_t<DATA_TYPE>> row_matrix(1, view.get_width());
+        ml::computation::statistic::variance_columns(view.get_height(),
+                                                     view.get_width(),
+                                                     static_cast<const std::remove_const_t<DATA_TYPE>*>(view.data()),
+                                                     view.get_row_stride(),
+                                                     row_matrix.data().data(),
+                                                     ddof);
+
+        return row_matrix;
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<std::remove_const_t<DATA_TYPE>> variance_rows(const MatrixView<DATA_TYPE>& view, size_t ddof)
+    {
+        return statistic_rows(view, [ddof](const auto& begin, const auto& end) {
+            return ml::computation::statistic::variance(begin, end, ddof);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline std::remove_const_t<DATA_TYPE> standard_deviation(const MatrixView<DATA_TYPE>& view, size_t ddof)
+    {
+        return statistic(view, [ddof](const auto& begin, const auto& end) {
+            return ml::computation::statistic::standard_deviation(begin, end, ddof);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<std::remove_const_t<DATA_TYPE>>
+    standard_deviation_columns(const MatrixView<DATA_TYPE>& view, size_t ddof)
+    {
+        return variance_columns(view, ddof).apply([](const auto& value) { return std::sqrt(value); });
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<std::remove_const_t<DATA_TYPE>>
+    standard_deviation_rows(const MatrixView<DATA_TYPE>& view, size_t ddof)
+    {
+        return statistic_rows(view, [ddof](const auto& begin, const auto& end) {
+            return ml::computation::statistic::standard_deviation(begin, end, ddof);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline std::remove_const_t<DATA_TYPE> sum_product(const MatrixView<DATA_TYPE>& view)
+    {
+        return statistic(view, [](const auto& begin, const auto& end) {
+            return ml::computation::statistic::sum_product(begin, end);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<std::remove_const_t<DATA_TYPE>> sum_product_columns(const MatrixView<DATA_TYPE>& view)
+    {
+        return reduce_columns(view,
+                              ml::computation::statistic::sum_product_columns<std::remove_const_t<DATA_TYPE>>,
+                              [](const auto& begin, const auto& end) {
+                                  return ml::computation::statistic::sum_product(begin, end);
+                              });
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<std::remove_const_t<DATA_TYPE>> sum_product_rows(const MatrixView<DATA_TYPE>& view)
+    {
+        return statistic_rows(view, [](const auto& begin, const auto& end) {
+            return ml::computation::statistic::sum_product(begin, end);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline std::remove_const_t<DATA_TYPE> peak_to_peak(const MatrixView<DATA_TYPE>& view)
+    {
+        return statistic(view, [](const auto& begin, const auto& end) {
+            return ml::computation::statistic::peak_to_peak(begin, end);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<std::remove_const_t<DATA_TYPE>> peak_to_peak_columns(const MatrixView<DATA_TYPE>& view)
+    {
+        return statistic_columns(view, [](const auto& begin, const auto& end) {
+            return ml::computation::statistic::peak_to_peak(begin, end);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline DynamicMatrix<std::remove_const_t<DATA_TYPE>> peak_to_peak_rows(const MatrixView<DATA_TYPE>& view)
+    {
+        return statistic_rows(view, [](const auto& begin, const auto& end) {
+            return ml::computation::statistic::peak_to_peak(begin, end);
+        });
+    }
+
+    template <typename DATA_TYPE>
+    inline ml::computation::statistic::Description<std::remove_const_t<DATA_TYPE>>
+    describe(const MatrixView<DATA_TYPE>& view, size_t ddof)
+    {
+        if (view.is_contiguous())
+        {
+            const std::remove_const_t<DATA_TYPE>* data = view.data();
+            return ml::computation::statistic::describe(data, data + view.get_height() * view.get_width(), ddof);
+        }
+
+        const auto& matrix = view.evaluate();
+        return ml::computation::statistic::describe(matrix.data().cbegin(), matrix.data().cend(), ddof);
+    }
+
+    template <typename DATA_TYPE>
+    ml::computation::statistic::Description<DynamicMatrix<std::remove_const_t<DATA_TYPE>>>
+    describe_columns(const MatrixView<DATA_TYPE>& view, size_t ddof)
+    {
+        using data_type_t = std::remove_const_t<DATA_TYPE>;
+
+        auto description =
+            ml::computation::statistic::make_description(DynamicMatrix<data_type_t>(1, view.get_width()));
+        const data_type_t* data = view.data();
+
+        // The columns of a view with contiguous columns are the rows of its transpose, a copy is the last resort
+        if (view.get_width() <= 1 || view.get_column_stride() == 1)
+        {
+            ml::computation::statistic::describe_columns(view.get_height(),
+                                                         view.get_width(),
+                                                         data,
+                                                         view.get_row_stride(),
+                                                         ml::computation::statistic::get_data(description),
+                                                         ddof);
+        }
+        else if (view.get_height() <= 1 || view.get_row_stride() == 1)
+        {
+            ml::computation::statistic::describe_rows(view.get_width(),
+                                                      view.get_height(),
+                                                      data,
+                                                      view.get_column_stride(),
+                                                      ml::computation::statistic::get_data(description),
+                                                      ddof);
+        }
+        else
+            return describe_columns(view.evaluate().view(), ddof);
+
+        return description;
+    }
+
+    template <typename DATA_TYPE>
+    ml::computation::statistic::Description<DynamicMatrix<std::remove_const_t<DATA_TYPE>>>
+    describe_rows(const MatrixView<DATA_TYPE>& view, size_t ddof)
+    {
+        using data_type_t = std::remove_const_t<DATA_TYPE>;
+
+        auto description =
+            ml::computation::statistic::make_description(DynamicMatrix<data_type_t>(view.get_height(), 1));
+        const data_type_t* data = view.data();
+
+        if (view.get_width() <= 1 || view.get_column_stride() == 1)
+        {
+            ml::computation::statistic::describe_rows(view.get_height(),
+                                                      view.get_width(),
+                                                      data,
+                                                      view.get_row_stride(),
+                                                      ml::computation::statistic::get_data(description),
+                                                      ddof);
+        }
+        else if (view.get_height() <= 1 || view.get_row_stride() == 1)
+        {
+            ml::computation::statistic::describe_columns(view.get_width(),
+                                                         view.get_height(),
+                                                         data,
+                                                         view.get_column_stride(),
+                                                         ml::computation::statistic::get_data(description),
+                                                         ddof);
+        }
+        else
+            return describe_rows(view.evaluate().view(), ddof);
+
+        return description;
+    }
+} // namespace ml::data_structure::matrix
@@ -0,0 +1,83 @@
+/**
+ ** @file src/data_structure/memory/aligned_allocator.hh
+ ** @brief Declaration of ml::data_structure::memory::AlignedAllocator
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace ml::data_structure::memory
+{
+    /// Default alignment used for the heap buffers, a cache line and a full AVX-512 register
+    constexpr size_t DEFAULT_ALIGNMENT = 64;
+
+    /// Allocator returning memory aligned on ALIGNMENT bytes, meet the requirements of an Allocator
+    template <typename T, size_t ALIGNMENT = DEFAULT_ALIGNMENT>
+    class AlignedAllocator
+    {
+    public:
+        static_assert(ALIGNMENT >= alignof(T), "The alignment must be at least the alignment of the type");
+        static_assert((ALIGNMENT & (ALIGNMENT - 1)) == 0, "The alignment must be a power of two");
+
+        /// Allocated value type
+        using value_type = T;
+
+        /// Rebind the allocator to another type
+        template <typename U>
+        struct rebind
+        {
+            /// The rebound allocator type
+            using other = AlignedAllocator<U, ALIGNMENT>;
+        };
+
+        /** @name Constructors
+         ** \{ */
+
+        /// Instantiate a new allocator
+        AlignedAllocator() = default;
+
+        /** @brief Instantiate a new allocator from an allocator of another type
+         ** @param other The other allocator
+         */
+        template <typename U>
+        AlignedAllocator(const AlignedAllocator<U, ALIGNMENT>& other);
+
+        /** \} */
+
+        /** @name Allocation
+         ** \{ */
+
+        /** @brief Allocate an aligned buffer
+         ** @param count The number of elements
+         ** @return The pointer to the first element
+         */
+        T* allocate(size_t count);
+
+        /** @brief Deallocate a buffer previously returned by allocate
+         ** @param pointer The pointer to the first element
+         ** @param count The number of elements
+         */
+        void deallocate(T* pointer, size_t count);
+
+        /** \} */
+    };
+
+    /** @brief Equal operator, every aligned allocator can free the memory of the others
+     ** @param lhs The allocator at the left of the operator
+     ** @param rhs The allocator at the right of the operator
+     ** @return Always true
+     */
+    template <typename T, typename U, size_t ALIGNMENT>
+    bool operator==(const AlignedAllocator<T, ALIGNMENT>& lhs, const AlignedAllocator<U, ALIGNMENT>& rhs);
+
+    /** @brief Not equal operator
+     ** @param lhs The allocator at the left of the operator
+     ** @param rhs The allocator at the right of the operator
+     ** @return Always false
+     */
+    template <typename T, typename U, size_t ALIGNMENT>
+    bool operator!=(const AlignedAllocator<T, ALIGNMENT>& lhs, const AlignedAllocator<U, ALIGNMENT>& rhs);
+} // namespace ml::data_structure::memory
+
+#include "data_structure/memory/aligned_allocator.hxx"
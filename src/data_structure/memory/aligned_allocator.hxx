@@ -0,0 +1,42 @@
+/**
+ ** @file src/data_structure/memory/aligned_allocator.hxx
+ ** @brief Implementation of ml::data_structure::memory::AlignedAllocator
+ */
+
+#include <limits>
+#include <new>
+
+namespace ml::data_structure::memory
+{
+    template <typename T, size_t ALIGNMENT>
+    template <typename U>
+    inline AlignedAllocator<T, ALIGNMENT>::AlignedAllocator(const AlignedAllocator<U, ALIGNMENT>&)
+    {}
+
+    template <typename T, size_t ALIGNMENT>
+    inline T* AlignedAllocator<T, ALIGNMENT>::allocate(size_t count)
+    {
+        if (count > std::numeric_limits<size_t>::max() / sizeof(T))
+            throw std::bad_array_new_length();
+
+        return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(ALIGNMENT)));
+    }
+
+    template <typename T, size_t ALIGNMENT>
+    inline void AlignedAllocator<T, ALIGNMENT>::deallocate(T* pointer, size_t)
+    {
+        ::operator delete(pointer, std::align_val_t(ALIGNMENT));
+    }
+
+    template <typename T, typename U, size_t ALIGNMENT>
+    inline bool operator==(const AlignedAllocator<T, ALIGNMENT>&, const AlignedAllocator<U, ALIGNMENT>&)
+    {
+        return true;
+    }
+
+    template <typename T, typename U, size_t ALIGNMENT>
+    inline bool operator!=(const AlignedAllocator<T, ALIGNMENT>&, const AlignedAllocator<U, ALIGNMENT>&)
+    {
+        return false;
+    }
+} // namespace ml::data_structure::memory
@@ -0,0 +1,39 @@
+/**
+ ** @file src/generator/generator.hh
+ ** @brief Declaration of the ml::generator traits and functions
+ */
+
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+namespace ml::generator
+{
+    /// Whether Generator fills a whole range of DATA_TYPE with a member fill(DATA_TYPE* begin, DATA_TYPE* end)
+    template <class Generator, typename DATA_TYPE, typename = void>
+    struct is_block_generator : std::false_type
+    {};
+
+    template <class Generator, typename DATA_TYPE>
+    struct is_block_generator<
+        Generator,
+        DATA_TYPE,
+        std::void_t<decltype(std::declval<Generator&>().fill(std::declval<DATA_TYPE*>(), std::declval<DATA_TYPE*>()))>>
+        : std::true_type
+    {};
+
+    template <class Generator, typename DATA_TYPE>
+    constexpr bool is_block_generator_v = is_block_generator<Generator, DATA_TYPE>::value;
+
+    /** @brief Fill a range with the values of a copy of a generator, as std::generate does
+     ** @details A block generator fills the whole range at once, any other generator is called for each element
+     ** @param begin The first element
+     ** @param end The element after the last one
+     ** @param generator The generator, copied
+     */
+    template <typename DATA_TYPE, class Generator>
+    void generate(DATA_TYPE* begin, DATA_TYPE* end, const Generator& generator);
+} // namespace ml::generator
+
+#include "generator/generator.hxx"
@@ -0,0 +1,23 @@
+/**
+ ** @file src/generator/generator.hxx
+ ** @brief Implementation of the ml::generator functions
+ */
+
+#include <algorithm>
+
+namespace ml::generator
+{
+    template <typename DATA_TYPE, class Generator>
+    void generate(DATA_TYPE* begin, DATA_TYPE* end, const Generator& generator)
+    {
+        if constexpr (is_block_generator_v<Generator, DATA_TYPE>)
+        {
+            Generator block_generator = generator;
+            block_generator.fill(begin, end);
+        }
+        else
+        {
+            std::generate(begin, end, generator);
+        }
+    }
+} // namespace ml::generator
@@ -0,0 +1,57 @@
+/**
+ ** @file src/generator/random/bernoulli_random.hh
+ ** @brief Declaration of ml::generator::random::BernoulliRandom
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "generator/random/block_random.hh"
+
+namespace ml::generator::random
+{
+    /** @brief Bernoulli Distribution Random generator, of the 0 and 1 of the dropout masks
+     ** @details A value is 1 when a word of a Philox engine is below the probability scaled to 2^32, the values are
+     ** made in vectorised blocks by BlockRandom
+     */
+    template <typename T>
+    class BernoulliRandom : public BlockRandom<BernoulliRandom<T>, T, 1>
+    {
+    public:
+        /** @name Constructors
+         ** \{ */
+
+        /** @brief Instantiate a new random generator, seeded by random_seed
+         ** @param probability The probability of a 1
+         ** @throw std::invalid_argument If the probability is not in [0, 1]
+         */
+        explicit BernoulliRandom(double probability);
+
+        /** @brief Instantiate a new reproducible random generator
+         ** @param probability The probability of a 1
+         ** @param seed The seed of the sequence
+         ** @param stream The stream of the sequence among the ones of the seed
+         ** @throw std::invalid_argument If the probability is not in [0, 1]
+         */
+        BernoulliRandom(double probability, uint64_t seed, uint64_t stream = 0);
+
+        /** \} */
+
+    private:
+        friend class BlockRandom<BernoulliRandom<T>, T, 1>;
+
+        /** @brief Convert the words of count values to random numbers
+         ** @param words The words, one a value
+         ** @param count The number of values
+         ** @param values The destination of the values
+         */
+        void convert(const uint32_t* words, size_t count, T* values) const;
+
+        /// The words below the threshold make a 1, the probability times 2^32
+        uint64_t threshold_;
+    };
+} // namespace ml::generator::random
+
+#include "generator/random/bernoulli_random.hxx"
@@ -0,0 +1,38 @@
+/**
+ ** @file generator/random/bernoulli_random.hxx
+ ** @brief Inline methods of ml::generator::random::BernoulliRandom
+ */
+
+#include <cmath>
+#include <stdexcept>
+
+#include "computation/simd.hh"
+
+namespace ml::generator::random
+{
+    template <typename T>
+    BernoulliRandom<T>::BernoulliRandom(double probability)
+        : BernoulliRandom(probability, random_seed())
+    {}
+
+    template <typename T>
+    BernoulliRandom<T>::BernoulliRandom(double probability, uint64_t seed, uint64_t stream)
+        : BernoulliRandom::BlockRandom(seed, stream)
+    {
+        if (!(probability >= 0 && probability <= 1))
+            throw std::invalid_argument("The probability is not in [0, 1]");
+
+        this->threshold_ = static_cast<uint64_t>(std::ldexp(probability, 32));
+    }
+
+    template <typename T>
+    void BernoulliRandom<T>::convert(const uint32_t* words, size_t count, T* values) const
+    {
+        const uint64_t threshold = this->threshold_;
+
+        ml::computation::simd::dispatch([&]() {
+            for (size_t i = 0; i < count; i++)
+                values[i] = static_cast<T>(words[i] < threshold);
+        });
+    }
+} // namespace ml::generator::random
@@ -0,0 +1,104 @@
+/**
+ ** @file src/generator/random/block_random.hh
+ ** @brief Declaration of ml::generator::random::BlockRandom
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "generator/random/philox.hh"
+
+namespace ml::generator::random
+{
+    /// The number of words of the engine making a fraction of T, one for a float and two for a double
+    template <typename T>
+    constexpr size_t FRACTION_WORD_COUNT = (sizeof(T) > sizeof(uint32_t)) ? 2 : 1;
+
+    /** @brief Base of the random generators converting the words of a Philox engine to values in blocks
+     ** @details The values are made in groups of GROUP_SIZE from WORD_COUNT words each, the group at a position
+     ** only depends on the seed, the stream and the position. fill generates the same values as the calls to the
+     ** operator, in blocks and split between the threads of the shared pool for a large range, up to the last bits of
+     ** the vector versions of the mathematical functions when the conversion uses them. Derived provides
+     ** convert(const uint32_t* words, size_t count, T* values) const, making count values from WORD_COUNT * count
+     ** words, count a multiple of GROUP_SIZE.
+     */
+    template <class Derived, typename T, size_t WORD_COUNT, size_t GROUP_SIZE = 1>
+    class BlockRandom
+    {
+    public:
+        /** @name Operators
+         ** \{ */
+
+        /** @brief Generate a new random number
+         ** @return The random number
+         */
+        T operator()();
+
+        /** \} */
+
+        /** @name Generation
+         ** \{ */
+
+        /** @brief Fill a range with the next random numbers
+         ** @param begin The first element
+         ** @param end The element after the last one
+         */
+        void fill(T* begin, T* end);
+
+        /** @brief Skip random numbers in constant time
+         ** @param count The number of random numbers
+         */
+        void discard(uint64_t count);
+
+        /** @brief Instantiate a generator of the same parameters and seed on another stream
+         ** @param stream The stream of the new generator
+         ** @return The generator, at the start of its sequence
+         */
+        Derived split(uint64_t stream) const;
+
+        /** \} */
+
+        /** @name Accessors
+         ** \{ */
+
+        /** @brief Get the seed of the generator, to generate the same numbers again
+         ** @return The seed
+         */
+        uint64_t get_seed() const;
+
+        /** @brief Get the stream of the generator
+         ** @return The stream
+         */
+        uint64_t get_stream() const;
+
+        /** \} */
+
+    protected:
+        /** @brief Instantiate the engine of a generator
+         ** @param seed The seed of the sequence
+         ** @param stream The stream of the sequence among the ones of the seed
+         */
+        BlockRandom(uint64_t seed, uint64_t stream);
+
+        /** @brief Convert the first words of a value to a fraction
+         ** @param words The FRACTION_WORD_COUNT<T> words
+         ** @return The fraction in [0, 1), every value exactly representable in T
+         */
+        static T fraction(const uint32_t* words);
+
+    private:
+        /** @brief Generate whole groups, in parallel for a large number of groups
+         ** @param first_group The index of the first group in the sequence
+         ** @param group_count The number of groups
+         ** @param values The destination of the GROUP_SIZE * group_count values
+         */
+        void generate_groups(uint64_t first_group, size_t group_count, T* values) const;
+
+        /// The random engine
+        Philox random_engine_;
+    };
+} // namespace ml::generator::random
+
+#include "generator/random/block_random.hxx"
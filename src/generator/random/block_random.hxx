@@ -0,0 +1,141 @@
+/**
+ ** @file generator/random/block_random.hxx
+ ** @brief Inline methods of ml::generator::random::BlockRandom
+ */
+
+#include <algorithm>
+#include <array>
+
+#include "parallel/thread_pool.hh"
+
+namespace ml::generator::random
+{
+    template <class Derived, typename T, size_t WORD_COUNT, size_t GROUP_SIZE>
+    BlockRandom<Derived, T, WORD_COUNT, GROUP_SIZE>::BlockRandom(uint64_t seed, uint64_t stream)
+        : random_engine_(seed, stream)
+    {}
+
+    template <class Derived, typename T, size_t WORD_COUNT, size_t GROUP_SIZE>
+    T BlockRandom<Derived, T, WORD_COUNT, GROUP_SIZE>::operator()()
+    {
+        T value;
+
+        // A value of a group alone draws its words from the block cached by the engine
+        if constexpr (GROUP_SIZE == 1)
+        {
+            std::array<uint32_t, WORD_COUNT> words;
+            for (auto& word : words)
+                word = this->random_engine_();
+
+            static_cast<const Derived&>(*this).convert(words.data(), 1, &value);
+        }
+        else
+        {
+            this->fill(&value, &value + 1);
+        }
+
+        return value;
+    }
+
+    template <class Derived, typename T, size_t WORD_COUNT, size_t GROUP_SIZE>
+    void BlockRandom<Derived, T, WORD_COUNT, GROUP_SIZE>::fill(T* begin, T* end)
+    {
+        auto count = static_cast<size_t>(end - begin);
+        const uint64_t position = this->random_engine_.get_position() / WORD_COUNT;
+        this->random_engine_.set_position((position + count) * WORD_COUNT);
+
+        // The groups cut by the ends of the range are generated whole on the stack
+        std::array<T, GROUP_SIZE> group;
+        uint64_t group_index = position / GROUP_SIZE;
+
+        const size_t offset = position % GROUP_SIZE;
+        if (offset != 0 && count != 0)
+        {
+            this->generate_groups(group_index++, 1, group.data());
+
+            const size_t head = std::min(GROUP_SIZE - offset, count);
+            std::copy(group.data() + offset, group.data() + offset + head, begin);
+            begin += head;
+            count -= head;
+        }
+
+        const size_t group_count = count / GROUP_SIZE;
+        this->generate_groups(group_index, group_count, begin);
+
+        const size_t tail = count % GROUP_SIZE;
+        if (tail != 0)
+        {
+            this->generate_groups(group_index + group_count, 1, group.data());
+            std::copy(group.data(), group.data() + tail, begin + group_count * GROUP_SIZE);
+        }
+    }
+
+    template <class Derived, typename T, size_t WORD_COUNT, size_t GROUP_SIZE>
+    void BlockRandom<Derived, T, WORD_COUNT, GROUP_SIZE>::discard(uint64_t count)
+    {
+        this->random_engine_.discard(count * WORD_COUNT);
+    }
+
+    template <class Derived, typename T, size_t WORD_COUNT, size_t GROUP_SIZE>
+    Derived BlockRandom<Derived, T, WORD_COUNT, GROUP_SIZE>::split(uint64_t stream) const
+    {
+        Derived generator = static_cast<const Derived&>(*this);
+        static_cast<BlockRandom&>(generator).random_engine_ = this->random_engine_.split(stream);
+        return generator;
+    }
+
+    template <class Derived, typename T, size_t WORD_COUNT, size_t GROUP_SIZE>
+    uint64_t BlockRandom<Derived, T, WORD_COUNT, GROUP_SIZE>::get_seed() const
+    {
+        return this->random_engine_.get_key();
+    }
+
+    template <class Derived, typename T, size_t WORD_COUNT, size_t GROUP_SIZE>
+    uint64_t BlockRandom<Derived, T, WORD_COUNT, GROUP_SIZE>::get_stream() const
+    {
+        return this->random_engine_.get_stream();
+    }
+
+    template <class Derived, typename T, size_t WORD_COUNT, size_t GROUP_SIZE>
+    inline T BlockRandom<Derived, T, WORD_COUNT, GROUP_SIZE>::fraction(const uint32_t* words)
+    {
+        // The upper bits of the words, as many as the mantissa of T holds
+        if constexpr (FRACTION_WORD_COUNT<T> == 1)
+        {
+            return static_cast<T>(static_cast<int32_t>(words[0] >> 8)) * static_cast<T>(0x1p-24);
+        }
+        else
+        {
+            const uint64_t bits = (static_cast<uint64_t>(words[0]) << 32) | words[1];
+            return static_cast<T>(static_cast<int64_t>(bits >> 11)) * static_cast<T>(0x1p-53);
+        }
+    }
+
+    template <class Derived, typename T, size_t WORD_COUNT, size_t GROUP_SIZE>
+    void BlockRandom<Derived, T, WORD_COUNT, GROUP_SIZE>::generate_groups(uint64_t first_group,
+                                                                          size_t group_count,
+                                                                          T* values) const
+    {
+        constexpr size_t BLOCK_GROUP_COUNT = GENERATION_BLOCK_SIZE / GROUP_SIZE;
+        constexpr size_t GROUP_WORD_COUNT = GROUP_SIZE * WORD_COUNT;
+
+        const auto generate_chunk = [&](size_t chunk_begin, size_t chunk_end) {
+            std::array<uint32_t, BLOCK_GROUP_COUNT * GROUP_WORD_COUNT> words;
+
+            for (size_t block_begin = chunk_begin; block_begin < chunk_end; block_begin += BLOCK_GROUP_COUNT)
+            {
+                const size_t block_size = std::min(BLOCK_GROUP_COUNT, chunk_end - block_begin);
+                const uint64_t block_position = (first_group + block_begin) * GROUP_WORD_COUNT;
+
+                this->random_engine_.generate(block_position, words.data(), block_size * GROUP_WORD_COUNT);
+                static_cast<const Derived&>(*this).convert(
+                    words.data(), block_size * GROUP_SIZE, values + block_begin * GROUP_SIZE);
+            }
+        };
+
+        if (group_count * GROUP_SIZE < PARALLEL_GENERATION_SIZE || ml::parallel::get_thread_count() == 1)
+            generate_chunk(0, group_count);
+        else
+            ml::parallel::get_thread_pool().parallel_for(0, group_count, BLOCK_GROUP_COUNT, generate_chunk);
+    }
+} // namespace ml::generator::random
@@ -0,0 +1,59 @@
+/**
+ ** @file src/generator/random/normal_random.hh
+ ** @brief Declaration of ml::generator::random::NormalRandom
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "generator/random/block_random.hh"
+
+namespace ml::generator::random
+{
+    /** @brief Normal Distribution Random real number generator
+     ** @details The values are made in pairs by the Box-Muller transform of two fractions drawn from a Philox
+     ** engine, in vectorised blocks by BlockRandom
+     */
+    template <typename T>
+    class NormalRandom : public BlockRandom<NormalRandom<T>, T, FRACTION_WORD_COUNT<T>, 2>
+    {
+    public:
+        /** @name Constructors
+         ** \{ */
+
+        /** @brief Instantiate a new random generator, seeded by random_seed
+         ** @param mean The mean of the distribution
+         ** @param standard_deviation The standard deviation of the distribution
+         */
+        NormalRandom(T mean, T standard_deviation);
+
+        /** @brief Instantiate a new reproducible random generator
+         ** @param mean The mean of the distribution
+         ** @param standard_deviation The standard deviation of the distribution
+         ** @param seed The seed of the sequence
+         ** @param stream The stream of the sequence among the ones of the seed
+         */
+        NormalRandom(T mean, T standard_deviation, uint64_t seed, uint64_t stream = 0);
+
+        /** \} */
+
+    private:
+        friend class BlockRandom<NormalRandom<T>, T, FRACTION_WORD_COUNT<T>, 2>;
+
+        /** @brief Convert the words of count values to random numbers
+         ** @param words The words, one or two a value
+         ** @param count The number of values, even
+         ** @param values The destination of the values
+         */
+        void convert(const uint32_t* words, size_t count, T* values) const;
+
+        /// The mean
+        T mean_;
+        /// The standard deviation
+        T standard_deviation_;
+    };
+} // namespace ml::generator::random
+
+#include "generator/random/normal_random.hxx"
@@ -0,0 +1,50 @@
+/**
+ ** @file generator/random/normal_random.hxx
+ ** @brief Inline methods of ml::generator::random::NormalRandom
+ */
+
+#include <cmath>
+
+#include "computation/simd.hh"
+
+namespace ml::generator::random
+{
+    template <typename T>
+    NormalRandom<T>::NormalRandom(T mean, T standard_deviation)
+        : NormalRandom(mean, standard_deviation, random_seed())
+    {}
+
+    template <typename T>
+    NormalRandom<T>::NormalRandom(T mean, T standard_deviation, uint64_t seed, uint64_t stream)
+        : NormalRandom::BlockRandom(seed, stream)
+        , mean_(mean)
+        , standard_deviation_(standard_deviation)
+    {}
+
+    template <typename T>
+    void NormalRandom<T>::convert(const uint32_t* words, size_t count, T* values) const
+    {
+        constexpr size_t WORD_COUNT = FRACTION_WORD_COUNT<T>;
+        constexpr T TWO_PI = static_cast<T>(6.283185307179586476925286766559);
+        constexpr T HALF_PI = static_cast<T>(1.5707963267948966192313216916398);
+        const T mean = this->mean_;
+        const T standard_deviation = this->standard_deviation_;
+
+        // Every pair is independent and branch free, so the loop is vectorised with the vector log and cos. The sine
+        // is the cosine a quarter turn later, a sin and a cos of the same angle would be merged into a sincos call,
+        // which is not vectorised
+        ml::computation::simd::dispatch([&]() {
+            for (size_t i = 0; i < count / 2; i++)
+            {
+                const T uniform_radius = static_cast<T>(1) - NormalRandom::fraction(words + 2 * i * WORD_COUNT);
+                const T uniform_angle = NormalRandom::fraction(words + (2 * i + 1) * WORD_COUNT);
+
+                const T radius = standard_deviation * std::sqrt(static_cast<T>(-2) * std::log(uniform_radius));
+                const T angle = TWO_PI * uniform_angle;
+
+                values[2 * i] = mean + radius * std::cos(angle);
+                values[2 * i + 1] = mean + radius * std::cos(angle - HALF_PI);
+            }
+        });
+    }
+} // namespace ml::generator::random
@@ -0,0 +1,162 @@
+/**
+ ** @file src/generator/random/philox.cc
+ ** @brief Implementation of ml::generator::random::Philox
+ */
+
+#include "generator/random/philox.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <random>
+
+#include "computation/simd.hh"
+
+namespace ml::generator::random
+{
+    /// The multipliers and the key increments of the rounds, from Salmon et al., Parallel random numbers: as easy as
+    /// 1, 2, 3
+    static constexpr uint64_t MULTIPLIER_0 = 0xD2511F53;
+    static constexpr uint64_t MULTIPLIER_1 = 0xCD9E8D57;
+    static constexpr uint32_t KEY_INCREMENT_0 = 0x9E3779B9;
+    static constexpr uint32_t KEY_INCREMENT_1 = 0xBB67AE85;
+    static constexpr size_t ROUND_COUNT = 10;
+
+    /// Encrypt the counters of count consecutive blocks, the blocks are independent so the loop is vectorised
+    static void generate_blocks(uint64_t key, uint64_t stream, uint64_t first_block, size_t count, uint32_t* words)
+    {
+        ml::computation::simd::dispatch([&]() {
+            for (size_t i = 0; i < count; i++)
+            {
+                const uint64_t block = first_block + i;
+                uint32_t counter_0 = static_cast<uint32_t>(block);
+                uint32_t counter_1 = static_cast<uint32_t>(block >> 32);
+                uint32_t counter_2 = static_cast<uint32_t>(stream);
+                uint32_t counter_3 = static_cast<uint32_t>(stream >> 32);
+                uint32_t key_0 = static_cast<uint32_t>(key);
+                uint32_t key_1 = static_cast<uint32_t>(key >> 32);
+
+                for (size_t round = 0; round < ROUND_COUNT; round++)
+                {
+                    const uint64_t product_0 = MULTIPLIER_0 * counter_0;
+                    const uint64_t product_1 = MULTIPLIER_1 * counter_2;
+
+                    counter_0 = static_cast<uint32_t>(product_1 >> 32) ^ counter_1 ^ key_0;
+                    counter_1 = static_cast<uint32_t>(product_1);
+                    counter_2 = static_cast<uint32_t>(product_0 >> 32) ^ counter_3 ^ key_1;
+                    counter_3 = static_cast<uint32_t>(product_0);
+
+                    key_0 += KEY_INCREMENT_0;
+                    key_1 += KEY_INCREMENT_1;
+                }
+
+                words[i * Philox::BLOCK_SIZE] = counter_0;
+                words[i * Philox::BLOCK_SIZE + 1] = counter_1;
+                words[i * Philox::BLOCK_SIZE + 2] = counter_2;
+                words[i * Philox::BLOCK_SIZE + 3] = counter_3;
+            }
+        });
+    }
+
+    /// Mix the bits of a value, the finalizer of SplitMix64, so consecutive values give unrelated seeds
+    static uint64_t mix(uint64_t value)
+    {
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+        return value ^ (value >> 31);
+    }
+
+    uint64_t random_seed()
+    {
+        static const uint64_t process_seed = []() {
+            std::random_device device;
+            return (static_cast<uint64_t>(device()) << 32) | device();
+        }();
+        static std::atomic<uint64_t> counter(0);
+
+        return mix(process_seed + counter.fetch_add(1, std::memory_order_relaxed));
+    }
+
+    Philox::Philox(uint64_t key, uint64_t stream)
+        : key_(key)
+        , stream_(stream)
+        , position_(0)
+        , block_index_(std::numeric_limits<uint64_t>::max())
+        , block_()
+    {}
+
+    Philox::result_type Philox::operator()()
+    {
+        const uint64_t block_index = this->position_ / BLOCK_SIZE;
+        if (block_index != this->block_index_)
+        {
+            generate_blocks(this->key_, this->stream_, block_index, 1, this->block_.data());
+            this->block_index_ = block_index;
+        }
+
+        return this->block_[this->position_++ % BLOCK_SIZE];
+    }
+
+    void Philox::generate(result_type* words, size_t count)
+    {
+        this->generate(this->position_, words, count);
+        this->position_ += count;
+    }
+
+    void Philox::generate(uint64_t position, result_type* words, size_t count) const
+    {
+        // The whole blocks are written in place, the partial ones at both ends through a block on the stack
+        std::array<result_type, BLOCK_SIZE> block;
+
+        const size_t offset = position % BLOCK_SIZE;
+        if (offset != 0 && count != 0)
+        {
+            generate_blocks(this->key_, this->stream_, position / BLOCK_SIZE, 1, block.data());
+
+            const size_t head = std::min(BLOCK_SIZE - offset, count);
+            std::copy(block.data() + offset, block.data() + offset + head, words);
+            position += head;
+            words += head;
+            count -= head;
+        }
+
+        const size_t block_count = count / BLOCK_SIZE;
+        generate_blocks(this->key_, this->stream_, position / BLOCK_SIZE, block_count, words);
+
+        const size_t tail = count % BLOCK_SIZE;
+        if (tail != 0)
+        {
+            generate_blocks(this->key_, this->stream_, position / BLOCK_SIZE + block_count, 1, block.data());
+            std::copy(block.data(), block.data() + tail, words + block_count * BLOCK_SIZE);
+        }
+    }
+
+    void Philox::discard(uint64_t count)
+    {
+        this->position_ += count;
+    }
+
+    Philox Philox::split(uint64_t stream) const
+    {
+        return Philox(this->key_, stream);
+    }
+
+    uint64_t Philox::get_position() const
+    {
+        return this->position_;
+    }
+
+    void Philox::set_position(uint64_t position)
+    {
+        this->position_ = position;
+    }
+
+    uint64_t Philox::get_key() const
+    {
+        return this->key_;
+    }
+
+    uint64_t Philox::get_stream() const
+    {
+        return this->stream_;
+    }
+} // namespace ml::generator::random
@@ -0,0 +1,144 @@
+/**
+ ** @file src/generator/random/philox.hh
+ ** @brief Declaration of ml::generator::random::Philox
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace ml::generator::random
+{
+    /// The number of values converted together from a buffer of words on the stack when filling a range
+    constexpr size_t GENERATION_BLOCK_SIZE = 1 << 10;
+
+    /// Below this number of values a range is filled by the calling thread only
+    constexpr size_t PARALLEL_GENERATION_SIZE = 1 << 16;
+
+    /** @brief Draw a new seed, different at every call
+     ** @details A single seed is drawn from std::random_device by the process, the following ones are derived from
+     ** it and a counter, so a generator seeded this way costs no system call
+     ** @return The seed
+     */
+    uint64_t random_seed();
+
+    /** @brief Philox4x32-10 counter-based random engine, meet the requirements of a UniformRandomBitGenerator
+     ** @details The word at a position of the sequence is a function of the key, the stream and the position only:
+     ** the block of four words position / 4 is the encryption of the counter {block, stream} by ten rounds keyed by
+     ** key. Any part of the sequence is generated without generating the words before it, so the threads filling
+     ** a buffer in parallel produce the same words as a single one.
+     */
+    class Philox
+    {
+    public:
+        /// The type of the generated words
+        using result_type = uint32_t;
+
+        /// The number of words of a block, generated together
+        static constexpr size_t BLOCK_SIZE = 4;
+
+        /** @name Constructors
+         ** \{ */
+
+        /** @brief Instantiate a new engine at the start of its sequence
+         ** @param key The key of the rounds, the seed of the sequence
+         ** @param stream The index of the sequence among the ones of the key, the sequences do not overlap
+         */
+        explicit Philox(uint64_t key, uint64_t stream = 0);
+
+        /** \} */
+
+        /** @name Generation
+         ** \{ */
+
+        /** @brief Generate the next word of the sequence
+         ** @return The word
+         */
+        result_type operator()();
+
+        /** @brief Generate the next words of the sequence in blocks
+         ** @param words The destination of the words
+         ** @param count The number of words
+         */
+        void generate(result_type* words, size_t count);
+
+        /** @brief Generate words anywhere in the sequence, without moving the engine
+         ** @details The function is const and thread safe, each thread generates its own part of the sequence
+         ** @param position The position of the first word in the sequence
+         ** @param words The destination of the words
+         ** @param count The number of words
+         */
+        void generate(uint64_t position, result_type* words, size_t count) const;
+
+        /** @brief Skip words of the sequence
+         ** @param count The number of words
+         */
+        void discard(uint64_t count);
+
+        /** @brief Instantiate an engine on another stream of the same key
+         ** @details The engines of the different streams of a key never generate the same part of a sequence, a
+         ** worker given its own stream draws words independent of the ones of the others
+         ** @param stream The stream of the new engine
+         ** @return The engine, at the start of its sequence
+         */
+        Philox split(uint64_t stream) const;
+
+        /** \} */
+
+        /** @name Accessors
+         ** \{ */
+
+        /** @brief Get the position of the next word in the sequence
+         ** @return The position
+         */
+        uint64_t get_position() const;
+
+        /** @brief Move the engine in the sequence
+         ** @param position The position of the next word
+         */
+        void set_position(uint64_t position);
+
+        /** @brief Get the key of the engine
+         ** @return The key
+         */
+        uint64_t get_key() const;
+
+        /** @brief Get the stream of the engine
+         ** @return The stream
+         */
+        uint64_t get_stream() const;
+
+        /** @brief Get the smallest word
+         ** @return 0
+         */
+        static constexpr result_type min()
+        {
+            return std::numeric_limits<result_type>::min();
+        }
+
+        /** @brief Get the largest word
+         ** @return 2^32 - 1
+         */
+        static constexpr result_type max()
+        {
+            return std::numeric_limits<result_type>::max();
+        }
+
+        /** \} */
+
+    private:
+        /// The key of the rounds
+        uint64_t key_;
+        /// The stream, the upper half of the counter
+        uint64_t stream_;
+        /// The position of the next word
+        uint64_t position_;
+        /// The index of the block held in block_, the next block is computed when the position leaves it
+        uint64_t block_index_;
+        /// The last block generated word by word
+        std::array<result_type, BLOCK_SIZE> block_;
+    };
+} // namespace ml::generator::random
@@ -0,0 +1,109 @@
+/**
+ ** @file src/generator/random/truncated_normal_random.hh
+ ** @brief Declaration of ml::generator::random::TruncatedNormalRandom
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "generator/random/block_random.hh"
+
+namespace ml::generator::random
+{
+    /** @brief Truncated Normal Distribution Random real number generator
+     ** @details A normal distribution restricted to [minimum, maximum]. The values are the inverse of the
+     ** cumulative distribution function at fractions drawn from a Philox engine, rather than normal values redrawn
+     ** until they fall in the range, so every value is made from its own words and fill stays reproducible whatever
+     ** the number of threads. Near the mean the inverse is the one of erf. Further in the tails, where erf rounds to
+     ** one, the fraction is mapped to the probability of the tail of the value relative to the probability of the
+     ** bound of the tail, and inverted in logarithm, so the ranges far from the mean keep their distribution.
+     */
+    template <typename T>
+    class TruncatedNormalRandom : public BlockRandom<TruncatedNormalRandom<T>, T, FRACTION_WORD_COUNT<T>>
+    {
+    public:
+        /** @name Constructors
+         ** \{ */
+
+        /** @brief Instantiate a new random generator, seeded by random_seed
+         ** @param mean The mean of the normal distribution
+         ** @param standard_deviation The standard deviation of the normal distribution
+         ** @param minimum The minimum value that the generator can generate, finite
+         ** @param maximum The maximum value that the generator can generate, finite
+         ** @throw std::invalid_argument If minimum is not lower than maximum
+         */
+        TruncatedNormalRandom(T mean, T standard_deviation, T minimum, T maximum);
+
+        /** @brief Instantiate a new reproducible random generator
+         ** @param mean The mean of the normal distribution
+         ** @param standard_deviation The standard deviation of the normal distribution
+         ** @param minimum The minimum value that the generator can generate, finite
+         ** @param maximum The maximum value that the generator can generate, finite
+         ** @param seed The seed of the sequence
+         ** @param stream The stream of the sequence among the ones of the seed
+         ** @throw std::invalid_argument If minimum is not lower than maximum
+         */
+        TruncatedNormalRandom(T mean, T standard_deviation, T minimum, T maximum, uint64_t seed, uint64_t stream = 0);
+
+        /** \} */
+
+    private:
+        friend class BlockRandom<TruncatedNormalRandom<T>, T, FRACTION_WORD_COUNT<T>>;
+
+        /** @brief Convert the words of count values to random numbers
+         ** @param words The words, one or two a value
+         ** @param count The number of values
+         ** @param values The destination of the values
+         */
+        void convert(const uint32_t* words, size_t count, T* values) const;
+
+        /// The standardised values of one side of the mean, mirrored for the lower side
+        struct Tail
+        {
+            /// The standardised value closest to the mean, non-negative
+            T start;
+            /// The standardised value furthest from the mean
+            T end;
+            /// The logarithm of the probability of the standard normal distribution above start
+            T log_probability;
+            /// The share of the probability above start which is below end
+            T shrink;
+        };
+
+        /** @brief Make the tail of the standardised values from start to end
+         ** @param start The standardised value closest to the mean, non-negative
+         ** @param end The standardised value furthest from the mean, not lower than start
+         ** @return The tail
+         */
+        static Tail make_tail(T start, T end);
+
+        /** @brief Convert a fraction to a value by the inversion of its tail
+         ** @param fraction The fraction, in [0, 1)
+         ** @return The value
+         */
+        T tail_value(T fraction) const;
+
+        /// The mean
+        T mean_;
+        /// The standard deviation
+        T standard_deviation_;
+        /// The minimum value
+        T minimum_;
+        /// The maximum value
+        T maximum_;
+        /// erf of the standardised minimum over sqrt(2), the image of the smallest fraction
+        T lower_;
+        /// The width of the images of the fractions, up to erf of the standardised maximum over sqrt(2)
+        T width_;
+        /// The standardised range below the mean, mirrored
+        Tail lower_tail_;
+        /// The standardised range above the mean
+        Tail upper_tail_;
+        /// The share of the values below the mean
+        T split_;
+    };
+} // namespace ml::generator::random
+
+#include "generator/random/truncated_normal_random.hxx"
@@ -0,0 +1,240 @@
+/**
+ ** @file generator/random/truncated_normal_random.hxx
+ ** @brief Inline methods of ml::generator::random::TruncatedNormalRandom
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "computation/simd.hh"
+
+namespace ml::generator::random
+{
+    /// The images of the central inversion stay below this magnitude, where -log(1 - image^2) is 5: further in the
+    /// tails erf rounds the image too much and the values come from the inversion of their tail
+    constexpr double TRUNCATED_NORMAL_CENTRAL_IMAGE = 0.99662542290074;
+
+    /** @brief Compute the polynomial of Giles, Approximating the erfinv function, erfinv(x) being close to p * x
+     ** @param w -log(1 - x^2)
+     ** @return The polynomial p
+     */
+    template <typename T>
+    static inline T erfinv_polynomial(T w)
+    {
+        T p;
+
+        if (w < T(5))
+        {
+            w = w - T(2.5);
+            p = T(2.81022636e-08);
+            p = T(3.43273939e-07) + p * w;
+            p = T(-3.5233877e-06) + p * w;
+            p = T(-4.39150654e-06) + p * w;
+            p = T(0.00021858087) + p * w;
+            p = T(-0.00125372503) + p * w;
+            p = T(-0.00417768164) + p * w;
+            p = T(0.246640727) + p * w;
+            p = T(1.50140941) + p * w;
+        }
+        else
+        {
+            w = std::sqrt(w) - T(3);
+            p = T(-0.000200214257);
+            p = T(0.000100950558) + p * w;
+            p = T(0.00134934322) + p * w;
+            p = T(-0.00367342844) + p * w;
+            p = T(0.00573950773) + p * w;
+            p = T(-0.0076224613) + p * w;
+            p = T(0.00943887047) + p * w;
+            p = T(1.00167406) + p * w;
+            p = T(2.83297682) + p * w;
+        }
+
+        return p;
+    }
+
+    /** @brief Compute the inverse error function
+     ** @details The approximation of Giles, refined by two Newton steps on erf for a double
+     ** @param value The value, in (-1, 1)
+     ** @return x such that erf(x) = value
+     */
+    template <typename T>
+    static inline T erfinv(T value)
+    {
+        T result = erfinv_polynomial(-std::log((T(1) - value) * (T(1) + value))) * value;
+
+        if constexpr (sizeof(T) > sizeof(float))
+        {
+            constexpr T TWO_OVER_SQRT_PI = static_cast<T>(1.1283791670955125738961589031215);
+            for (size_t step = 0; step < 2; step++)
+                result -= (std::erf(result) - value) / (TWO_OVER_SQRT_PI * std::exp(-result * result));
+        }
+
+        return result;
+    }
+
+    /** @brief Compute the logarithm of the upper tail of the standard normal distribution, log(erfc(x / sqrt(2)) / 2)
+     ** @details Far in the tail, before erfc underflows, the asymptotic series of Laplace replaces it
+     ** @param x The standardised value
+     ** @return The logarithm of the probability of a value above x
+     */
+    template <typename T>
+    static inline T normal_tail_log(T x)
+    {
+        constexpr T SQRT_1_2 = static_cast<T>(0.70710678118654752440084436210485);
+        constexpr T SQRT_2_PI = static_cast<T>(2.5066282746310005024157652848110);
+        constexpr T ASYMPTOTIC = sizeof(T) > sizeof(float) ? T(30) : T(10);
+
+        if (x < ASYMPTOTIC)
+            return std::log(std::erfc(x * SQRT_1_2) / T(2));
+
+        const T inverse = T(1) / (x * x);
+        const T series =
+            T(1) + inverse * (T(-1) + inverse * (T(3) + inverse * (T(-15) + inverse * (T(105) - inverse * T(945)))));
+        return -x * x / T(2) - std::log(x * SQRT_2_PI) + std::log(series);
+    }
+
+    /** @brief Invert normal_tail_log
+     ** @details The first guess is the approximation of Giles, or the asymptotic expansion beyond its range,
+     ** refined by Newton steps on normal_tail_log, one for a float and three for a double. The logarithm is concave,
+     ** so the steps converge from above whatever the guess.
+     ** @param log_probability The logarithm of the probability of the upper tail, at most log(1/2)
+     ** @return x such that normal_tail_log(x) = log_probability
+     */
+    template <typename T>
+    static inline T normal_tail_inverse(T log_probability)
+    {
+        constexpr T SQRT_2 = static_cast<T>(1.4142135623730950488016887242097);
+        constexpr T SQRT_2_PI = static_cast<T>(2.5066282746310005024157652848110);
+        constexpr T LOG_4 = static_cast<T>(1.3862943611198906188344642429164);
+        constexpr T LOG_2_PI = static_cast<T>(1.8378770664093454835606594728112);
+        constexpr size_t STEP_COUNT = sizeof(T) > sizeof(float) ? 3 : 1;
+
+        // erfc(x / sqrt(2)) = 2 * probability, so w of Giles is -log(4 * probability * (1 - probability))
+        const T probability = std::exp(log_probability);
+        const T w = -(LOG_4 + log_probability + std::log1p(-probability));
+
+        T x;
+        if (w < T(16))
+        {
+            x = SQRT_2 * erfinv_polynomial(w) * (T(1) - T(2) * probability);
+        }
+        else
+        {
+            // x^2 = -2 * log_probability - log(2 * pi) - log(x^2), iterated twice
+            const T base = T(-2) * log_probability - LOG_2_PI;
+            x = std::sqrt(base - std::log(base - std::log(base)));
+        }
+
+        for (size_t step = 0; step < STEP_COUNT; step++)
+        {
+            const T log_tail = normal_tail_log(x);
+            x += (log_tail - log_probability) * SQRT_2_PI * std::exp(x * x / T(2) + log_tail);
+        }
+
+        return x;
+    }
+
+    template <typename T>
+    TruncatedNormalRandom<T>::TruncatedNormalRandom(T mean, T standard_deviation, T minimum, T maximum)
+        : TruncatedNormalRandom(mean, standard_deviation, minimum, maximum, random_seed())
+    {}
+
+    template <typename T>
+    TruncatedNormalRandom<T>::TruncatedNormalRandom(
+        T mean, T standard_deviation, T minimum, T maximum, uint64_t seed, uint64_t stream)
+        : TruncatedNormalRandom::BlockRandom(seed, stream)
+        , mean_(mean)
+        , standard_deviation_(standard_deviation)
+        , minimum_(minimum)
+        , maximum_(maximum)
+    {
+        if (!(minimum < maximum))
+            throw std::invalid_argument("The minimum is not lower than the maximum");
+
+        constexpr T SQRT_2 = static_cast<T>(1.4142135623730950488016887242097);
+        this->lower_ = std::erf((minimum - mean) / (standard_deviation * SQRT_2));
+        this->width_ = std::erf((maximum - mean) / (standard_deviation * SQRT_2)) - this->lower_;
+
+        // The values below the mean are the ones of the upper tail of the mirrored range
+        const T low = (minimum - mean) / standard_deviation;
+        const T high = (maximum - mean) / standard_deviation;
+        this->lower_tail_ = make_tail(std::max(-high, T(0)), std::max(-low, T(0)));
+        this->upper_tail_ = make_tail(std::max(low, T(0)), std::max(high, T(0)));
+
+        if (high <= T(0))
+        {
+            this->split_ = 1;
+        }
+        else if (low >= T(0))
+        {
+            this->split_ = 0;
+        }
+        else
+        {
+            const T lower_mass = T(0.5) - std::exp(normal_tail_log(-low));
+            const T upper_mass = T(0.5) - std::exp(normal_tail_log(high));
+            this->split_ = lower_mass / (lower_mass + upper_mass);
+        }
+    }
+
+    template <typename T>
+    typename TruncatedNormalRandom<T>::Tail TruncatedNormalRandom<T>::make_tail(T start, T end)
+    {
+        const T log_probability = normal_tail_log(start);
+        return Tail{start, end, log_probability, -std::expm1(normal_tail_log(end) - log_probability)};
+    }
+
+    template <typename T>
+    void TruncatedNormalRandom<T>::convert(const uint32_t* words, size_t count, T* values) const
+    {
+        constexpr size_t WORD_COUNT = FRACTION_WORD_COUNT<T>;
+        constexpr T SQRT_2 = static_cast<T>(1.4142135623730950488016887242097);
+        const T mean = this->mean_;
+        const T scale = this->standard_deviation_ * SQRT_2;
+        const T minimum = this->minimum_;
+        const T maximum = this->maximum_;
+        const T lower = this->lower_;
+        const T width = this->width_;
+
+        // The clamp keeps the rounding of the inverse in the range, the images clamped here are computed again below
+        ml::computation::simd::dispatch([&]() {
+            constexpr T CENTRAL_IMAGE = static_cast<T>(TRUNCATED_NORMAL_CENTRAL_IMAGE);
+            for (size_t i = 0; i < count; i++)
+            {
+                const T image = lower + width * TruncatedNormalRandom::fraction(words + i * WORD_COUNT);
+                values[i] = std::clamp(mean + scale * erfinv(std::clamp(image, -CENTRAL_IMAGE, CENTRAL_IMAGE)),
+                                       minimum,
+                                       maximum);
+            }
+        });
+
+        // The images are between the ones of the bounds
+        if (std::max(std::abs(lower), std::abs(lower + width)) <= static_cast<T>(TRUNCATED_NORMAL_CENTRAL_IMAGE))
+            return;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            const T fraction = TruncatedNormalRandom::fraction(words + i * WORD_COUNT);
+            if (std::abs(lower + width * fraction) > static_cast<T>(TRUNCATED_NORMAL_CENTRAL_IMAGE))
+                values[i] = this->tail_value(fraction);
+        }
+    }
+
+    template <typename T>
+    T TruncatedNormalRandom<T>::tail_value(T fraction) const
+    {
+        // The fractions below split_ go to the lower tail, from its end, the others to the upper tail, from its start
+        const bool is_lower = fraction < this->split_;
+        const Tail& tail = is_lower ? this->lower_tail_ : this->upper_tail_;
+        const T position =
+            is_lower ? T(1) - fraction / this->split_ : (fraction - this->split_) / (T(1) - this->split_);
+
+        const T log_probability = tail.log_probability + std::log1p(-position * tail.shrink);
+        const T value = std::clamp(normal_tail_inverse(log_probability), tail.start, tail.end);
+
+        return std::clamp(
+            this->mean_ + this->standard_deviation_ * (is_lower ? -value : value), this->minimum_, this->maximum_);
+    }
+} // namespace ml::generator::random
@@ -5,42 +5,56 @@
 
 #pragma once
 
-#include <random>
+#include <cstddef>
+#include <cstdint>
+
+#include "generator/random/block_random.hh"
 
 namespace ml::generator::random
 {
-    /// Uniform Distribution Random real number generator
+    /** @brief Uniform Distribution Random real number generator
+     ** @details The values are drawn from a Philox engine, one word for a float and two for a double, in blocks by
+     ** BlockRandom. A generator given a seed generates the same values at every run, and split gives the parallel
+     ** workers their own streams.
+     */
     template <typename T>
-    class UniformRandom
+    class UniformRandom : public BlockRandom<UniformRandom<T>, T, FRACTION_WORD_COUNT<T>>
     {
     public:
         /** @name Constructors
          ** \{ */
 
-        /** @brief Instantiate a new random generator
+        /** @brief Instantiate a new random generator, seeded by random_seed
          ** @param minimum The minimum value that the generator can generate, included
-         ** @param width The maximum value that the generator can generate, excluded
+         ** @param maximum The maximum value that the generator can generate, excluded
          */
         UniformRandom(T minimum, T maximum);
 
-        /** \} */
-
-        /** @name Operators
-         ** \{ */
-
-        /** @brief Generate a new random number
-         ** @return The random number
+        /** @brief Instantiate a new reproducible random generator
+         ** @param minimum The minimum value that the generator can generate, included
+         ** @param maximum The maximum value that the generator can generate, excluded
+         ** @param seed The seed of the sequence
+         ** @param stream The stream of the sequence among the ones of the seed
          */
-        T operator()();
+        UniformRandom(T minimum, T maximum, uint64_t seed, uint64_t stream = 0);
 
         /** \} */
 
     private:
-        /// The random engine
-        std::mt19937 random_engine_;
-        /// The distribution
-        std::uniform_real_distribution<T> distribution_;
+        friend class BlockRandom<UniformRandom<T>, T, FRACTION_WORD_COUNT<T>>;
+
+        /** @brief Convert the words of count values to random numbers
+         ** @param words The words, one or two a value
+         ** @param count The number of values
+         ** @param values The destination of the values
+         */
+        void convert(const uint32_t* words, size_t count, T* values) const;
+
+        /// The minimum value
+        T minimum_;
+        /// The width of the range of the values
+        T width_;
     };
 } // namespace ml::generator::random
 
-#include "generator/random/uniform_random.hxx"
\ No newline at end of file
+#include "generator/random/uniform_random.hxx"
@@ -3,17 +3,31 @@
  ** @brief Inline methods of ml::generator::random::UniformRandom
  */
 
+#include "computation/simd.hh"
+
 namespace ml::generator::random
 {
     template <typename T>
     UniformRandom<T>::UniformRandom(T minimum, T maximum)
-        : random_engine_(std::random_device()())
-        , distribution_(minimum, maximum)
+        : UniformRandom(minimum, maximum, random_seed())
     {}
 
     template <typename T>
-    T UniformRandom<T>::operator()()
+    UniformRandom<T>::UniformRandom(T minimum, T maximum, uint64_t seed, uint64_t stream)
+        : UniformRandom::BlockRandom(seed, stream)
+        , minimum_(minimum)
+        , width_(maximum - minimum)
+    {}
+
+    template <typename T>
+    void UniformRandom<T>::convert(const uint32_t* words, size_t count, T* values) const
     {
-        return this->distribution_(this->random_engine_);
+        const T minimum = this->minimum_;
+        const T width = this->width_;
+
+        ml::computation::simd::dispatch([&]() {
+            for (size_t i = 0; i < count; i++)
+                values[i] = minimum + width * UniformRandom::fraction(words + i * FRACTION_WORD_COUNT<T>);
+        });
     }
-} // namespace ml::generator::random
\ No newline at end of file
+} // namespace ml::generator::random
@@ -0,0 +1,100 @@
+/**
+ ** @file src/io/checksum.cc
+ ** @brief Implementation of the ml::io checksums
+ */
+
+#include "io/checksum.hh"
+
+#include <cstring>
+
+namespace ml::io
+{
+    /// The primes of the specification of XXH64
+    static constexpr uint64_t PRIME_1 = 0x9E3779B185EBCA87;
+    static constexpr uint64_t PRIME_2 = 0xC2B2AE3D27D4EB4F;
+    static constexpr uint64_t PRIME_3 = 0x165667B19E3779F9;
+    static constexpr uint64_t PRIME_4 = 0x85EBCA77C2B2AE63;
+    static constexpr uint64_t PRIME_5 = 0x27D4EB2F165667C5;
+
+    static inline uint64_t rotate_left(uint64_t value, int count)
+    {
+        return (value << count) | (value >> (64 - count));
+    }
+
+    /// Read a little-endian word at any alignment
+    template <typename WORD>
+    static inline WORD read(const unsigned char* bytes)
+    {
+        WORD word;
+        std::memcpy(&word, bytes, sizeof(WORD));
+        return word;
+    }
+
+    static inline uint64_t round(uint64_t accumulator, uint64_t input)
+    {
+        accumulator += input * PRIME_2;
+        return rotate_left(accumulator, 31) * PRIME_1;
+    }
+
+    static inline uint64_t merge_round(uint64_t hash, uint64_t accumulator)
+    {
+        hash ^= round(0, accumulator);
+        return hash * PRIME_1 + PRIME_4;
+    }
+
+    uint64_t xxhash64(const void* data, size_t size, uint64_t seed)
+    {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        const unsigned char* const end = bytes + size;
+        uint64_t hash;
+
+        if (size >= 32)
+        {
+            uint64_t accumulator_1 = seed + PRIME_1 + PRIME_2;
+            uint64_t accumulator_2 = seed + PRIME_2;
+            uint64_t accumulator_3 = seed;
+            uint64_t accumulator_4 = seed - PRIME_1;
+
+            for (; end - bytes >= 32; bytes += 32)
+            {
+                accumulator_1 = round(accumulator_1, read<uint64_t>(bytes));
+                accumulator_2 = round(accumulator_2, read<uint64_t>(bytes + 8));
+                accumulator_3 = round(accumulator_3, read<uint64_t>(bytes + 16));
+                accumulator_4 = round(accumulator_4, read<uint64_t>(bytes + 24));
+            }
+
+            hash = rotate_left(accumulator_1, 1) + rotate_left(accumulator_2, 7) + rotate_left(accumulator_3, 12)
+                + rotate_left(accumulator_4, 18);
+            hash = merge_round(hash, accumulator_1);
+            hash = merge_round(hash, accumulator_2);
+            hash = merge_round(hash, accumulator_3);
+            hash = merge_round(hash, accumulator_4);
+        }
+        else
+        {
+            hash = seed + PRIME_5;
+        }
+
+        hash += size;
+
+        for (; end - bytes >= 8; bytes += 8)
+            hash = rotate_left(hash ^ round(0, read<uint64_t>(bytes)), 27) * PRIME_1 + PRIME_4;
+
+        if (end - bytes >= 4)
+        {
+            hash = rotate_left(hash ^ (read<uint32_t>(bytes) * PRIME_1), 23) * PRIME_2 + PRIME_3;
+            bytes += 4;
+        }
+
+        for (; bytes < end; bytes++)
+            hash = rotate_left(hash ^ (*bytes * PRIME_5), 11) * PRIME_1;
+
+        hash ^= hash >> 33;
+        hash *= PRIME_2;
+        hash ^= hash >> 29;
+        hash *= PRIME_3;
+        hash ^= hash >> 32;
+
+        return hash;
+    }
+} // namespace ml::io
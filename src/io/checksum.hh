@@ -0,0 +1,22 @@
+/**
+ ** @file src/io/checksum.hh
+ ** @brief Declaration of the ml::io checksums
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ml::io
+{
+    /** @brief Compute the XXH64 hash of a buffer, the checksum of the matrix files
+     ** @details Four independent lanes of multiplications and rotations a 32 bytes stripe, several gigabytes per
+     ** second, so the data of a file is checked at the speed it is read
+     ** @param data The first byte of the buffer
+     ** @param size The number of bytes
+     ** @param seed The seed of the hash
+     ** @return The hash
+     */
+    uint64_t xxhash64(const void* data, size_t size, uint64_t seed = 0);
+} // namespace ml::io
@@ -0,0 +1,156 @@
+/**
+ ** @file src/io/chunked_matrix.hh
+ ** @brief Declaration of ml::io::ChunkedMatrix
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "computation/statistic.hh"
+#include "data_structure/matrix/dynamic_matrix.hh"
+#include "data_structure/matrix/matrix_view.hh"
+#include "io/file_reader.hh"
+
+namespace ml::io
+{
+    /// The number of bytes of the chunks when no height is given, two chunks are in memory during a pass
+    constexpr size_t CHUNKED_MATRIX_CHUNK_SIZE = 1 << 26;
+
+    /** @brief Read-only matrix of a matrix file, read by chunks of rows for the matrices larger than the memory
+     ** @details A pass reads the chunks in order into two buffers: the next chunk is read by another thread while the
+     ** current one is processed, so the reads overlap the computations and the memory used is two chunks whatever the
+     ** height of the matrix. The reductions of the columns run over the chunks one after the other, each chunk
+     ** reduced by the kernel of DynamicMatrix then merged into the running results. The checksum of the file is not
+     ** checked, it would read the whole file before the first chunk.
+     */
+    template <typename DATA_TYPE>
+    class ChunkedMatrix
+    {
+    public:
+        /** @name Constructors
+         ** \{ */
+
+        /** @brief Open a matrix file
+         ** @param path The path of the file
+         ** @param chunk_height The number of rows of a chunk, 0 for the rows of about CHUNKED_MATRIX_CHUNK_SIZE bytes
+         ** @throw std::system_error If the file can not be read
+         ** @throw std::invalid_argument If the file is not a valid matrix file of DATA_TYPE
+         */
+        explicit ChunkedMatrix(const std::string& path, size_t chunk_height = 0);
+
+        /** \} */
+
+        /** @name Accessors
+         ** \{ */
+
+        /** @brief Get the height of the matrix
+         ** @return The height of the matrix
+         */
+        size_t get_height() const;
+
+        /** @brief Get the width of the matrix
+         ** @return The width of the matrix
+         */
+        size_t get_width() const;
+
+        /** @brief Get the number of rows of a chunk, the last chunk may have fewer
+         ** @return The height of a chunk
+         */
+        size_t get_chunk_height() const;
+
+        /** @brief Get the number of chunks
+         ** @return The number of chunks
+         */
+        size_t get_chunk_count() const;
+
+        /** @brief Read consecutive rows of the matrix
+         ** @param first_row The index of the first row
+         ** @param count The number of rows
+         ** @return The count x width matrix of the rows
+         ** @throw std::out_of_range If the rows are not in the matrix
+         ** @throw std::system_error If the file can not be read
+         */
+        ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> read_rows(size_t first_row, size_t count) const;
+
+        /** \} */
+
+        /** @name Operations
+         ** \{ */
+
+        /** @brief Process every chunk in order, with the next one read ahead
+         ** @param function The function called as function(first_row, chunk) with the index of the first row of the
+         ** chunk and the read-only view of its rows, valid until the function returns
+         ** @throw std::system_error If the file can not be read
+         */
+        template <class Function>
+        void for_each_chunk(const Function& function) const;
+
+        /** @brief Sum of all the columns, in one pass over the file
+         ** @return The row matrix containing the sums
+         */
+        ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> sum_columns() const;
+
+        /** @brief Min of all the columns, in one pass over the file
+         ** @return The row matrix containing the minimums
+         */
+        ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> min_columns() const;
+
+        /** @brief Max of all the columns, in one pass over the file
+         ** @return The row matrix containing the maximums
+         */
+        ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> max_columns() const;
+
+        /** @brief Mean of all the columns, in one pass over the file
+         ** @return The row matrix containing the means
+         */
+        ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> mean_columns() const;
+
+        /** @brief Variance of all the columns, in one pass over the file
+         ** @param ddof The divisor used in the calculation is N - ddof, 0 by default
+         ** @return The row matrix containing the variances
+         */
+        ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> variance_columns(size_t ddof = 0) const;
+
+        /** @brief Compute the statistics of describe for all the columns, together in one pass over the file
+         ** @param ddof The divisor used in the calculation of the variance is N - ddof, 0 by default
+         ** @return The row matrices of each statistic
+         */
+        ml::computation::statistic::Description<ml::data_structure::matrix::DynamicMatrix<DATA_TYPE>>
+        describe_columns(size_t ddof = 0) const;
+
+        /** \} */
+
+    private:
+        /** @brief Read consecutive rows of the matrix into a buffer
+         ** @param first_row The index of the first row
+         ** @param count The number of rows
+         ** @param data The buffer of count x width elements
+         */
+        void read_rows(size_t first_row, size_t count, DATA_TYPE* data) const;
+
+        /** @brief Reduce every chunk with a kernel of the columns and fold the results into the running ones
+         ** @param kernel The row-major kernel, called as the ml::computation::statistic ones
+         ** @param fold The function folding the result of a chunk into the running one, element-wise
+         ** @return The row matrix of the results, left untouched for an empty matrix
+         */
+        template <class Kernel, class Fold>
+        ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> reduce_columns(const Kernel& kernel,
+                                                                            const Fold& fold) const;
+
+        /// The file
+        FileReader file_;
+        /// The height of the matrix
+        size_t height_;
+        /// The width of the matrix
+        size_t width_;
+        /// The position of the first element in the file
+        uint64_t data_offset_;
+        /// The number of rows of a chunk
+        size_t chunk_height_;
+    };
+} // namespace ml::io
+
+#include "io/chunked_matrix.hxx"
@@ -0,0 +1,243 @@
+/**
+ ** @file src/io/chunked_matrix.hxx
+ ** @brief Implementation of ml::io::ChunkedMatrix
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+#include "io/matrix_file.hh"
+
+namespace ml::io
+{
+    template <typename DATA_TYPE>
+    ChunkedMatrix<DATA_TYPE>::ChunkedMatrix(const std::string& path, size_t chunk_height)
+        : file_(path)
+    {
+        if (this->file_.size() < sizeof(MatrixFileHeader))
+            throw std::invalid_argument("The file is not a matrix file");
+
+        MatrixFileHeader header;
+        this->file_.read(&header, sizeof(header), 0);
+        check_matrix_file_header(header, this->file_.size(), data_type_v<DATA_TYPE>, sizeof(DATA_TYPE));
+
+        this->height_ = header.height;
+        this->width_ = header.width;
+        this->data_offset_ = header.data_offset;
+
+        const size_t row_size = std::max<size_t>(1, this->width_ * sizeof(DATA_TYPE));
+        this->chunk_height_ = chunk_height;
+        if (this->chunk_height_ == 0)
+            this->chunk_height_ = std::max<size_t>(1, CHUNKED_MATRIX_CHUNK_SIZE / row_size);
+    }
+
+    template <typename DATA_TYPE>
+    size_t ChunkedMatrix<DATA_TYPE>::get_height() const
+    {
+        return this->height_;
+    }
+
+    template <typename DATA_TYPE>
+    size_t ChunkedMatrix<DATA_TYPE>::get_width() const
+    {
+        return this->width_;
+    }
+
+    template <typename DATA_TYPE>
+    size_t ChunkedMatrix<DATA_TYPE>::get_chunk_height() const
+    {
+        return this->chunk_height_;
+    }
+
+    template <typename DATA_TYPE>
+    size_t ChunkedMatrix<DATA_TYPE>::get_chunk_count() const
+    {
+        return (this->height_ + this->chunk_height_ - 1) / this->chunk_height_;
+    }
+
+    template <typename DATA_TYPE>
+    ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> ChunkedMatrix<DATA_TYPE>::read_rows(size_t first_row,
+                                                                                             size_t count) const
+    {
+        if (first_row > this->height_ || count > this->height_ - first_row)
+            throw std::out_of_range("The rows are out of the matrix");
+
+        ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> matrix(count, this->width_);
+        this->read_rows(first_row, count, matrix.data().data());
+
+        return matrix;
+    }
+
+    template <typename DATA_TYPE>
+    void ChunkedMatrix<DATA_TYPE>::read_rows(size_t first_row, size_t count, DATA_TYPE* data) const
+    {
+        const size_t row_size = this->width_ * sizeof(DATA_TYPE);
+        this->file_.read(data, count * row_size, this->data_offset_ + first_row * row_size);
+    }
+
+    template <typename DATA_TYPE>
+    template <class Function>
+    void ChunkedMatrix<DATA_TYPE>::for_each_chunk(const Function& function) const
+    {
+        const size_t chunk_count = this->get_chunk_count();
+        if (chunk_count == 0)
+            return;
+
+        // The buffers outlive the pending read: its future waits for the read to end when a function throws
+        const size_t buffer_height = std::min(this->chunk_height_, this->height_);
+        std::vector<ml::data_structure::matrix::DynamicMatrix<DATA_TYPE>> buffers(
+            std::min<size_t>(2, chunk_count),
+            ml::data_structure::matrix::DynamicMatrix<DATA_TYPE>(buffer_height, this->width_));
+
+        const auto chunk_rows = [this](size_t chunk) {
+            return std::min(this->chunk_height_, this->height_ - chunk * this->chunk_height_);
+        };
+        const auto read_chunk = [this, &buffers, &chunk_rows](size_t chunk) {
+            this->read_rows(chunk * this->chunk_height_, chunk_rows(chunk), buffers[chunk % 2].data().data());
+        };
+
+        read_chunk(0);
+        for (size_t chunk = 0; chunk < chunk_count; chunk++)
+        {
+            std::future<void> next_read;
+            if (chunk + 1 < chunk_count)
+                next_read = std::async(std::launch::async, read_chunk, chunk + 1);
+
+            function(chunk * this->chunk_height_,
+                     ml::data_structure::matrix::MatrixView<const DATA_TYPE>(buffers[chunk % 2].data().data(),
+                                                                             chunk_rows(chunk),
+                                                                             this->width_,
+                                                                             static_cast<ptrdiff_t>(this->width_),
+                                                                             1));
+
+            if (next_read.valid())
+                next_read.get();
+        }
+    }
+
+    template <typename DATA_TYPE>
+    template <class Kernel, class Fold>
+    ml::data_structure::matrix::DynamicMatrix<DATA_TYPE>
+    ChunkedMatrix<DATA_TYPE>::reduce_columns(const Kernel& kernel, const Fold& fold) const
+    {
+        ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> row_matrix(1, this->width_);
+        DATA_TYPE* result = row_matrix.data().data();
+        std::vector<DATA_TYPE> chunk_result(this->width_);
+
+        // The first chunk is reduced in the result, the next ones are reduced apart then folded in
+        this->for_each_chunk([&](size_t first_row, const auto& chunk) {
+            DATA_TYPE* values = first_row == 0 ? result : chunk_result.data();
+            kernel(chunk.get_height(), this->width_, chunk.data(), chunk.get_row_stride(), values);
+
+            if (first_row != 0)
+            {
+                for (size_t j = 0; j < this->width_; j++)
+                    result[j] = fold(result[j], chunk_result[j]);
+            }
+        });
+
+        return row_matrix;
+    }
+
+    template <typename DATA_TYPE>
+    ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> ChunkedMatrix<DATA_TYPE>::sum_columns() const
+    {
+        return this->reduce_columns(ml::computation::statistic::sum_columns<DATA_TYPE>,
+                                    [](DATA_TYPE lhs, DATA_TYPE rhs) { return lhs + rhs; });
+    }
+
+    template <typename DATA_TYPE>
+    ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> ChunkedMatrix<DATA_TYPE>::min_columns() const
+    {
+        return this->reduce_columns(ml::computation::statistic::min_columns<DATA_TYPE>,
+                                    [](DATA_TYPE lhs, DATA_TYPE rhs) { return rhs < lhs ? rhs : lhs; });
+    }
+
+    template <typename DATA_TYPE>
+    ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> ChunkedMatrix<DATA_TYPE>::max_columns() const
+    {
+        return this->reduce_columns(ml::computation::statistic::max_columns<DATA_TYPE>,
+                                    [](DATA_TYPE lhs, DATA_TYPE rhs) { return rhs > lhs ? rhs : lhs; });
+    }
+
+    template <typename DATA_TYPE>
+    ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> ChunkedMatrix<DATA_TYPE>::mean_columns() const
+    {
+        auto row_matrix = this->sum_columns();
+
+        const auto count = static_cast<DATA_TYPE>(this->height_);
+        for (auto& value : row_matrix.data())
+            value /= count;
+
+        return row_matrix;
+    }
+
+    template <typename DATA_TYPE>
+    ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> ChunkedMatrix<DATA_TYPE>::variance_columns(size_t ddof) const
+    {
+        std::vector<ml::computation::statistic::VarianceAccumulator<DATA_TYPE>> accumulators(this->width_);
+
+        this->for_each_chunk([&](size_t, const auto& chunk) {
+            ml::computation::statistic::accumulate_columns(
+                chunk.get_height(), this->width_, chunk.data(), chunk.get_row_stride(), accumulators.data());
+        });
+
+        ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> row_matrix(1, this->width_);
+        if (this->height_ != 0)
+        {
+            for (size_t j = 0; j < this->width_; j++)
+                row_matrix(0, j) = accumulators[j].get_variance(ddof);
+        }
+
+        return row_matrix;
+    }
+
+    template <typename DATA_TYPE>
+    ml::computation::statistic::Description<ml::data_structure::matrix::DynamicMatrix<DATA_TYPE>>
+    ChunkedMatrix<DATA_TYPE>::describe_columns(size_t ddof) const
+    {
+        using matrix_t = ml::data_structure::matrix::DynamicMatrix<DATA_TYPE>;
+
+        auto description = ml::computation::statistic::make_description(matrix_t(1, this->width_));
+        if (this->height_ == 0)
+            return description;
+
+        const auto result = ml::computation::statistic::get_data(description);
+        std::vector<DATA_TYPE> chunk_sum(this->width_);
+        std::vector<DATA_TYPE> chunk_min(this->width_);
+        std::vector<DATA_TYPE> chunk_max(this->width_);
+        std::vector<ml::computation::statistic::VarianceAccumulator<DATA_TYPE>> accumulators(this->width_);
+
+        // Each chunk is swept once: its moments are merged into the accumulators, its sums, mins and maxs folded
+        this->for_each_chunk([&](size_t first_row, const auto& chunk) {
+            ml::computation::statistic::accumulate_columns(chunk.get_height(),
+                                                           this->width_,
+                                                           chunk.data(),
+                                                           chunk.get_row_stride(),
+                                                           accumulators.data(),
+                                                           chunk_sum.data(),
+                                                           chunk_min.data(),
+                                                           chunk_max.data());
+
+            for (size_t j = 0; j < this->width_; j++)
+            {
+                result.sum[j] = first_row == 0 ? chunk_sum[j] : result.sum[j] + chunk_sum[j];
+                result.min[j] = first_row == 0 || chunk_min[j] < result.min[j] ? chunk_min[j] : result.min[j];
+                result.max[j] = first_row == 0 || chunk_max[j] > result.max[j] ? chunk_max[j] : result.max[j];
+            }
+        });
+
+        for (size_t j = 0; j < this->width_; j++)
+        {
+            result.mean[j] = result.sum[j] / static_cast<DATA_TYPE>(this->height_);
+            result.variance[j] = accumulators[j].get_variance(ddof);
+            result.standard_deviation[j] = std::sqrt(result.variance[j]);
+            result.peak_to_peak[j] = result.max[j] - result.min[j];
+        }
+
+        return description;
+    }
+} // namespace ml::io
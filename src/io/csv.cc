@@ -0,0 +1,71 @@
+/**
+ ** @file src/io/csv.cc
+ ** @brief Implementation of the non-template ml::io delimited text functions
+ */
+
+#include "io/csv.hh"
+
+#include <algorithm>
+#include <cstring>
+
+namespace ml::io
+{
+    std::vector<const char*> split_csv_chunks(const char* begin, const char* end, size_t chunk_size)
+    {
+        std::vector<const char*> chunks = {begin};
+
+        // Every chunk ends after the first newline following its approximate end
+        while (static_cast<size_t>(end - chunks.back()) > chunk_size)
+        {
+            const char* line_end = static_cast<const char*>(
+                std::memchr(chunks.back() + chunk_size, '\n', static_cast<size_t>(end - chunks.back()) - chunk_size));
+            if (line_end == nullptr)
+                break;
+
+            chunks.push_back(line_end + 1);
+        }
+
+        if (chunks.back() != end)
+            chunks.push_back(end);
+
+        return chunks;
+    }
+
+    size_t count_csv_rows(const char* begin, const char* end)
+    {
+        size_t count = 0;
+
+        while (begin < end)
+        {
+            const auto* line_end = static_cast<const char*>(std::memchr(begin, '\n', static_cast<size_t>(end - begin)));
+            if (line_end == nullptr)
+                line_end = end;
+
+            count += line_end - begin > 1 || (line_end - begin == 1 && *begin != '\r');
+            begin = line_end + 1;
+        }
+
+        return count;
+    }
+
+    std::vector<std::string> read_csv_line(const char*& begin, const char* end, char delimiter)
+    {
+        std::vector<std::string> fields;
+
+        const auto* line_end = static_cast<const char*>(std::memchr(begin, '\n', static_cast<size_t>(end - begin)));
+        if (line_end == nullptr)
+            line_end = end;
+
+        const char* field_begin = begin;
+        while (field_begin <= line_end)
+        {
+            const char* field_end = find_csv_field_end(field_begin, line_end, delimiter);
+            const auto [trimmed_begin, trimmed_end] = trim_csv_field(field_begin, field_end);
+            fields.emplace_back(trimmed_begin, trimmed_end);
+            field_begin = field_end + 1;
+        }
+
+        begin = std::min(line_end + 1, end);
+        return fields;
+    }
+} // namespace ml::io
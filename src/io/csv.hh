@@ -0,0 +1,101 @@
+/**
+ ** @file src/io/csv.hh
+ ** @brief Declaration of the ml::io delimited text readers
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "data_structure/matrix/dynamic_matrix.hh"
+
+namespace ml::io
+{
+    /// The number of bytes of the chunks of a delimited text parsed in parallel
+    constexpr size_t CSV_CHUNK_SIZE = 1 << 20;
+
+    /// The options of the delimited text readers
+    struct CsvOptions
+    {
+        /// The separator of the fields, '\t' for a TSV
+        char delimiter = ',';
+        /// Whether the first line holds the names of the columns
+        bool header = false;
+        /// The number of errors kept in CsvResult::errors, the errors of every field are counted
+        size_t max_errors = 100;
+    };
+
+    /// A field which is not a number, missing or after the last column
+    struct CsvError
+    {
+        /// The index of the row in the matrix
+        size_t row;
+        /// The index of the column of the field
+        size_t column;
+        /// The text of the field, empty for a missing field
+        std::string field;
+    };
+
+    /// The matrix read from a delimited text and the fields which could not be read
+    template <typename DATA_TYPE>
+    struct CsvResult
+    {
+        /// The values, the fields which are not numbers are NaN for a floating point type and 0 otherwise
+        ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> matrix;
+        /// The names of the columns, empty without header
+        std::vector<std::string> column_names;
+        /// The number of fields of every column which are not numbers or missing
+        std::vector<size_t> column_error_counts;
+        /// The first errors in the order of the text, the fields after the last column included
+        std::vector<CsvError> errors;
+    };
+
+    /** @brief Split a text in chunks of whole lines
+     ** @param begin The first character of the text
+     ** @param end The character after the last one
+     ** @param chunk_size The approximate number of characters of a chunk
+     ** @return The first character of every chunk then end
+     */
+    std::vector<const char*> split_csv_chunks(const char* begin, const char* end, size_t chunk_size);
+
+    /** @brief Count the lines of a text which are not empty
+     ** @param begin The first character of the text
+     ** @param end The character after the last one
+     ** @return The number of lines
+     */
+    size_t count_csv_rows(const char* begin, const char* end);
+
+    /** @brief Split the first line of a text in fields
+     ** @param begin The first character of the text, updated to the beginning of the next line
+     ** @param end The character after the last one
+     ** @param delimiter The separator of the fields
+     ** @return The fields, without their surrounding spaces and quotes
+     */
+    std::vector<std::string> read_csv_line(const char*& begin, const char* end, char delimiter);
+
+    /** @brief Parse a delimited text into a matrix, its chunks in parallel
+     ** @details The number of columns is the number of fields of the header or of the first line. The text is split
+     ** in chunks of whole lines, their lines counted then parsed by the threads of the shared pool with
+     ** std::from_chars straight into their rows. The fields can be surrounded by spaces and double quotes, which do
+     ** not hold a delimiter or a newline. The empty lines are skipped.
+     ** @param begin The first character of the text
+     ** @param end The character after the last one
+     ** @param options The options
+     ** @return The matrix and the fields which could not be read
+     */
+    template <typename DATA_TYPE>
+    CsvResult<DATA_TYPE> parse_csv(const char* begin, const char* end, const CsvOptions& options = CsvOptions());
+
+    /** @brief Read a delimited text file into a matrix, the file is mapped then parsed by parse_csv
+     ** @param path The path of the file
+     ** @param options The options
+     ** @return The matrix and the fields which could not be read
+     ** @throw std::system_error If the file can not be mapped
+     */
+    template <typename DATA_TYPE>
+    CsvResult<DATA_TYPE> read_csv(const std::string& path, const CsvOptions& options = CsvOptions());
+} // namespace ml::io
+
+#include "io/csv.hxx"
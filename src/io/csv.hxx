@@ -0,0 +1,244 @@
+/**
+ ** @file src/io/csv.hxx
+ ** @brief Implementation of the ml::io delimited text readers
+ */
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "io/mapped_file.hh"
+#include "parallel/thread_pool.hh"
+
+namespace ml::io
+{
+    /** @brief Find the end of a field, a delimiter in a quoted field does not end it
+     ** @param begin The first character of the field
+     ** @param end The end of the line
+     ** @param delimiter The separator of the fields
+     ** @return The delimiter after the field or the end of the line
+     */
+    inline const char* find_csv_field_end(const char* begin, const char* end, char delimiter)
+    {
+        const char* it = begin;
+        while (it < end && *it == ' ')
+            ++it;
+
+        if (it < end && *it == '"')
+        {
+            const auto* quote = static_cast<const char*>(std::memchr(it + 1, '"', static_cast<size_t>(end - it - 1)));
+            if (quote != nullptr)
+                it = quote + 1;
+        }
+
+        while (it < end && *it != delimiter)
+            ++it;
+
+        return it;
+    }
+
+    /** @brief Remove the spaces, the carriage return and the double quotes around a field
+     ** @param begin The first character of the field
+     ** @param end The character after the last one
+     ** @return The trimmed field
+     */
+    inline std::pair<const char*, const char*> trim_csv_field(const char* begin, const char* end)
+    {
+        const auto is_space = [](char character) { return character == ' ' || character == '\t' || character == '\r'; };
+
+        while (begin < end && is_space(*begin))
+            ++begin;
+        while (end > begin && is_space(end[-1]))
+            --end;
+
+        if (end - begin >= 2 && *begin == '"' && end[-1] == '"')
+        {
+            ++begin;
+            --end;
+        }
+
+        return {begin, end};
+    }
+
+    /// The value of the fields which are not numbers, NaN for a floating point type and 0 otherwise
+    template <typename DATA_TYPE>
+    static inline DATA_TYPE csv_missing_value()
+    {
+        if constexpr (std::numeric_limits<DATA_TYPE>::has_quiet_NaN)
+            return std::numeric_limits<DATA_TYPE>::quiet_NaN();
+        else
+            return DATA_TYPE();
+    }
+
+    /// Parse the whole trimmed field as a number, an explicit plus sign allowed
+    template <typename DATA_TYPE>
+    static inline bool parse_csv_field(const char* begin, const char* end, DATA_TYPE& value)
+    {
+        std::tie(begin, end) = trim_csv_field(begin, end);
+        if (begin < end && *begin == '+')
+            ++begin;
+
+        const auto [last, error] = std::from_chars(begin, end, value);
+        return begin < end && error == std::errc() && last == end;
+    }
+
+    /// The errors of a chunk, merged in the order of the chunks
+    struct CsvChunkErrors
+    {
+        /// The number of errors of every column
+        std::vector<size_t> column_error_counts;
+        /// The first errors
+        std::vector<CsvError> errors;
+    };
+
+    /// Parse the rows of a chunk from its first row in the matrix
+    template <typename DATA_TYPE>
+    static void parse_csv_chunk(const char* begin,
+                                const char* end,
+                                size_t first_row,
+                                size_t width,
+                                const CsvOptions& options,
+                                DATA_TYPE* data,
+                                CsvChunkErrors& chunk_errors)
+    {
+        chunk_errors.column_error_counts.assign(width, 0);
+        const auto add_error = [&](size_t row, size_t column, const char* field_begin, const char* field_end) {
+            if (chunk_errors.errors.size() < options.max_errors)
+            {
+                const auto [trimmed_begin, trimmed_end] = trim_csv_field(field_begin, field_end);
+                chunk_errors.errors.push_back(CsvError{row, column, std::string(trimmed_begin, trimmed_end)});
+            }
+        };
+
+        size_t row = first_row;
+        while (begin < end)
+        {
+            const auto* line_end = static_cast<const char*>(std::memchr(begin, '\n', static_cast<size_t>(end - begin)));
+            if (line_end == nullptr)
+                line_end = end;
+
+            // The empty lines are skipped, as count_csv_rows does
+            if (line_end - begin == 0 || (line_end - begin == 1 && *begin == '\r'))
+            {
+                begin = line_end + 1;
+                continue;
+            }
+
+            DATA_TYPE* values = data + row * width;
+            const char* field_begin = begin;
+            size_t column = 0;
+
+            for (;; column++)
+            {
+                const char* field_end = find_csv_field_end(field_begin, line_end, options.delimiter);
+
+                if (column >= width)
+                {
+                    add_error(row, column, field_begin, field_end);
+                }
+                else if (!parse_csv_field(field_begin, field_end, values[column]))
+                {
+                    values[column] = csv_missing_value<DATA_TYPE>();
+                    chunk_errors.column_error_counts[column]++;
+                    add_error(row, column, field_begin, field_end);
+                }
+
+                if (field_end == line_end)
+                    break;
+
+                field_begin = field_end + 1;
+            }
+
+            for (column++; column < width; column++)
+            {
+                values[column] = csv_missing_value<DATA_TYPE>();
+                chunk_errors.column_error_counts[column]++;
+                add_error(row, column, line_end, line_end);
+            }
+
+            row++;
+            begin = line_end + 1;
+        }
+    }
+
+    /// Run function on every chunk, in parallel when there are several chunks and threads
+    template <class Function>
+    static void for_each_csv_chunk(size_t chunk_count, const Function& function)
+    {
+        const auto run_chunks = [&function](size_t chunk_begin, size_t chunk_end) {
+            for (size_t chunk = chunk_begin; chunk < chunk_end; chunk++)
+                function(chunk);
+        };
+
+        if (chunk_count > 1 && ml::parallel::get_thread_count() > 1)
+            ml::parallel::get_thread_pool().parallel_for(0, chunk_count, 1, run_chunks);
+        else
+            run_chunks(0, chunk_count);
+    }
+
+    template <typename DATA_TYPE>
+    CsvResult<DATA_TYPE> parse_csv(const char* begin, const char* end, const CsvOptions& options)
+    {
+        CsvResult<DATA_TYPE> result;
+
+        if (options.header && begin < end)
+            result.column_names = read_csv_line(begin, end, options.delimiter);
+
+        // The width is the one of the header, or of the first line which is not empty
+        size_t width = result.column_names.size();
+        if (!options.header)
+        {
+            const char* first_line = begin;
+            while (first_line < end && (*first_line == '\n' || *first_line == '\r'))
+                ++first_line;
+
+            if (first_line < end)
+                width = read_csv_line(first_line, end, options.delimiter).size();
+        }
+
+        const std::vector<const char*> chunks = split_csv_chunks(begin, end, CSV_CHUNK_SIZE);
+        const size_t chunk_count = chunks.size() - 1;
+
+        // The rows of every chunk are counted first, so every chunk knows where its rows go in the matrix
+        std::vector<size_t> first_rows(chunk_count + 1, 0);
+        for_each_csv_chunk(chunk_count, [&](size_t chunk) {
+            first_rows[chunk + 1] = count_csv_rows(chunks[chunk], chunks[chunk + 1]);
+        });
+        std::partial_sum(first_rows.begin(), first_rows.end(), first_rows.begin());
+
+        result.matrix = ml::data_structure::matrix::DynamicMatrix<DATA_TYPE>(first_rows.back(), width);
+        DATA_TYPE* data = result.matrix.data().data();
+
+        std::vector<CsvChunkErrors> chunk_errors(chunk_count);
+        for_each_csv_chunk(chunk_count, [&](size_t chunk) {
+            parse_csv_chunk(
+                chunks[chunk], chunks[chunk + 1], first_rows[chunk], width, options, data, chunk_errors[chunk]);
+        });
+
+        result.column_error_counts.assign(width, 0);
+        for (const CsvChunkErrors& errors : chunk_errors)
+        {
+            for (size_t column = 0; column < width; column++)
+                result.column_error_counts[column] += errors.column_error_counts[column];
+
+            const size_t count = std::min(errors.errors.size(), options.max_errors - result.errors.size());
+            result.errors.insert(result.errors.end(), errors.errors.begin(), errors.errors.begin() + count);
+        }
+
+        return result;
+    }
+
+    template <typename DATA_TYPE>
+    CsvResult<DATA_TYPE> read_csv(const std::string& path, const CsvOptions& options)
+    {
+        const MappedFile file(path);
+        const auto* begin = reinterpret_cast<const char*>(file.data());
+
+        return parse_csv<DATA_TYPE>(begin, begin + file.size(), options);
+    }
+} // namespace ml::io
@@ -0,0 +1,93 @@
+/**
+ ** @file src/io/file_reader.cc
+ ** @brief Implementation of ml::io::FileReader
+ */
+
+#include "io/file_reader.hh"
+
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+#include <utility>
+
+namespace ml::io
+{
+    FileReader::FileReader()
+        : file_(-1)
+        , size_(0)
+    {}
+
+    FileReader::FileReader(const std::string& path)
+        : FileReader()
+    {
+        this->file_ = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (this->file_ == -1)
+            throw std::system_error(errno, std::generic_category(), "Cannot open " + path);
+
+        struct stat status;
+        if (::fstat(this->file_, &status) == -1)
+        {
+            const int error = errno;
+            ::close(this->file_);
+            throw std::system_error(error, std::generic_category(), "Cannot stat " + path);
+        }
+
+        this->size_ = static_cast<size_t>(status.st_size);
+
+        // The file is read from the beginning to the end, the system reads further ahead than for random reads
+        ::posix_fadvise(this->file_, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+
+    FileReader::FileReader(FileReader&& other) noexcept
+        : file_(std::exchange(other.file_, -1))
+        , size_(std::exchange(other.size_, 0))
+    {}
+
+    FileReader& FileReader::operator=(FileReader&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (this->file_ != -1)
+                ::close(this->file_);
+
+            this->file_ = std::exchange(other.file_, -1);
+            this->size_ = std::exchange(other.size_, 0);
+        }
+
+        return *this;
+    }
+
+    FileReader::~FileReader()
+    {
+        if (this->file_ != -1)
+            ::close(this->file_);
+    }
+
+    void FileReader::read(void* data, size_t size, uint64_t offset) const
+    {
+        auto* bytes = static_cast<unsigned char*>(data);
+
+        // A read returns less than asked at the end of the file or when interrupted, the rest is read again
+        while (size > 0)
+        {
+            const ssize_t count = ::pread(this->file_, bytes, size, static_cast<off_t>(offset));
+            if (count == -1 && errno == EINTR)
+                continue;
+            if (count == -1)
+                throw std::system_error(errno, std::generic_category(), "Cannot read the file");
+            if (count == 0)
+                throw std::system_error(EIO, std::generic_category(), "Cannot read after the end of the file");
+
+            bytes += count;
+            size -= static_cast<size_t>(count);
+            offset += static_cast<uint64_t>(count);
+        }
+    }
+
+    size_t FileReader::size() const
+    {
+        return this->size_;
+    }
+} // namespace ml::io
@@ -0,0 +1,82 @@
+/**
+ ** @file src/io/file_reader.hh
+ ** @brief Declaration of ml::io::FileReader
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace ml::io
+{
+    /** @brief Read-only file read by ranges at explicit offsets
+     ** @details Unlike MappedFile, the bytes are copied into buffers of the caller, so the memory used is the one of
+     ** the buffers whatever the size of the file. The reads do not share a position, several threads read the same
+     ** file at once. The file is closed with the object.
+     */
+    class FileReader
+    {
+    public:
+        /** @name Constructors
+         ** \{ */
+
+        /// Instantiate a reader of no file
+        FileReader();
+
+        /** @brief Open a file
+         ** @param path The path of the file
+         ** @throw std::system_error If the file can not be opened
+         */
+        explicit FileReader(const std::string& path);
+
+        /** @brief Take the file of another reader, left without file
+         ** @param other The other reader
+         */
+        FileReader(FileReader&& other) noexcept;
+
+        /** @brief Take the file of another reader, left without file, and close the current one
+         ** @param other The other reader
+         ** @return A reference to the reader
+         */
+        FileReader& operator=(FileReader&& other) noexcept;
+
+        FileReader(const FileReader&) = delete;
+        FileReader& operator=(const FileReader&) = delete;
+
+        /// Close the file
+        ~FileReader();
+
+        /** \} */
+
+        /** @name Operations
+         ** \{ */
+
+        /** @brief Read a range of the file
+         ** @param data The buffer of at least size bytes
+         ** @param size The number of bytes
+         ** @param offset The position of the first byte in the file
+         ** @throw std::system_error If the range can not be read, or ends after the end of the file
+         */
+        void read(void* data, size_t size, uint64_t offset) const;
+
+        /** \} */
+
+        /** @name Accessors
+         ** \{ */
+
+        /** @brief Get the size of the file
+         ** @return The number of bytes
+         */
+        size_t size() const;
+
+        /** \} */
+
+    private:
+        /// The file descriptor, -1 without file
+        int file_;
+        /// The size of the file
+        size_t size_;
+    };
+} // namespace ml::io
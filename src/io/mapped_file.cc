@@ -0,0 +1,91 @@
+/**
+ ** @file src/io/mapped_file.cc
+ ** @brief Implementation of ml::io::MappedFile
+ */
+
+#include "io/mapped_file.hh"
+
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+#include <utility>
+
+namespace ml::io
+{
+    MappedFile::MappedFile()
+        : data_(nullptr)
+        , size_(0)
+    {}
+
+    MappedFile::MappedFile(const std::string& path)
+        : MappedFile()
+    {
+        const int file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (file == -1)
+            throw std::system_error(errno, std::generic_category(), "Cannot open " + path);
+
+        struct stat status;
+        if (::fstat(file, &status) == -1)
+        {
+            const int error = errno;
+            ::close(file);
+            throw std::system_error(error, std::generic_category(), "Cannot stat " + path);
+        }
+
+        // An empty file can not be mapped, it is an empty mapping
+        this->size_ = static_cast<size_t>(status.st_size);
+        if (this->size_ != 0)
+        {
+            void* data = ::mmap(nullptr, this->size_, PROT_READ, MAP_PRIVATE, file, 0);
+            if (data == MAP_FAILED)
+            {
+                const int error = errno;
+                ::close(file);
+                throw std::system_error(error, std::generic_category(), "Cannot map " + path);
+            }
+
+            this->data_ = static_cast<const unsigned char*>(data);
+        }
+
+        // The mapping keeps the file alive
+        ::close(file);
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr))
+        , size_(std::exchange(other.size_, 0))
+    {}
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (this->data_ != nullptr)
+                ::munmap(const_cast<unsigned char*>(this->data_), this->size_);
+
+            this->data_ = std::exchange(other.data_, nullptr);
+            this->size_ = std::exchange(other.size_, 0);
+        }
+
+        return *this;
+    }
+
+    MappedFile::~MappedFile()
+    {
+        if (this->data_ != nullptr)
+            ::munmap(const_cast<unsigned char*>(this->data_), this->size_);
+    }
+
+    const unsigned char* MappedFile::data() const
+    {
+        return this->data_;
+    }
+
+    size_t MappedFile::size() const
+    {
+        return this->size_;
+    }
+} // namespace ml::io
@@ -0,0 +1,72 @@
+/**
+ ** @file src/io/mapped_file.hh
+ ** @brief Declaration of ml::io::MappedFile
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace ml::io
+{
+    /** @brief Read-only memory mapping of a whole file
+     ** @details The pages are read by the system when they are first accessed and shared with the page cache, so
+     ** opening a file costs no copy whatever its size. The mapping is released with the object.
+     */
+    class MappedFile
+    {
+    public:
+        /** @name Constructors
+         ** \{ */
+
+        /// Instantiate an empty mapping
+        MappedFile();
+
+        /** @brief Map a file
+         ** @param path The path of the file
+         ** @throw std::system_error If the file can not be opened or mapped
+         */
+        explicit MappedFile(const std::string& path);
+
+        /** @brief Take the mapping of another file, left empty
+         ** @param other The other mapping
+         */
+        MappedFile(MappedFile&& other) noexcept;
+
+        /** @brief Take the mapping of another file, left empty, and release the current one
+         ** @param other The other mapping
+         ** @return A reference to the mapping
+         */
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /// Release the mapping
+        ~MappedFile();
+
+        /** \} */
+
+        /** @name Accessors
+         ** \{ */
+
+        /** @brief Get the first byte of the file
+         ** @return The address of the first byte, aligned on a page
+         */
+        const unsigned char* data() const;
+
+        /** @brief Get the size of the file
+         ** @return The number of bytes
+         */
+        size_t size() const;
+
+        /** \} */
+
+    private:
+        /// The address of the mapping
+        const unsigned char* data_;
+        /// The size of the mapping
+        size_t size_;
+    };
+} // namespace ml::io
@@ -0,0 +1,95 @@
+/**
+ ** @file src/io/matrix_file.cc
+ ** @brief Implementation of the non-template ml::io matrix file functions
+ */
+
+#include "io/matrix_file.hh"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+
+#include "io/checksum.hh"
+
+namespace ml::io
+{
+    /// The byte order mark of the header, read as another value on a machine of the other byte order
+    static constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+    MatrixFileHeader
+    make_matrix_file_header(DataType data_type, size_t element_size, size_t height, size_t width, const void* data)
+    {
+        MatrixFileHeader header{};
+        std::copy(std::begin(MATRIX_FILE_MAGIC), std::end(MATRIX_FILE_MAGIC), header.magic);
+        header.version = MATRIX_FILE_VERSION;
+        header.byte_order = BYTE_ORDER_MARK;
+        header.data_type = data_type;
+        header.alignment = MATRIX_FILE_ALIGNMENT;
+        header.height = height;
+        header.width = width;
+        header.data_offset = (sizeof(MatrixFileHeader) + MATRIX_FILE_ALIGNMENT - 1) / MATRIX_FILE_ALIGNMENT
+            * MATRIX_FILE_ALIGNMENT;
+        header.data_size = height * width * element_size;
+        header.checksum = xxhash64(data, header.data_size);
+
+        return header;
+    }
+
+    void write_matrix_file(const std::string& path, const MatrixFileHeader& header, const void* data)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file)
+            throw std::system_error(errno, std::generic_category(), "Cannot open " + path);
+
+        const std::array<char, MATRIX_FILE_ALIGNMENT> padding{};
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(padding.data(), static_cast<std::streamsize>(header.data_offset - sizeof(header)));
+        file.write(static_cast<const char*>(data), static_cast<std::streamsize>(header.data_size));
+        file.flush();
+
+        if (!file)
+            throw std::system_error(errno, std::generic_category(), "Cannot write " + path);
+    }
+
+    void check_matrix_file_header(const MatrixFileHeader& header,
+                                  size_t file_size,
+                                  DataType data_type,
+                                  size_t element_size)
+    {
+        if (std::memcmp(header.magic, MATRIX_FILE_MAGIC, sizeof(MATRIX_FILE_MAGIC)) != 0)
+            throw std::invalid_argument("The file is not a matrix file");
+        if (header.version != MATRIX_FILE_VERSION)
+            throw std::invalid_argument("The version of the matrix file is not supported");
+        if (header.byte_order != BYTE_ORDER_MARK)
+            throw std::invalid_argument("The byte order of the matrix file is not the one of the machine");
+        if (header.data_type != data_type)
+            throw std::invalid_argument("The data type of the matrix file does not match");
+
+        // The sizes are checked without overflow before the data is read
+        const bool aligned = header.alignment != 0 && header.data_offset % header.alignment == 0
+            && header.data_offset % element_size == 0 && header.data_offset >= sizeof(MatrixFileHeader);
+        const bool sized = header.width == 0 || header.height <= UINT64_MAX / element_size / header.width;
+        if (!aligned || !sized || header.data_size != header.height * header.width * element_size
+            || header.data_offset > file_size || header.data_size > file_size - header.data_offset)
+            throw std::invalid_argument("The matrix file is corrupted");
+    }
+
+    const MatrixFileHeader&
+    check_matrix_file(const MappedFile& file, DataType data_type, size_t element_size, bool verify)
+    {
+        if (file.size() < sizeof(MatrixFileHeader))
+            throw std::invalid_argument("The file is not a matrix file");
+
+        const auto& header = *reinterpret_cast<const MatrixFileHeader*>(file.data());
+        check_matrix_file_header(header, file.size(), data_type, element_size);
+
+        if (verify && xxhash64(file.data() + header.data_offset, header.data_size) != header.checksum)
+            throw std::invalid_argument("The checksum of the matrix file does not match");
+
+        return header;
+    }
+} // namespace ml::io
@@ -0,0 +1,252 @@
+/**
+ ** @file src/io/matrix_file.hh
+ ** @brief Declaration of the ml::io matrix files
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#include "data_structure/matrix/dynamic_matrix.hh"
+#include "data_structure/memory/aligned_allocator.hh"
+#include "io/mapped_file.hh"
+
+namespace ml::io
+{
+    /// The type of the elements stored in a matrix file
+    enum class DataType : uint32_t
+    {
+        INT8 = 1,
+        UINT8,
+        INT16,
+        UINT16,
+        INT32,
+        UINT32,
+        INT64,
+        UINT64,
+        FLOAT32,
+        FLOAT64
+    };
+
+    /// The DataType of an element type, only defined for the types a matrix file stores
+    template <typename DATA_TYPE>
+    struct data_type;
+
+    template <>
+    struct data_type<int8_t> : std::integral_constant<DataType, DataType::INT8>
+    {};
+
+    template <>
+    struct data_type<uint8_t> : std::integral_constant<DataType, DataType::UINT8>
+    {};
+
+    template <>
+    struct data_type<int16_t> : std::integral_constant<DataType, DataType::INT16>
+    {};
+
+    template <>
+    struct data_type<uint16_t> : std::integral_constant<DataType, DataType::UINT16>
+    {};
+
+    template <>
+    struct data_type<int32_t> : std::integral_constant<DataType, DataType::INT32>
+    {};
+
+    template <>
+    struct data_type<uint32_t> : std::integral_constant<DataType, DataType::UINT32>
+    {};
+
+    template <>
+    struct data_type<int64_t> : std::integral_constant<DataType, DataType::INT64>
+    {};
+
+    template <>
+    struct data_type<uint64_t> : std::integral_constant<DataType, DataType::UINT64>
+    {};
+
+    template <>
+    struct data_type<float> : std::integral_constant<DataType, DataType::FLOAT32>
+    {};
+
+    template <>
+    struct data_type<double> : std::integral_constant<DataType, DataType::FLOAT64>
+    {};
+
+    template <typename DATA_TYPE>
+    constexpr DataType data_type_v = data_type<DATA_TYPE>::value;
+
+    /// The first bytes of a matrix file
+    constexpr char MATRIX_FILE_MAGIC[8] = {'M', 'L', 'M', 'A', 'T', 'R', 'I', 'X'};
+
+    /// The version of the format written
+    constexpr uint32_t MATRIX_FILE_VERSION = 1;
+
+    /// The alignment of the data in a file, the one of the matrix buffers so a mapped file is read as fast
+    constexpr size_t MATRIX_FILE_ALIGNMENT = ml::data_structure::memory::DEFAULT_ALIGNMENT;
+
+    /** @brief The header of a matrix file, followed by the data from data_offset
+     ** @details The data is the elements in the row-major order and in the byte order of the machine, written as
+     ** byte_order 0x01020304 reads. The checksum is the XXH64 of the data.
+     */
+    struct MatrixFileHeader
+    {
+        /// MATRIX_FILE_MAGIC
+        char magic[8];
+        /// The version of the format
+        uint32_t version;
+        /// 0x01020304 in the byte order of the file
+        uint32_t byte_order;
+        /// The type of the elements
+        DataType data_type;
+        /// The alignment of the data in the file
+        uint32_t alignment;
+        /// The height of the matrix
+        uint64_t height;
+        /// The width of the matrix
+        uint64_t width;
+        /// The position of the data in the file, a multiple of the alignment
+        uint64_t data_offset;
+        /// The number of bytes of the data
+        uint64_t data_size;
+        /// The XXH64 of the data
+        uint64_t checksum;
+    };
+
+    static_assert(sizeof(MatrixFileHeader) == 64, "The header is 64 bytes in the file");
+
+    /** @brief Make the header of a matrix
+     ** @param data_type The type of the elements
+     ** @param element_size The size of an element
+     ** @param height The height of the matrix
+     ** @param width The width of the matrix
+     ** @param data The elements of the matrix in the row-major order
+     ** @return The header
+     */
+    MatrixFileHeader
+    make_matrix_file_header(DataType data_type, size_t element_size, size_t height, size_t width, const void* data);
+
+    /** @brief Write a matrix file
+     ** @param path The path of the file, replaced if it exists
+     ** @param header The header of the matrix
+     ** @param data The header.data_size bytes of the data
+     ** @throw std::system_error If the file can not be written
+     */
+    void write_matrix_file(const std::string& path, const MatrixFileHeader& header, const void* data);
+
+    /** @brief Check that the header of a file is the one of a matrix file of elements of a type
+     ** @param header The header read from the file
+     ** @param file_size The size of the file
+     ** @param data_type The type of the elements expected
+     ** @param element_size The size of an element
+     ** @throw std::invalid_argument If the header is not a valid matrix file header, of another type of elements or
+     ** of more data than the file holds
+     */
+    void check_matrix_file_header(const MatrixFileHeader& header,
+                                  size_t file_size,
+                                  DataType data_type,
+                                  size_t element_size);
+
+    /** @brief Check that a mapped file is a matrix file of elements of a type
+     ** @param file The mapped file
+     ** @param data_type The type of the elements expected
+     ** @param element_size The size of an element
+     ** @param verify Whether the checksum of the data is checked, which reads the whole file
+     ** @return The header of the file
+     ** @throw std::invalid_argument If the file is not a valid matrix file, holds another type of elements or does
+     ** not match its checksum
+     */
+    const MatrixFileHeader&
+    check_matrix_file(const MappedFile& file, DataType data_type, size_t element_size, bool verify);
+
+    /** @brief Read-only matrix mapped from a matrix file
+     ** @details The view reads the elements in the mapping, no element is copied: the pages are read by the system
+     ** when they are first accessed. The view is valid as long as the MappedMatrix lives. The checksum is only checked
+     ** on request, it would read the whole file before the first element is used.
+     */
+    template <typename DATA_TYPE>
+    class MappedMatrix
+    {
+    public:
+        /** @name Constructors
+         ** \{ */
+
+        /** @brief Map a matrix file
+         ** @param path The path of the file
+         ** @param verify Whether the checksum of the data is checked, which reads the whole file, false by default
+         ** @throw std::system_error If the file can not be mapped
+         ** @throw std::invalid_argument If the file is not a valid matrix file of DATA_TYPE
+         */
+        explicit MappedMatrix(const std::string& path, bool verify = false);
+
+        /** \} */
+
+        /** @name Accessors
+         ** \{ */
+
+        /** @brief Get the read-only view of the matrix
+         ** @return The view of the elements in the mapping
+         */
+        ml::data_structure::matrix::MatrixView<const DATA_TYPE> view() const;
+
+        /** @brief Get the height of the matrix
+         ** @return The height of the matrix
+         */
+        size_t get_height() const;
+
+        /** @brief Get the width of the matrix
+         ** @return The width of the matrix
+         */
+        size_t get_width() const;
+
+        /** \} */
+
+    private:
+        /// The mapping of the file
+        MappedFile file_;
+        /// The height of the matrix
+        size_t height_;
+        /// The width of the matrix
+        size_t width_;
+        /// The first element, in the mapping
+        const DATA_TYPE* data_;
+    };
+
+    /** @brief Save the elements of a view to a matrix file
+     ** @param path The path of the file, replaced if it exists
+     ** @param view The view, copied first when it is not contiguous
+     ** @throw std::system_error If the file can not be written
+     */
+    template <typename DATA_TYPE>
+    void save(const std::string& path, const ml::data_structure::matrix::MatrixView<DATA_TYPE>& view);
+
+    /** @brief Save a matrix to a matrix file
+     ** @param path The path of the file, replaced if it exists
+     ** @param matrix The matrix
+     ** @throw std::system_error If the file can not be written
+     */
+    template <typename DATA_TYPE>
+    void save(const std::string& path, const ml::data_structure::matrix::DynamicMatrix<DATA_TYPE>& matrix);
+
+    /** @brief Save a matrix to a matrix file
+     ** @param path The path of the file, replaced if it exists
+     ** @param matrix The matrix
+     ** @throw std::system_error If the file can not be written
+     */
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    void save(const std::string& path, const ml::data_structure::matrix::Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix);
+
+    /** @brief Load a matrix file into a new matrix
+     ** @param path The path of the file
+     ** @param verify Whether the checksum of the data is checked, true by default since every element is read anyway
+     ** @return The matrix
+     ** @throw std::system_error If the file can not be read
+     ** @throw std::invalid_argument If the file is not a valid matrix file of DATA_TYPE
+     */
+    template <typename DATA_TYPE>
+    ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> load(const std::string& path, bool verify = true);
+} // namespace ml::io
+
+#include "io/matrix_file.hxx"
@@ -0,0 +1,74 @@
+/**
+ ** @file src/io/matrix_file.hxx
+ ** @brief Implementation of the ml::io matrix files
+ */
+
+#include <type_traits>
+
+namespace ml::io
+{
+    template <typename DATA_TYPE>
+    MappedMatrix<DATA_TYPE>::MappedMatrix(const std::string& path, bool verify)
+        : file_(path)
+    {
+        const MatrixFileHeader& header =
+            check_matrix_file(this->file_, data_type_v<DATA_TYPE>, sizeof(DATA_TYPE), verify);
+
+        this->height_ = header.height;
+        this->width_ = header.width;
+        this->data_ = reinterpret_cast<const DATA_TYPE*>(this->file_.data() + header.data_offset);
+    }
+
+    template <typename DATA_TYPE>
+    ml::data_structure::matrix::MatrixView<const DATA_TYPE> MappedMatrix<DATA_TYPE>::view() const
+    {
+        return ml::data_structure::matrix::MatrixView<const DATA_TYPE>(
+            this->data_, this->height_, this->width_, static_cast<ptrdiff_t>(this->width_), 1);
+    }
+
+    template <typename DATA_TYPE>
+    size_t MappedMatrix<DATA_TYPE>::get_height() const
+    {
+        return this->height_;
+    }
+
+    template <typename DATA_TYPE>
+    size_t MappedMatrix<DATA_TYPE>::get_width() const
+    {
+        return this->width_;
+    }
+
+    template <typename DATA_TYPE>
+    void save(const std::string& path, const ml::data_structure::matrix::MatrixView<DATA_TYPE>& view)
+    {
+        using data_type_t = std::remove_const_t<DATA_TYPE>;
+
+        if (!view.is_contiguous())
+        {
+            save(path, view.evaluate());
+            return;
+        }
+
+        const MatrixFileHeader header = make_matrix_file_header(
+            data_type_v<data_type_t>, sizeof(data_type_t), view.get_height(), view.get_width(), view.data());
+        write_matrix_file(path, header, view.data());
+    }
+
+    template <typename DATA_TYPE>
+    void save(const std::string& path, const ml::data_structure::matrix::DynamicMatrix<DATA_TYPE>& matrix)
+    {
+        save(path, matrix.view());
+    }
+
+    template <typename DATA_TYPE, size_t HEIGHT, size_t WIDTH>
+    void save(const std::string& path, const ml::data_structure::matrix::Matrix<DATA_TYPE, HEIGHT, WIDTH>& matrix)
+    {
+        save(path, matrix.view());
+    }
+
+    template <typename DATA_TYPE>
+    ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> load(const std::string& path, bool verify)
+    {
+        return MappedMatrix<DATA_TYPE>(path, verify).view().evaluate();
+    }
+} // namespace ml::io
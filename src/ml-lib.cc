@@ -2,6 +2,7 @@
 
 #include "computation/statistic.hh"
 #include "data_structure/iterator/step_iterator.hh"
+#include "data_structure/matrix/dynamic_matrix.hh"
 #include "data_structure/matrix/matrix.hh"
 #include "generator/random/uniform_random.hh"
 
@@ -0,0 +1,172 @@
+/**
+ ** @file src/parallel/thread_pool.cc
+ ** @brief Implementation of ml::parallel::ThreadPool
+ */
+
+#include "parallel/thread_pool.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+namespace ml::parallel
+{
+    /// Parallel loop shared by the calling thread and the workers, each of them takes the next chunk until none is left
+    struct ThreadPool::Job
+    {
+        const std::function<void(size_t, size_t)>* function;
+        size_t begin;
+        size_t end;
+        size_t chunk_size;
+        size_t chunk_count;
+
+        std::atomic<size_t> next_chunk{0};
+        size_t done_chunk_count = 0;
+        std::exception_ptr exception;
+        std::mutex mutex;
+        std::condition_variable condition;
+    };
+
+    ThreadPool::ThreadPool(size_t thread_count)
+        : stopping_(false)
+    {
+        if (thread_count == 0)
+            thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+
+        for (size_t i = 1; i < thread_count; i++)
+            workers_.emplace_back(&ThreadPool::worker_loop, this);
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        condition_.notify_all();
+
+        for (auto& worker : workers_)
+            worker.join();
+    }
+
+    size_t ThreadPool::get_thread_count() const
+    {
+        return workers_.size() + 1;
+    }
+
+    void ThreadPool::parallel_for(size_t begin,
+                                  size_t end,
+                                  size_t grain,
+                                  const std::function<void(size_t, size_t)>& function)
+    {
+        if (begin >= end)
+            return;
+
+        grain = std::max(grain, size_t(1));
+
+        // One chunk per thread, rounded up to the grain
+        const size_t size = end - begin;
+        const size_t thread_count = get_thread_count();
+        size_t chunk_size = (size + thread_count - 1) / thread_count;
+        chunk_size = (chunk_size + grain - 1) / grain * grain;
+        const size_t chunk_count = (size + chunk_size - 1) / chunk_size;
+
+        if (chunk_count == 1)
+        {
+            function(begin, end);
+            return;
+        }
+
+        auto job = std::make_shared<Job>();
+        job->function = &function;
+        job->begin = begin;
+        job->end = end;
+        job->chunk_size = chunk_size;
+        job->chunk_count = chunk_count;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (size_t i = 1; i < chunk_count; i++)
+                queue_.push_back(job);
+        }
+        condition_.notify_all();
+
+        run_chunks(*job);
+
+        std::unique_lock<std::mutex> lock(job->mutex);
+        job->condition.wait(lock, [&job]() { return job->done_chunk_count == job->chunk_count; });
+
+        if (job->exception)
+            std::rethrow_exception(job->exception);
+    }
+
+    void ThreadPool::worker_loop()
+    {
+        while (true)
+        {
+            std::shared_ptr<Job> job;
+
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                condition_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+
+                if (queue_.empty())
+                    return;
+
+                job = std::move(queue_.front());
+                queue_.pop_front();
+            }
+
+            run_chunks(*job);
+        }
+    }
+
+    void ThreadPool::run_chunks(Job& job)
+    {
+        for (size_t chunk = job.next_chunk++; chunk < job.chunk_count; chunk = job.next_chunk++)
+        {
+            const size_t chunk_begin = job.begin + chunk * job.chunk_size;
+            const size_t chunk_end = std::min(chunk_begin + job.chunk_size, job.end);
+
+            std::exception_ptr exception;
+            try
+            {
+                (*job.function)(chunk_begin, chunk_end);
+            }
+            catch (...)
+            {
+                exception = std::current_exception();
+            }
+
+            std::lock_guard<std::mutex> lock(job.mutex);
+            if (exception && !job.exception)
+                job.exception = exception;
+            if (++job.done_chunk_count == job.chunk_count)
+                job.condition.notify_all();
+        }
+    }
+
+    static std::mutex thread_pool_mutex;
+    static std::unique_ptr<ThreadPool> thread_pool;
+
+    ThreadPool& get_thread_pool()
+    {
+        std::lock_guard<std::mutex> lock(thread_pool_mutex);
+        if (!thread_pool)
+            thread_pool = std::make_unique<ThreadPool>(0);
+
+        return *thread_pool;
+    }
+
+    size_t get_thread_count()
+    {
+        return get_thread_pool().get_thread_count();
+    }
+
+    void set_thread_count(size_t thread_count)
+    {
+        std::lock_guard<std::mutex> lock(thread_pool_mutex);
+        thread_pool.reset();
+        thread_pool = std::make_unique<ThreadPool>(thread_count);
+    }
+} // namespace ml::parallel
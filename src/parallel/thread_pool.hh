@@ -0,0 +1,84 @@
+/**
+ ** @file src/parallel/thread_pool.hh
+ ** @brief Declaration of ml::parallel::ThreadPool
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ml::parallel
+{
+    /// Pool of worker threads running the chunks of parallel loops
+    class ThreadPool
+    {
+    public:
+        /** @brief Start a new pool
+         ** @param thread_count The number of threads running a parallel loop, the calling thread included,
+         ** 0 to use the number of hardware threads
+         */
+        explicit ThreadPool(size_t thread_count);
+
+        /// Stop and join the worker threads
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /** @brief Get the number of threads running a parallel loop, the calling thread included
+         ** @return The number of threads
+         */
+        size_t get_thread_count() const;
+
+        /** @brief Split [begin, end) into contiguous chunks and run function on each of them in parallel
+         ** @details The calling thread runs chunks too and returns once all of them are done, so a parallel loop
+         ** can be nested in another one. The first exception thrown by a chunk is rethrown here.
+         ** @param begin The first index
+         ** @param end The index after the last one
+         ** @param grain The chunk boundaries are multiples of grain after begin, 0 is treated as 1
+         ** @param function The function called with the [chunk_begin, chunk_end) indexes of each chunk
+         */
+        void parallel_for(size_t begin,
+                          size_t end,
+                          size_t grain,
+                          const std::function<void(size_t, size_t)>& function);
+
+    private:
+        struct Job;
+
+        /// Loop of the worker threads, running the chunks of the queued jobs until the pool stops
+        void worker_loop();
+
+        /// Run the chunks of job that are still not taken
+        static void run_chunks(Job& job);
+
+        std::vector<std::thread> workers_;
+        std::deque<std::shared_ptr<Job>> queue_;
+        std::mutex mutex_;
+        std::condition_variable condition_;
+        bool stopping_;
+    };
+
+    /** @brief Get the pool shared by the library, created on first use
+     ** @return The shared pool
+     */
+    ThreadPool& get_thread_pool();
+
+    /** @brief Get the number of threads used by the parallel functions of the library
+     ** @return The number of threads
+     */
+    size_t get_thread_count();
+
+    /** @brief Set the number of threads used by the parallel functions of the library
+     ** @details Recreate the shared pool, it must not be called while a parallel function is running
+     ** @param thread_count The number of threads, 1 to run serially, 0 to use the number of hardware threads
+     */
+    void set_thread_count(size_t thread_count);
+} // namespace ml::parallel
@@ -0,0 +1,104 @@
+/**
+ ** @file tests/benchmarks/broadcast.cc
+ ** @brief Benchmarks of the broadcasting arithmetic operations against per-element broadcast index computation
+ */
+
+#include <benchmark/benchmark.h>
+#include <functional>
+
+#include "computation/broadcast.hh"
+#include "data_structure/matrix/dynamic_matrix.hh"
+#include "generator/random/uniform_random.hh"
+
+namespace tests::benchmarks
+{
+    enum class BroadcastShape
+    {
+        SAME,
+        ROW,
+        COLUMN,
+        SCALAR
+    };
+
+    static ml::data_structure::matrix::DynamicMatrix<float> broadcast_operand(BroadcastShape shape, size_t size)
+    {
+        const size_t height = shape == BroadcastShape::SAME || shape == BroadcastShape::COLUMN ? size : 1;
+        const size_t width = shape == BroadcastShape::SAME || shape == BroadcastShape::ROW ? size : 1;
+
+        ml::data_structure::matrix::DynamicMatrix<float> operand(height, width);
+        operand.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+
+        return operand;
+    }
+
+    /// Compute matrix + operand calling get_broadcast_value on both sides of every element
+    template <BroadcastShape SHAPE>
+    static void BM_BroadcastPerElement(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+        const auto& operand = broadcast_operand(SHAPE, size);
+
+        ml::data_structure::matrix::DynamicMatrix<float> result(size, size);
+
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < size; i++)
+            {
+                for (size_t j = 0; j < size; j++)
+                    result(i, j) = matrix.get_broadcast_value(i, j) + operand.get_broadcast_value(i, j);
+            }
+
+            benchmark::DoNotOptimize(result.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        // Bytes streamed: the matrix read and the result written, the broadcast operand staying in cache
+        state.SetBytesProcessed(state.iterations() * 2 * size * size * sizeof(float));
+    }
+
+    /// Compute matrix + operand with the broadcast kernel behind ml::data_structure::matrix::plus
+    template <BroadcastShape SHAPE>
+    static void BM_BroadcastKernel(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+        const auto& operand = broadcast_operand(SHAPE, size);
+
+        ml::data_structure::matrix::DynamicMatrix<float> result(size, size);
+
+        for (auto _ : state)
+        {
+            ml::computation::broadcast::apply(matrix.data().data(),
+                                              size,
+                                              size,
+                                              operand.data().data(),
+                                              operand.get_height(),
+                                              operand.get_width(),
+                                              result.data().data(),
+                                              std::plus<>());
+            benchmark::DoNotOptimize(result.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetBytesProcessed(state.iterations() * 2 * size * size * sizeof(float));
+    }
+
+    static void broadcast_sizes(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->RangeMultiplier(4)->Range(64, 4096)->ArgName("size");
+    }
+
+    BENCHMARK_TEMPLATE(BM_BroadcastPerElement, BroadcastShape::SAME)->Apply(broadcast_sizes);
+    BENCHMARK_TEMPLATE(BM_BroadcastKernel, BroadcastShape::SAME)->Apply(broadcast_sizes);
+    BENCHMARK_TEMPLATE(BM_BroadcastPerElement, BroadcastShape::ROW)->Apply(broadcast_sizes);
+    BENCHMARK_TEMPLATE(BM_BroadcastKernel, BroadcastShape::ROW)->Apply(broadcast_sizes);
+    BENCHMARK_TEMPLATE(BM_BroadcastPerElement, BroadcastShape::COLUMN)->Apply(broadcast_sizes);
+    BENCHMARK_TEMPLATE(BM_BroadcastKernel, BroadcastShape::COLUMN)->Apply(broadcast_sizes);
+    BENCHMARK_TEMPLATE(BM_BroadcastPerElement, BroadcastShape::SCALAR)->Apply(broadcast_sizes);
+    BENCHMARK_TEMPLATE(BM_BroadcastKernel, BroadcastShape::SCALAR)->Apply(broadcast_sizes);
+} // namespace tests::benchmarks
@@ -0,0 +1,97 @@
+/**
+ ** @file tests/benchmarks/gemm.cc
+ ** @brief Benchmarks of the ml::computation::gemm kernels against the textbook triple loop
+ */
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "computation/gemm.hh"
+#include "data_structure/matrix/dynamic_matrix.hh"
+#include "generator/random/uniform_random.hh"
+#include "parallel/thread_pool.hh"
+
+namespace tests::benchmarks
+{
+    /// The i-j-k loop multiplies_matrix used before the blocked kernel
+    template <typename DATA_TYPE>
+    static void
+    gemm_textbook(size_t m, size_t n, size_t p, const DATA_TYPE* lhs, const DATA_TYPE* rhs, DATA_TYPE* result)
+    {
+        for (size_t i = 0; i < m; i++)
+        {
+            for (size_t j = 0; j < p; j++)
+            {
+                DATA_TYPE value = 0;
+                for (size_t k = 0; k < n; k++)
+                    value += lhs[i * n + k] * rhs[k * p + j];
+
+                result[i * p + j] = value;
+            }
+        }
+    }
+
+    enum class GemmKernel
+    {
+        TEXTBOOK,
+        SIMPLE,
+        BLOCKED,
+        PARALLEL
+    };
+
+    template <typename DATA_TYPE, GemmKernel KERNEL>
+    static void BM_Gemm(benchmark::State& state)
+    {
+        const auto m = static_cast<size_t>(state.range(0));
+        const auto n = static_cast<size_t>(state.range(1));
+        const auto p = static_cast<size_t>(state.range(2));
+
+        ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> lhs(m, n);
+        ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> rhs(n, p);
+        ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> result(m, p);
+        lhs.fill_generator(ml::generator::random::UniformRandom<DATA_TYPE>(-1, 1));
+        rhs.fill_generator(ml::generator::random::UniformRandom<DATA_TYPE>(-1, 1));
+
+        for (auto _ : state)
+        {
+            if constexpr (KERNEL == GemmKernel::TEXTBOOK)
+                gemm_textbook(m, n, p, lhs.data().data(), rhs.data().data(), result.data().data());
+            else if constexpr (KERNEL == GemmKernel::SIMPLE)
+                ml::computation::gemm::multiply_simple(
+                    m, n, p, lhs.data().data(), n, 1, rhs.data().data(), p, 1, result.data().data(), p);
+            else if constexpr (KERNEL == GemmKernel::BLOCKED)
+                ml::computation::gemm::multiply_blocked(
+                    m, n, p, lhs.data().data(), n, 1, rhs.data().data(), p, 1, result.data().data(), p);
+            else
+                ml::computation::gemm::multiply_parallel(
+                    m, n, p, lhs.data().data(), n, 1, rhs.data().data(), p, 1, result.data().data(), p);
+
+            benchmark::DoNotOptimize(result.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        state.counters["threads"] = ml::parallel::get_thread_count();
+        state.counters["GFLOP/s"] =
+            benchmark::Counter(2.0 * m * n * p * 1e-9, benchmark::Counter::kIsIterationInvariantRate);
+    }
+
+    /// Square shapes then skinny ones: tall-skinny times short-wide, short-wide times tall-skinny, matrix-vector
+    static void gemm_shapes(benchmark::internal::Benchmark* benchmark)
+    {
+        for (int64_t size : {64, 128, 256, 512, 1024})
+            benchmark->Args({size, size, size});
+
+        benchmark->Args({2048, 16, 2048});
+        benchmark->Args({16, 2048, 16});
+        benchmark->Args({2048, 2048, 1});
+        benchmark->Args({1024, 64, 512});
+        benchmark->ArgNames({"m", "n", "p"})->Unit(benchmark::kMillisecond);
+    }
+
+    BENCHMARK_TEMPLATE(BM_Gemm, float, GemmKernel::TEXTBOOK)->Apply(gemm_shapes);
+    BENCHMARK_TEMPLATE(BM_Gemm, float, GemmKernel::SIMPLE)->Apply(gemm_shapes);
+    BENCHMARK_TEMPLATE(BM_Gemm, float, GemmKernel::BLOCKED)->Apply(gemm_shapes);
+    BENCHMARK_TEMPLATE(BM_Gemm, float, GemmKernel::PARALLEL)->Apply(gemm_shapes)->UseRealTime();
+    BENCHMARK_TEMPLATE(BM_Gemm, double, GemmKernel::TEXTBOOK)->Apply(gemm_shapes);
+    BENCHMARK_TEMPLATE(BM_Gemm, double, GemmKernel::BLOCKED)->Apply(gemm_shapes);
+} // namespace tests::benchmarks
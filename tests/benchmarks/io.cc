@@ -0,0 +1,200 @@
+/**
+ ** @file tests/benchmarks/io.cc
+ ** @brief Benchmarks of the loading of the matrix files and of the delimited texts, and of the chunked reductions
+ */
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "data_structure/matrix/dynamic_matrix.hh"
+#include "generator/random/uniform_random.hh"
+#include "io/chunked_matrix.hh"
+#include "io/csv.hh"
+#include "io/matrix_file.hh"
+
+namespace tests::benchmarks
+{
+    /// The path of the files of the benchmarks
+    static const std::string IO_BENCHMARK_PATH = "/tmp/ml_io_benchmark";
+
+    /// Parse the values of a text dump written with the full precision of a float, the only way back before the
+    /// matrix files
+    static void BM_LoadText(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1, 42));
+        {
+            std::ofstream file(IO_BENCHMARK_PATH + ".txt");
+            file.precision(9);
+            for (float value : matrix.data())
+                file << value << ' ';
+        }
+
+        for (auto _ : state)
+        {
+            ml::data_structure::matrix::DynamicMatrix<float> result(size, size);
+            std::ifstream file(IO_BENCHMARK_PATH + ".txt");
+            for (float& value : result.data())
+                file >> value;
+
+            benchmark::DoNotOptimize(result.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        std::remove((IO_BENCHMARK_PATH + ".txt").c_str());
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(size * size * sizeof(float)));
+    }
+
+    /// Load a matrix file, the second argument 0 copies it into a matrix, 1 maps it, 2 maps it without checksum
+    static void BM_LoadMatrixFile(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1, 42));
+        ml::io::save(IO_BENCHMARK_PATH + ".mat", matrix);
+
+        for (auto _ : state)
+        {
+            if (state.range(1) == 0)
+            {
+                const auto result = ml::io::load<float>(IO_BENCHMARK_PATH + ".mat");
+                benchmark::DoNotOptimize(result.data().data());
+            }
+            else
+            {
+                const ml::io::MappedMatrix<float> result(IO_BENCHMARK_PATH + ".mat", state.range(1) == 1);
+                benchmark::DoNotOptimize(result.view().data());
+            }
+
+            benchmark::ClobberMemory();
+        }
+
+        std::remove((IO_BENCHMARK_PATH + ".mat").c_str());
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(size * size * sizeof(float)));
+    }
+
+    /// Write a CSV of random floats with 16 columns and return its size in bytes
+    static size_t write_csv(const std::string& path, size_t height)
+    {
+        const size_t width = 16;
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(height, width);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-100, 100, 42));
+
+        std::ofstream file(path);
+        file.precision(7);
+        for (size_t i = 0; i < height; i++)
+        {
+            for (size_t j = 0; j < width; j++)
+                file << matrix(i, j) << (j + 1 < width ? ',' : '\n');
+        }
+
+        return static_cast<size_t>(file.tellp());
+    }
+
+    /// Read the lines with std::getline and their fields with std::strtof, the usual hand-written reader
+    static void BM_ReadCsvGetline(benchmark::State& state)
+    {
+        const size_t bytes = write_csv(IO_BENCHMARK_PATH + ".csv", static_cast<size_t>(state.range(0)));
+
+        for (auto _ : state)
+        {
+            std::vector<float> values;
+            std::ifstream file(IO_BENCHMARK_PATH + ".csv");
+            std::string line;
+            std::string field;
+
+            while (std::getline(file, line))
+            {
+                std::istringstream fields(line);
+                while (std::getline(fields, field, ','))
+                    values.push_back(std::strtof(field.c_str(), nullptr));
+            }
+
+            benchmark::DoNotOptimize(values.data());
+            benchmark::ClobberMemory();
+        }
+
+        std::remove((IO_BENCHMARK_PATH + ".csv").c_str());
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytes));
+    }
+
+    static void BM_ReadCsv(benchmark::State& state)
+    {
+        const size_t bytes = write_csv(IO_BENCHMARK_PATH + ".csv", static_cast<size_t>(state.range(0)));
+
+        for (auto _ : state)
+        {
+            const auto result = ml::io::read_csv<float>(IO_BENCHMARK_PATH + ".csv");
+
+            benchmark::DoNotOptimize(result.matrix.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        std::remove((IO_BENCHMARK_PATH + ".csv").c_str());
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytes));
+    }
+
+    /// Describe the columns of a 64 x height float matrix file: 0 loaded whole, 1 by chunks read one after the other
+    /// without read-ahead, 2 by the chunks of ChunkedMatrix, with the second argument the height of the chunks
+    static void BM_DescribeColumnsFile(benchmark::State& state)
+    {
+        const auto height = static_cast<size_t>(state.range(0));
+        const auto chunk_height = static_cast<size_t>(state.range(1));
+        const size_t width = 64;
+
+        {
+            ml::data_structure::matrix::DynamicMatrix<float> matrix(height, width);
+            matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1, 42));
+            ml::io::save(IO_BENCHMARK_PATH + ".mat", matrix);
+        }
+
+        for (auto _ : state)
+        {
+            if (state.range(2) == 0)
+            {
+                const auto description = ml::io::load<float>(IO_BENCHMARK_PATH + ".mat", false).describe_columns();
+                benchmark::DoNotOptimize(description.variance.data().data());
+            }
+            else if (state.range(2) == 1)
+            {
+                const ml::io::ChunkedMatrix<float> chunked(IO_BENCHMARK_PATH + ".mat", chunk_height);
+                for (size_t first_row = 0; first_row < height; first_row += chunk_height)
+                {
+                    const auto chunk = chunked.read_rows(first_row, std::min(chunk_height, height - first_row));
+                    const auto description = chunk.describe_columns();
+                    benchmark::DoNotOptimize(description.variance.data().data());
+                }
+            }
+            else
+            {
+                const ml::io::ChunkedMatrix<float> chunked(IO_BENCHMARK_PATH + ".mat", chunk_height);
+                const auto description = chunked.describe_columns();
+                benchmark::DoNotOptimize(description.variance.data().data());
+            }
+
+            benchmark::ClobberMemory();
+        }
+
+        std::remove((IO_BENCHMARK_PATH + ".mat").c_str());
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(height * width * sizeof(float)));
+    }
+
+    BENCHMARK(BM_DescribeColumnsFile)
+        ->ArgsProduct({{1 << 20}, {1 << 12, 1 << 14}, {0, 1, 2}})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+    BENCHMARK(BM_ReadCsvGetline)->Arg(1 << 18)->Unit(benchmark::kMillisecond);
+    BENCHMARK(BM_ReadCsv)->Arg(1 << 18)->Unit(benchmark::kMillisecond)->UseRealTime();
+    BENCHMARK(BM_LoadText)->Arg(1024)->Unit(benchmark::kMillisecond);
+    BENCHMARK(BM_LoadMatrixFile)->ArgsProduct({{1024, 4096}, {0, 1, 2}})->Unit(benchmark::kMillisecond);
+} // namespace tests::benchmarks
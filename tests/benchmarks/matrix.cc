@@ -0,0 +1,216 @@
+/**
+ ** @file tests/benchmarks/matrix.cc
+ ** @brief Benchmarks of the operations of ml::data_structure::matrix::DynamicMatrix over a grid of sizes and types
+ ** @details The reference suite run by the bench-json target: every benchmark reports its memory traffic in GB/s
+ ** and its arithmetic in GFLOP/s, so the JSON of two versions compare operation by operation
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <type_traits>
+
+#include "data_structure/matrix/dynamic_matrix.hh"
+#include "generator/random/philox.hh"
+#include "generator/random/uniform_random.hh"
+
+namespace tests::benchmarks
+{
+    /// Fill a matrix with values in [-1, 1) for a floating point type, in [0, 1000) for an integer one
+    template <typename DATA_TYPE>
+    static void fill_random(ml::data_structure::matrix::DynamicMatrix<DATA_TYPE>& matrix)
+    {
+        if constexpr (std::is_floating_point_v<DATA_TYPE>)
+        {
+            matrix.fill_generator(ml::generator::random::UniformRandom<DATA_TYPE>(-1, 1, 42));
+        }
+        else
+        {
+            ml::generator::random::Philox random_engine(42);
+            matrix.fill_generator([&random_engine]() { return static_cast<DATA_TYPE>(random_engine() % 1000); });
+        }
+    }
+
+    /** @brief Report the rates of an iteration
+     ** @param state The state of the benchmark
+     ** @param bytes The number of bytes read and written by an iteration
+     ** @param operations The number of arithmetic operations of an iteration, no GFLOP/s reported for 0
+     */
+    static void set_rates(benchmark::State& state, double bytes, double operations = 0)
+    {
+        state.counters["GB/s"] = benchmark::Counter(bytes * 1e-9, benchmark::Counter::kIsIterationInvariantRate);
+
+        if (operations > 0)
+            state.counters["GFLOP/s"] =
+                benchmark::Counter(operations * 1e-9, benchmark::Counter::kIsIterationInvariantRate);
+    }
+
+    template <typename DATA_TYPE>
+    static void BM_MatrixMultipliesMatrix(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> lhs(size, size);
+        ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> rhs(size, size);
+        fill_random(lhs);
+        fill_random(rhs);
+
+        for (auto _ : state)
+        {
+            const auto result = ml::data_structure::matrix::multiplies_matrix(lhs, rhs);
+
+            benchmark::DoNotOptimize(result.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        set_rates(state, 3.0 * size * size * sizeof(DATA_TYPE), 2.0 * size * size * size);
+    }
+
+    template <typename DATA_TYPE>
+    static void BM_MatrixPlus(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> lhs(size, size);
+        ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> rhs(size, size);
+        fill_random(lhs);
+        fill_random(rhs);
+
+        for (auto _ : state)
+        {
+            lhs.plus(rhs);
+
+            benchmark::DoNotOptimize(lhs.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        set_rates(state, 3.0 * size * size * sizeof(DATA_TYPE), 1.0 * size * size);
+    }
+
+    template <typename DATA_TYPE>
+    static void BM_MatrixTranspose(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> matrix(size, size);
+        fill_random(matrix);
+
+        for (auto _ : state)
+        {
+            const auto result = matrix.transpose();
+
+            benchmark::DoNotOptimize(result.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        set_rates(state, 2.0 * size * size * sizeof(DATA_TYPE));
+    }
+
+    template <typename DATA_TYPE>
+    static void BM_MatrixSumColumns(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> matrix(size, size);
+        fill_random(matrix);
+
+        for (auto _ : state)
+        {
+            const auto result = matrix.sum_columns();
+
+            benchmark::DoNotOptimize(result.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        set_rates(state, 1.0 * size * size * sizeof(DATA_TYPE), 1.0 * size * size);
+    }
+
+    /// The operations of the variance are a subtraction, a multiplication and an addition an element
+    template <typename DATA_TYPE>
+    static void BM_MatrixVarianceColumns(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> matrix(size, size);
+        fill_random(matrix);
+
+        for (auto _ : state)
+        {
+            const auto result = matrix.variance_columns();
+
+            benchmark::DoNotOptimize(result.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        set_rates(state, 1.0 * size * size * sizeof(DATA_TYPE), 3.0 * size * size);
+    }
+
+    /// The matrix is copied back before every sort, the copy is counted in the traffic
+    template <typename DATA_TYPE>
+    static void BM_MatrixSortColumns(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> matrix(size, size);
+        fill_random(matrix);
+        ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> result(size, size);
+
+        for (auto _ : state)
+        {
+            result = matrix;
+            result.sort_columns();
+
+            benchmark::DoNotOptimize(result.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size * size));
+        set_rates(state, 4.0 * size * size * sizeof(DATA_TYPE));
+    }
+
+    template <typename DATA_TYPE>
+    static void BM_MatrixFillUniform(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> matrix(size, size);
+        const ml::generator::random::UniformRandom<DATA_TYPE> generator(-1, 1, 42);
+
+        for (auto _ : state)
+        {
+            matrix.fill_generator(generator);
+
+            benchmark::DoNotOptimize(matrix.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        set_rates(state, 1.0 * size * size * sizeof(DATA_TYPE));
+    }
+
+    static void matrix_sizes(benchmark::internal::Benchmark* benchmark)
+    {
+        for (int64_t size : {64, 256, 1024})
+            benchmark->Arg(size);
+
+        benchmark->ArgName("size")->Unit(benchmark::kMicrosecond);
+    }
+
+    BENCHMARK_TEMPLATE(BM_MatrixMultipliesMatrix, float)->Apply(matrix_sizes);
+    BENCHMARK_TEMPLATE(BM_MatrixMultipliesMatrix, double)->Apply(matrix_sizes);
+    BENCHMARK_TEMPLATE(BM_MatrixMultipliesMatrix, int32_t)->Apply(matrix_sizes);
+    BENCHMARK_TEMPLATE(BM_MatrixPlus, float)->Apply(matrix_sizes);
+    BENCHMARK_TEMPLATE(BM_MatrixPlus, double)->Apply(matrix_sizes);
+    BENCHMARK_TEMPLATE(BM_MatrixPlus, int32_t)->Apply(matrix_sizes);
+    BENCHMARK_TEMPLATE(BM_MatrixTranspose, float)->Apply(matrix_sizes);
+    BENCHMARK_TEMPLATE(BM_MatrixTranspose, double)->Apply(matrix_sizes);
+    BENCHMARK_TEMPLATE(BM_MatrixTranspose, int32_t)->Apply(matrix_sizes);
+    BENCHMARK_TEMPLATE(BM_MatrixSumColumns, float)->Apply(matrix_sizes);
+    BENCHMARK_TEMPLATE(BM_MatrixSumColumns, double)->Apply(matrix_sizes);
+    BENCHMARK_TEMPLATE(BM_MatrixSumColumns, int32_t)->Apply(matrix_sizes);
+    BENCHMARK_TEMPLATE(BM_MatrixVarianceColumns, float)->Apply(matrix_sizes);
+    BENCHMARK_TEMPLATE(BM_MatrixVarianceColumns, double)->Apply(matrix_sizes);
+    BENCHMARK_TEMPLATE(BM_MatrixSortColumns, float)->Apply(matrix_sizes);
+    BENCHMARK_TEMPLATE(BM_MatrixSortColumns, double)->Apply(matrix_sizes);
+    BENCHMARK_TEMPLATE(BM_MatrixSortColumns, int32_t)->Apply(matrix_sizes);
+    BENCHMARK_TEMPLATE(BM_MatrixFillUniform, float)->Apply(matrix_sizes);
+    BENCHMARK_TEMPLATE(BM_MatrixFillUniform, double)->Apply(matrix_sizes);
+} // namespace tests::benchmarks
@@ -0,0 +1,65 @@
+/**
+ ** @file tests/benchmarks/matrix_expression.cc
+ ** @brief Benchmarks of the fused element-wise expressions against one temporary matrix per operation
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "data_structure/matrix/dynamic_matrix.hh"
+#include "generator/random/uniform_random.hh"
+
+namespace tests::benchmarks
+{
+    /// Compute result = a * b + c - d, materialising every intermediate matrix as the eager operators did
+    static void BM_ExpressionTemporaries(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<float> a(size, size);
+        ml::data_structure::matrix::DynamicMatrix<float> b(size, size);
+        ml::data_structure::matrix::DynamicMatrix<float> c(size, size);
+        ml::data_structure::matrix::DynamicMatrix<float> d(size, size);
+        for (auto* matrix : {&a, &b, &c, &d})
+            matrix->fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+
+        ml::data_structure::matrix::DynamicMatrix<float> result(size, size);
+
+        for (auto _ : state)
+        {
+            result = ml::data_structure::matrix::minus(
+                ml::data_structure::matrix::plus(ml::data_structure::matrix::multiplies(a, b), c), d);
+            benchmark::DoNotOptimize(result.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        // Bytes the fused loop has to move: four operands read and one result written
+        state.SetBytesProcessed(state.iterations() * 5 * size * size * sizeof(float));
+    }
+
+    /// Compute result = a * b + c - d with the lazy operators, in one fused pass into the existing result
+    static void BM_ExpressionFused(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<float> a(size, size);
+        ml::data_structure::matrix::DynamicMatrix<float> b(size, size);
+        ml::data_structure::matrix::DynamicMatrix<float> c(size, size);
+        ml::data_structure::matrix::DynamicMatrix<float> d(size, size);
+        for (auto* matrix : {&a, &b, &c, &d})
+            matrix->fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+
+        ml::data_structure::matrix::DynamicMatrix<float> result(size, size);
+
+        for (auto _ : state)
+        {
+            result = a * b + c - d;
+            benchmark::DoNotOptimize(result.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetBytesProcessed(state.iterations() * 5 * size * size * sizeof(float));
+    }
+
+    BENCHMARK(BM_ExpressionTemporaries)->RangeMultiplier(4)->Range(64, 4096)->ArgName("size");
+    BENCHMARK(BM_ExpressionFused)->RangeMultiplier(4)->Range(64, 4096)->ArgName("size");
+} // namespace tests::benchmarks
@@ -0,0 +1,65 @@
+/**
+ ** @file tests/benchmarks/matrix_view.cc
+ ** @brief Benchmarks of the multiplication by a transposed view against the multiplication by a transposed copy
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "data_structure/matrix/dynamic_matrix.hh"
+#include "generator/random/uniform_random.hh"
+
+namespace tests::benchmarks
+{
+    /// A^T * B with the transpose materialised first, as it had to be written before the views
+    static void BM_MultiplyTransposedCopy(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<float> lhs(size, size);
+        ml::data_structure::matrix::DynamicMatrix<float> rhs(size, size);
+        lhs.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+        rhs.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+
+        for (auto _ : state)
+        {
+            const auto& matrix_result = ml::data_structure::matrix::multiplies_matrix(lhs.transpose(), rhs);
+            benchmark::DoNotOptimize(matrix_result.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        state.counters["GFLOP/s"] =
+            benchmark::Counter(2.0 * size * size * size * 1e-9, benchmark::Counter::kIsIterationInvariantRate);
+    }
+
+    static void BM_MultiplyTransposedView(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<float> lhs(size, size);
+        ml::data_structure::matrix::DynamicMatrix<float> rhs(size, size);
+        lhs.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+        rhs.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+
+        for (auto _ : state)
+        {
+            const auto& matrix_result =
+                ml::data_structure::matrix::multiplies_matrix(lhs.view().transpose(), rhs.view());
+            benchmark::DoNotOptimize(matrix_result.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        state.counters["GFLOP/s"] =
+            benchmark::Counter(2.0 * size * size * size * 1e-9, benchmark::Counter::kIsIterationInvariantRate);
+    }
+
+    static void matrix_view_sizes(benchmark::internal::Benchmark* benchmark)
+    {
+        for (int64_t size : {64, 256, 1024})
+            benchmark->Arg(size);
+
+        benchmark->ArgName("size");
+    }
+
+    BENCHMARK(BM_MultiplyTransposedCopy)->Apply(matrix_view_sizes);
+    BENCHMARK(BM_MultiplyTransposedView)->Apply(matrix_view_sizes);
+} // namespace tests::benchmarks
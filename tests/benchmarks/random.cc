@@ -0,0 +1,195 @@
+/**
+ ** @file tests/benchmarks/random.cc
+ ** @brief Benchmarks of the random generators filling matrices
+ */
+
+#include <benchmark/benchmark.h>
+#include <random>
+
+#include "data_structure/matrix/dynamic_matrix.hh"
+#include "generator/random/bernoulli_random.hh"
+#include "generator/random/normal_random.hh"
+#include "generator/random/truncated_normal_random.hh"
+#include "generator/random/uniform_random.hh"
+
+namespace tests::benchmarks
+{
+    /// Fill with std::mt19937 and std::uniform_real_distribution one value at a time, as UniformRandom did before
+    static void BM_FillUniformMersenneTwister(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+
+        std::mt19937 random_engine(42);
+        std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+        for (auto _ : state)
+        {
+            matrix.fill_generator([&]() { return distribution(random_engine); });
+
+            benchmark::DoNotOptimize(matrix.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size * size));
+    }
+
+    static void BM_FillUniform(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+
+        const ml::generator::random::UniformRandom<float> generator(-1.0f, 1.0f);
+
+        for (auto _ : state)
+        {
+            matrix.fill_generator(generator);
+
+            benchmark::DoNotOptimize(matrix.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size * size));
+    }
+
+    /// Draw the values one at a time from UniformRandom, without the blocks of fill
+    static void BM_FillUniformScalar(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+
+        ml::generator::random::UniformRandom<float> generator(-1.0f, 1.0f);
+
+        for (auto _ : state)
+        {
+            matrix.fill_generator([&]() { return generator(); });
+
+            benchmark::DoNotOptimize(matrix.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size * size));
+    }
+
+    /// Construct a generator seeded by std::random_device, as UniformRandom did before random_seed
+    static void BM_ConstructUniformRandomDevice(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            std::random_device device;
+            const auto seed = (static_cast<uint64_t>(device()) << 32) | device();
+            ml::generator::random::UniformRandom<float> generator(-1.0f, 1.0f, seed);
+
+            benchmark::DoNotOptimize(generator);
+        }
+    }
+
+    static void BM_ConstructUniform(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            ml::generator::random::UniformRandom<float> generator(-1.0f, 1.0f);
+
+            benchmark::DoNotOptimize(generator);
+        }
+    }
+
+    static void BM_ConstructUniformSeeded(benchmark::State& state)
+    {
+        uint64_t seed = 0;
+        for (auto _ : state)
+        {
+            ml::generator::random::UniformRandom<float> generator(-1.0f, 1.0f, seed++);
+
+            benchmark::DoNotOptimize(generator);
+        }
+    }
+
+    /// Fill with a distribution of <random> drawing from std::mt19937 one value at a time
+    template <class Distribution>
+    static void fill_std(benchmark::State& state, Distribution distribution)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+
+        std::mt19937 random_engine(42);
+
+        for (auto _ : state)
+        {
+            matrix.fill_generator([&]() { return static_cast<float>(distribution(random_engine)); });
+
+            benchmark::DoNotOptimize(matrix.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size * size));
+    }
+
+    template <class Generator>
+    static void fill(benchmark::State& state, const Generator& generator)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+
+        for (auto _ : state)
+        {
+            matrix.fill_generator(generator);
+
+            benchmark::DoNotOptimize(matrix.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size * size));
+    }
+
+    static void BM_FillNormalStd(benchmark::State& state)
+    {
+        fill_std(state, std::normal_distribution<float>(0.0f, 1.0f));
+    }
+
+    static void BM_FillNormal(benchmark::State& state)
+    {
+        fill(state, ml::generator::random::NormalRandom<float>(0.0f, 1.0f, 42));
+    }
+
+    /// Redraw the normal values of <random> until they fall within two standard deviations
+    static void BM_FillTruncatedNormalStd(benchmark::State& state)
+    {
+        std::normal_distribution<float> distribution(0.0f, 1.0f);
+        fill_std(state, [distribution](std::mt19937& random_engine) mutable {
+            float value;
+            do
+                value = distribution(random_engine);
+            while (std::abs(value) > 2.0f);
+            return value;
+        });
+    }
+
+    static void BM_FillTruncatedNormal(benchmark::State& state)
+    {
+        fill(state, ml::generator::random::TruncatedNormalRandom<float>(0.0f, 1.0f, -2.0f, 2.0f, 42));
+    }
+
+    static void BM_FillBernoulliStd(benchmark::State& state)
+    {
+        fill_std(state, std::bernoulli_distribution(0.5));
+    }
+
+    static void BM_FillBernoulli(benchmark::State& state)
+    {
+        fill(state, ml::generator::random::BernoulliRandom<float>(0.5, 42));
+    }
+
+    BENCHMARK(BM_ConstructUniformRandomDevice);
+    BENCHMARK(BM_ConstructUniform);
+    BENCHMARK(BM_ConstructUniformSeeded);
+    BENCHMARK(BM_FillUniformMersenneTwister)->Arg(64)->Arg(1024);
+    BENCHMARK(BM_FillUniform)->Arg(64)->Arg(1024);
+    BENCHMARK(BM_FillUniformScalar)->Arg(64)->Arg(1024);
+    BENCHMARK(BM_FillNormalStd)->Arg(1024);
+    BENCHMARK(BM_FillNormal)->Arg(1024);
+    BENCHMARK(BM_FillTruncatedNormalStd)->Arg(1024);
+    BENCHMARK(BM_FillTruncatedNormal)->Arg(1024);
+    BENCHMARK(BM_FillBernoulliStd)->Arg(1024);
+    BENCHMARK(BM_FillBernoulli)->Arg(1024);
+} // namespace tests::benchmarks
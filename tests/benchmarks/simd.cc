@@ -0,0 +1,64 @@
+/**
+ ** @file tests/benchmarks/simd.cc
+ ** @brief Benchmarks of the element-wise kernels with each instruction set supported by the CPU
+ */
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+
+#include "computation/simd.hh"
+#include "data_structure/matrix/dynamic_matrix.hh"
+#include "generator/random/uniform_random.hh"
+
+namespace tests::benchmarks
+{
+    /// Compute lhs + rhs with plus, or exp(lhs) with apply when APPLY is set
+    template <typename DATA_TYPE, ml::computation::simd::InstructionSet INSTRUCTION_SET, bool APPLY>
+    static void BM_Simd(benchmark::State& state)
+    {
+        if (INSTRUCTION_SET > ml::computation::simd::get_supported_instruction_set())
+        {
+            state.SkipWithError("Instruction set not supported by the CPU");
+            return;
+        }
+
+        ml::computation::simd::set_instruction_set(INSTRUCTION_SET);
+
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> lhs(size, size);
+        ml::data_structure::matrix::DynamicMatrix<DATA_TYPE> rhs(size, size);
+        lhs.fill_generator(ml::generator::random::UniformRandom<DATA_TYPE>(-1, 1));
+        rhs.fill_generator(ml::generator::random::UniformRandom<DATA_TYPE>(-1, 1));
+
+        for (auto _ : state)
+        {
+            if constexpr (APPLY)
+                lhs.apply([](DATA_TYPE value) { return std::abs(value) * DATA_TYPE(0.5) - DATA_TYPE(0.25); });
+            else
+                lhs.plus(rhs);
+
+            benchmark::DoNotOptimize(lhs.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetBytesProcessed(state.iterations() * (APPLY ? 2 : 3) * size * size * sizeof(DATA_TYPE));
+
+        ml::computation::simd::set_instruction_set(ml::computation::simd::get_supported_instruction_set());
+    }
+
+    static void simd_sizes(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->RangeMultiplier(4)->Range(64, 1024)->ArgName("size");
+    }
+
+    BENCHMARK_TEMPLATE(BM_Simd, float, ml::computation::simd::InstructionSet::SCALAR, false)->Apply(simd_sizes);
+    BENCHMARK_TEMPLATE(BM_Simd, float, ml::computation::simd::InstructionSet::SSE2, false)->Apply(simd_sizes);
+    BENCHMARK_TEMPLATE(BM_Simd, float, ml::computation::simd::InstructionSet::AVX2, false)->Apply(simd_sizes);
+    BENCHMARK_TEMPLATE(BM_Simd, float, ml::computation::simd::InstructionSet::AVX512, false)->Apply(simd_sizes);
+    BENCHMARK_TEMPLATE(BM_Simd, double, ml::computation::simd::InstructionSet::SSE2, false)->Apply(simd_sizes);
+    BENCHMARK_TEMPLATE(BM_Simd, double, ml::computation::simd::InstructionSet::AVX512, false)->Apply(simd_sizes);
+    BENCHMARK_TEMPLATE(BM_Simd, float, ml::computation::simd::InstructionSet::SSE2, true)->Apply(simd_sizes);
+    BENCHMARK_TEMPLATE(BM_Simd, float, ml::computation::simd::InstructionSet::AVX2, true)->Apply(simd_sizes);
+    BENCHMARK_TEMPLATE(BM_Simd, float, ml::computation::simd::InstructionSet::AVX512, true)->Apply(simd_sizes);
+} // namespace tests::benchmarks
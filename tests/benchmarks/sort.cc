@@ -0,0 +1,288 @@
+/**
+ ** @file tests/benchmarks/sort.cc
+ ** @brief Benchmarks of the sorts of the rows and the columns of the matrices
+ */
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "computation/sort.hh"
+#include "data_structure/iterator/strided_iterator.hh"
+#include "data_structure/matrix/dynamic_matrix.hh"
+#include "data_structure/matrix/matrix.hh"
+#include "generator/random/uniform_random.hh"
+
+namespace tests::benchmarks
+{
+    /// Sort the columns with the bound checked StepIterator, as sort_columns did before the unchecked iterator
+    template <size_t SIZE>
+    static void BM_SortColumnsStepIterator(benchmark::State& state)
+    {
+        using matrix_t = ml::data_structure::matrix::Matrix<float, SIZE, SIZE>;
+
+        auto matrix = std::make_unique<matrix_t>();
+        matrix->fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+        auto matrix_result = std::make_unique<matrix_t>();
+
+        for (auto _ : state)
+        {
+            *matrix_result = *matrix;
+            auto& data = matrix_result->data();
+
+            for (size_t j = 0; j < SIZE; j++)
+            {
+                auto first_it = data.begin() + j;
+                auto last_it = data.begin() + j + (SIZE - 1) * SIZE;
+                typename matrix_t::column_step_iterator_t column_begin(first_it, first_it, last_it);
+                typename matrix_t::column_step_iterator_t column_end(data.end(), first_it, last_it);
+
+                std::sort(column_begin, column_end, std::less<float>());
+            }
+
+            benchmark::DoNotOptimize(data.data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * SIZE * SIZE);
+    }
+
+    template <size_t SIZE>
+    static void BM_SortColumns(benchmark::State& state)
+    {
+        using matrix_t = ml::data_structure::matrix::Matrix<float, SIZE, SIZE>;
+
+        auto matrix = std::make_unique<matrix_t>();
+        matrix->fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+        auto matrix_result = std::make_unique<matrix_t>();
+
+        for (auto _ : state)
+        {
+            *matrix_result = *matrix;
+            matrix_result->sort_columns();
+
+            benchmark::DoNotOptimize(matrix_result->data().data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * SIZE * SIZE);
+    }
+
+    /// Sort the columns with the runtime stride StridedIterator, a single instantiation for every width
+    template <size_t SIZE>
+    static void BM_SortColumnsStridedIterator(benchmark::State& state)
+    {
+        using matrix_t = ml::data_structure::matrix::Matrix<float, SIZE, SIZE>;
+        using iterator_t = ml::data_structure::iterator::StridedIterator<typename matrix_t::data_array_t::iterator>;
+
+        auto matrix = std::make_unique<matrix_t>();
+        matrix->fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+        auto matrix_result = std::make_unique<matrix_t>();
+
+        for (auto _ : state)
+        {
+            *matrix_result = *matrix;
+            auto& data = matrix_result->data();
+
+            for (size_t j = 0; j < SIZE; j++)
+            {
+                iterator_t column_begin(data.begin() + j, SIZE);
+                std::sort(column_begin, column_begin + SIZE, std::less<float>());
+            }
+
+            benchmark::DoNotOptimize(data.data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * SIZE * SIZE);
+    }
+
+    /// Sort the columns of a height x width matrix with the kernel given by the third argument: 0 for the cutover of
+    /// sort_columns, 1 in place through the strided iterator, 2 gathered in blocks
+    static void BM_SortColumnsStrategy(benchmark::State& state)
+    {
+        const auto height = static_cast<size_t>(state.range(0));
+        const auto width = static_cast<size_t>(state.range(1));
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(height, width);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+        ml::data_structure::matrix::DynamicMatrix<float> matrix_result(height, width);
+
+        for (auto _ : state)
+        {
+            matrix_result = matrix;
+            float* data = matrix_result.data().data();
+            const auto row_stride = static_cast<ptrdiff_t>(width);
+
+            if (state.range(2) == 0)
+                ml::computation::sort::sort_columns(height, width, data, row_stride, std::less<float>());
+            else if (state.range(2) == 1)
+                ml::computation::sort::sort_columns_strided(height, width, data, row_stride, std::less<float>());
+            else
+                ml::computation::sort::sort_columns_gathered(height, width, data, row_stride, std::less<float>());
+
+            benchmark::DoNotOptimize(data);
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(height * width));
+    }
+
+    /// Sort a range of floats with the backend given by the second argument: 0 for the choice of sort, 1 std::sort,
+    /// 2 radix_sort, 3 merge_sort
+    static void BM_SortBackend(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(1, size);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+        ml::data_structure::matrix::DynamicMatrix<float> matrix_result(1, size);
+
+        for (auto _ : state)
+        {
+            matrix_result = matrix;
+            float* begin = matrix_result.data().data();
+
+            if (state.range(1) == 0)
+                ml::computation::sort::sort(begin, begin + size, std::less<float>());
+            else if (state.range(1) == 1)
+                std::sort(begin, begin + size, std::less<float>());
+            else if (state.range(1) == 2)
+                ml::computation::sort::radix_sort(begin, begin + size, std::less<float>());
+            else
+                ml::computation::sort::merge_sort(begin, begin + size, std::less<float>());
+
+            benchmark::DoNotOptimize(begin);
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size));
+    }
+
+    /// Argsort the columns by sorting indexes with a comparison reading the strided column
+    static void BM_ArgsortColumnsIndexes(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+        ml::data_structure::matrix::DynamicMatrix<size_t> indexes(size, size);
+        std::vector<size_t> column(size);
+
+        for (auto _ : state)
+        {
+            for (size_t j = 0; j < size; j++)
+            {
+                std::iota(column.begin(), column.end(), 0);
+                std::stable_sort(column.begin(), column.end(), [&matrix, j](size_t lhs, size_t rhs) {
+                    return matrix(lhs, j) < matrix(rhs, j);
+                });
+
+                for (size_t i = 0; i < size; i++)
+                    indexes(i, j) = column[i];
+            }
+
+            benchmark::DoNotOptimize(indexes.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size * size));
+    }
+
+    static void BM_ArgsortColumns(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+
+        for (auto _ : state)
+        {
+            const auto indexes = matrix.argsort_columns();
+
+            benchmark::DoNotOptimize(indexes.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size * size));
+    }
+
+    /// Sort the rows by their first column with a selection of the rows swapped into place one after the other
+    static void BM_SortRowsByColumnSwaps(benchmark::State& state)
+    {
+        const auto height = static_cast<size_t>(state.range(0));
+        const size_t width = 64;
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(height, width);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+        ml::data_structure::matrix::DynamicMatrix<float> matrix_result(height, width);
+        std::vector<size_t> permutation(height);
+        std::vector<size_t> position(height);
+
+        for (auto _ : state)
+        {
+            matrix_result = matrix;
+            float* data = matrix_result.data().data();
+
+            std::iota(permutation.begin(), permutation.end(), 0);
+            std::stable_sort(permutation.begin(), permutation.end(), [&matrix](size_t lhs, size_t rhs) {
+                return matrix(lhs, 0) < matrix(rhs, 0);
+            });
+
+            // position[k] is the current row of the original row k, row i receives the original row permutation[i]
+            std::iota(position.begin(), position.end(), 0);
+            std::vector<size_t> row_at(position);
+            for (size_t i = 0; i < height; i++)
+            {
+                const size_t current = position[permutation[i]];
+                std::swap_ranges(data + i * width, data + (i + 1) * width, data + current * width);
+                position[row_at[i]] = current;
+                row_at[current] = row_at[i];
+            }
+
+            benchmark::DoNotOptimize(data);
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(height * width));
+    }
+
+    static void BM_SortRowsByColumn(benchmark::State& state)
+    {
+        const auto height = static_cast<size_t>(state.range(0));
+        const size_t width = 64;
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(height, width);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+        ml::data_structure::matrix::DynamicMatrix<float> matrix_result(height, width);
+
+        for (auto _ : state)
+        {
+            matrix_result = matrix;
+            matrix_result.sort_rows_by_column(0);
+
+            benchmark::DoNotOptimize(matrix_result.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(height * width));
+    }
+
+    BENCHMARK_TEMPLATE(BM_SortColumnsStepIterator, 64);
+    BENCHMARK_TEMPLATE(BM_SortColumnsStepIterator, 256);
+    BENCHMARK_TEMPLATE(BM_SortColumnsStepIterator, 1024);
+    BENCHMARK_TEMPLATE(BM_SortColumns, 64);
+    BENCHMARK_TEMPLATE(BM_SortColumns, 256);
+    BENCHMARK_TEMPLATE(BM_SortColumns, 1024);
+    BENCHMARK_TEMPLATE(BM_SortColumnsStridedIterator, 64);
+    BENCHMARK_TEMPLATE(BM_SortColumnsStridedIterator, 256);
+    BENCHMARK_TEMPLATE(BM_SortColumnsStridedIterator, 1024);
+    BENCHMARK(BM_ArgsortColumnsIndexes)->Arg(256)->Arg(2048);
+    BENCHMARK(BM_ArgsortColumns)->Arg(256)->Arg(2048);
+    BENCHMARK(BM_SortRowsByColumnSwaps)->Arg(1024)->Arg(65536);
+    BENCHMARK(BM_SortRowsByColumn)->Arg(1024)->Arg(65536);
+    BENCHMARK(BM_SortBackend)->ArgsProduct({{64, 256, 1024, 4096, 1 << 16, 1 << 20}, {0, 1, 2, 3}});
+    BENCHMARK(BM_SortColumnsStrategy)->ArgsProduct({{16, 256, 4096}, {2, 8, 1024}, {0, 1, 2}});
+} // namespace tests::benchmarks
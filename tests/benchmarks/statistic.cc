@@ -0,0 +1,352 @@
+/**
+ ** @file tests/benchmarks/statistic.cc
+ ** @brief Benchmarks of the statistics against the implementations they replaced
+ */
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+#include "data_structure/matrix/dynamic_matrix.hh"
+#include "generator/random/uniform_random.hh"
+
+namespace tests::benchmarks
+{
+    /// The variance before the accumulators: the sum, then the squared errors with std::pow
+    template <class Iterator, typename DATA_TYPE = typename std::iterator_traits<Iterator>::value_type>
+    static DATA_TYPE variance_two_pass(const Iterator& begin, const Iterator& end)
+    {
+        DATA_TYPE mean = std::accumulate<Iterator, DATA_TYPE>(begin, end, 0);
+        auto count = end - begin;
+        mean /= count;
+
+        DATA_TYPE error_sum = 0;
+        for (auto it = begin; it < end; ++it)
+            error_sum += std::pow(*it - mean, 2);
+
+        return error_sum / count;
+    }
+
+    static void BM_VarianceTwoPass(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+
+        for (auto _ : state)
+            benchmark::DoNotOptimize(variance_two_pass(matrix.data().cbegin(), matrix.data().cend()));
+
+        state.SetBytesProcessed(state.iterations() * size * size * sizeof(float));
+    }
+
+    static void BM_Variance(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+
+        for (auto _ : state)
+            benchmark::DoNotOptimize(matrix.variance());
+
+        state.SetBytesProcessed(state.iterations() * size * size * sizeof(float));
+    }
+
+    /// The column variance before the row sweep: each column gathered, then reduced with the two-pass variance
+    static void BM_VarianceColumnsGather(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+
+        for (auto _ : state)
+        {
+            ml::data_structure::matrix::DynamicMatrix<float> row_matrix(1, size);
+            std::vector<float> column(size);
+
+            for (size_t j = 0; j < size; j++)
+            {
+                for (size_t i = 0; i < size; i++)
+                    column[i] = matrix(i, j);
+
+                row_matrix(0, j) = variance_two_pass(column.cbegin(), column.cend());
+            }
+
+            benchmark::DoNotOptimize(row_matrix.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetBytesProcessed(state.iterations() * size * size * sizeof(float));
+    }
+
+    static void BM_VarianceColumns(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+
+        for (auto _ : state)
+        {
+            const auto& row_matrix = matrix.variance_columns();
+            benchmark::DoNotOptimize(row_matrix.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetBytesProcessed(state.iterations() * size * size * sizeof(float));
+    }
+
+    /// The column median before the selection: each column gathered, copied again and fully sorted
+    static void BM_MedianColumnsSort(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+
+        for (auto _ : state)
+        {
+            ml::data_structure::matrix::DynamicMatrix<float> row_matrix(1, size);
+            std::vector<float> column(size);
+
+            for (size_t j = 0; j < size; j++)
+            {
+                for (size_t i = 0; i < size; i++)
+                    column[i] = matrix(i, j);
+
+                std::vector<float> sorted(column);
+                std::sort(sorted.begin(), sorted.end());
+                row_matrix(0, j) = (sorted[size / 2 - 1] + sorted[size / 2]) / 2;
+            }
+
+            benchmark::DoNotOptimize(row_matrix.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetBytesProcessed(state.iterations() * size * size * sizeof(float));
+    }
+
+    static void BM_MedianColumns(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+
+        for (auto _ : state)
+        {
+            const auto& row_matrix = matrix.median_columns();
+            benchmark::DoNotOptimize(row_matrix.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetBytesProcessed(state.iterations() * size * size * sizeof(float));
+    }
+
+    static void BM_DescribeSeparate(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(matrix.sum());
+            benchmark::DoNotOptimize(matrix.min());
+            benchmark::DoNotOptimize(matrix.max());
+            benchmark::DoNotOptimize(matrix.mean());
+            benchmark::DoNotOptimize(matrix.variance());
+            benchmark::DoNotOptimize(matrix.standard_deviation());
+            benchmark::DoNotOptimize(matrix.peak_to_peak());
+        }
+
+        state.SetBytesProcessed(state.iterations() * size * size * sizeof(float));
+    }
+
+    static void BM_Describe(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+
+        for (auto _ : state)
+            benchmark::DoNotOptimize(matrix.describe());
+
+        state.SetBytesProcessed(state.iterations() * size * size * sizeof(float));
+    }
+
+    static void BM_DescribeColumnsSeparate(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+
+        for (auto _ : state)
+        {
+            const auto& sum = matrix.sum_columns();
+            const auto& min = matrix.min_columns();
+            const auto& max = matrix.max_columns();
+            const auto& mean = matrix.mean_columns();
+            const auto& standard_deviation = matrix.standard_deviation_columns();
+            const auto& peak_to_peak = matrix.peak_to_peak_columns();
+            benchmark::DoNotOptimize(sum.data().data());
+            benchmark::DoNotOptimize(min.data().data());
+            benchmark::DoNotOptimize(max.data().data());
+            benchmark::DoNotOptimize(mean.data().data());
+            benchmark::DoNotOptimize(standard_deviation.data().data());
+            benchmark::DoNotOptimize(peak_to_peak.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetBytesProcessed(state.iterations() * size * size * sizeof(float));
+    }
+
+    static void BM_DescribeColumns(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+
+        for (auto _ : state)
+        {
+            const auto& description = matrix.describe_columns();
+            benchmark::DoNotOptimize(description.standard_deviation.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetBytesProcessed(state.iterations() * size * size * sizeof(float));
+    }
+
+    static void BM_SumColumnsGather(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+
+        for (auto _ : state)
+        {
+            ml::data_structure::matrix::DynamicMatrix<float> row_matrix(1, size);
+            std::vector<float> column(size);
+
+            for (size_t j = 0; j < size; j++)
+            {
+                for (size_t i = 0; i < size; i++)
+                    column[i] = matrix(i, j);
+
+                row_matrix(0, j) = std::accumulate(column.cbegin(), column.cend(), 0.0f);
+            }
+
+            benchmark::DoNotOptimize(row_matrix.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetBytesProcessed(state.iterations() * size * size * sizeof(float));
+    }
+
+    static void BM_SumColumns(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+
+        for (auto _ : state)
+        {
+            const auto& row_matrix = matrix.sum_columns();
+            benchmark::DoNotOptimize(row_matrix.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetBytesProcessed(state.iterations() * size * size * sizeof(float));
+    }
+
+    static void BM_MaxColumns(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+
+        for (auto _ : state)
+        {
+            const auto& row_matrix = matrix.max_columns();
+            benchmark::DoNotOptimize(row_matrix.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetBytesProcessed(state.iterations() * size * size * sizeof(float));
+    }
+
+    static void BM_SumExecution(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+        const auto execution = static_cast<ml::computation::statistic::Execution>(state.range(1));
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+
+        for (auto _ : state)
+            benchmark::DoNotOptimize(ml::data_structure::matrix::sum(matrix, execution));
+
+        state.SetBytesProcessed(state.iterations() * size * size * sizeof(float));
+    }
+
+    static void BM_VarianceExecution(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+        const auto execution = static_cast<ml::computation::statistic::Execution>(state.range(1));
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+
+        for (auto _ : state)
+            benchmark::DoNotOptimize(ml::data_structure::matrix::variance(matrix, 0, execution));
+
+        state.SetBytesProcessed(state.iterations() * size * size * sizeof(float));
+    }
+
+    /// Large sizes only, the 0, 1 and 2 executions are the sequential, parallel and deterministic ones
+    static void execution_sizes(benchmark::internal::Benchmark* benchmark)
+    {
+        for (int64_t size : {1024, 4096, 10240})
+        {
+            for (int64_t execution : {0, 1, 2})
+                benchmark->Args({size, execution});
+        }
+
+        benchmark->ArgNames({"size", "execution"});
+    }
+
+    static void statistic_sizes(benchmark::internal::Benchmark* benchmark)
+    {
+        for (int64_t size : {64, 256, 1024, 4096})
+            benchmark->Arg(size);
+
+        benchmark->ArgName("size");
+    }
+
+    BENCHMARK(BM_VarianceTwoPass)->Apply(statistic_sizes);
+    BENCHMARK(BM_Variance)->Apply(statistic_sizes);
+    BENCHMARK(BM_VarianceColumnsGather)->Apply(statistic_sizes);
+    BENCHMARK(BM_VarianceColumns)->Apply(statistic_sizes);
+    BENCHMARK(BM_MedianColumnsSort)->Apply(statistic_sizes);
+    BENCHMARK(BM_MedianColumns)->Apply(statistic_sizes);
+    BENCHMARK(BM_DescribeSeparate)->Apply(statistic_sizes);
+    BENCHMARK(BM_Describe)->Apply(statistic_sizes);
+    BENCHMARK(BM_DescribeColumnsSeparate)->Apply(statistic_sizes);
+    BENCHMARK(BM_DescribeColumns)->Apply(statistic_sizes);
+    BENCHMARK(BM_SumColumnsGather)->Apply(statistic_sizes);
+    BENCHMARK(BM_SumColumns)->Apply(statistic_sizes);
+    BENCHMARK(BM_MaxColumns)->Apply(statistic_sizes);
+    BENCHMARK(BM_SumExecution)->Apply(execution_sizes);
+    BENCHMARK(BM_VarianceExecution)->Apply(execution_sizes);
+} // namespace tests::benchmarks
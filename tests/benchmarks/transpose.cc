@@ -0,0 +1,83 @@
+/**
+ ** @file tests/benchmarks/transpose.cc
+ ** @brief Benchmarks of the blocked transpose against the element by element one
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "data_structure/matrix/dynamic_matrix.hh"
+#include "generator/random/uniform_random.hh"
+
+namespace tests::benchmarks
+{
+    /// Transpose with one strided write per element, as transpose did before the blocked version
+    static void BM_TransposeNaive(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+        ml::data_structure::matrix::DynamicMatrix<float> matrix_result(size, size);
+
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < size; i++)
+            {
+                for (size_t j = 0; j < size; j++)
+                    matrix_result(j, i) = matrix(i, j);
+            }
+
+            benchmark::DoNotOptimize(matrix_result.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetBytesProcessed(state.iterations() * 2 * size * size * sizeof(float));
+    }
+
+    static void BM_Transpose(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+
+        for (auto _ : state)
+        {
+            const auto& matrix_result = matrix.transpose();
+            benchmark::DoNotOptimize(matrix_result.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetBytesProcessed(state.iterations() * 2 * size * size * sizeof(float));
+    }
+
+    static void BM_TransposeInPlace(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(size, size);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1, 1));
+
+        for (auto _ : state)
+        {
+            matrix.transpose_in_place();
+            benchmark::DoNotOptimize(matrix.data().data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetBytesProcessed(state.iterations() * 2 * size * size * sizeof(float));
+    }
+
+    /// Powers of two, where every strided write of a column maps to the same cache sets, and sizes around them
+    static void transpose_sizes(benchmark::internal::Benchmark* benchmark)
+    {
+        for (int64_t size : {64, 256, 1000, 1024, 2048, 4096})
+            benchmark->Arg(size);
+
+        benchmark->ArgName("size");
+    }
+
+    BENCHMARK(BM_TransposeNaive)->Apply(transpose_sizes);
+    BENCHMARK(BM_Transpose)->Apply(transpose_sizes);
+    BENCHMARK(BM_TransposeInPlace)->Apply(transpose_sizes);
+} // namespace tests::benchmarks
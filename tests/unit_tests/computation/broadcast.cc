@@ -0,0 +1,93 @@
+/**
+ ** @file tests/unit_tests/computation/broadcast.cc
+ ** @brief Tests for the ml::computation::broadcast functions
+ */
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "computation/broadcast.hh"
+#include "gtest/gtest.h"
+
+namespace tests::unit_tests
+{
+    static std::vector<long> computation_broadcast_iota(size_t size, long start)
+    {
+        std::vector<long> data(size);
+        for (size_t i = 0; i < size; i++)
+            data[i] = (start + static_cast<long>(i) * 7) % 23 - 11;
+
+        return data;
+    }
+
+    static std::vector<long> computation_broadcast_reference(const std::vector<long>& lhs,
+                                                             size_t lhs_height,
+                                                             size_t lhs_width,
+                                                             const std::vector<long>& rhs,
+                                                             size_t rhs_height,
+                                                             size_t rhs_width)
+    {
+        const size_t height = std::max(lhs_height, rhs_height);
+        const size_t width = std::max(lhs_width, rhs_width);
+
+        std::vector<long> result(height * width);
+        for (size_t i = 0; i < height; i++)
+        {
+            for (size_t j = 0; j < width; j++)
+            {
+                const long lhs_value = lhs[(lhs_height == 1 ? 0 : i) * lhs_width + (lhs_width == 1 ? 0 : j)];
+                const long rhs_value = rhs[(rhs_height == 1 ? 0 : i) * rhs_width + (rhs_width == 1 ? 0 : j)];
+                result[i * width + j] = lhs_value - rhs_value;
+            }
+        }
+
+        return result;
+    }
+
+    TEST(ComputationBroadcast, EveryShape)
+    {
+        const size_t height = 7;
+        const size_t width = 37;
+
+        // Same shape, row vector, column vector and scalar on each side of the (non commutative) operation
+        const std::vector<std::pair<size_t, size_t>> shapes({{height, width}, {1, width}, {height, 1}, {1, 1}});
+
+        for (const auto& [lhs_height, lhs_width] : shapes)
+        {
+            for (const auto& [rhs_height, rhs_width] : shapes)
+            {
+                const auto& lhs = computation_broadcast_iota(lhs_height * lhs_width, 1);
+                const auto& rhs = computation_broadcast_iota(rhs_height * rhs_width, 5);
+
+                const size_t result_height = std::max(lhs_height, rhs_height);
+                const size_t result_width = std::max(lhs_width, rhs_width);
+                std::vector<long> result(result_height * result_width, -1);
+
+                ml::computation::broadcast::apply(lhs.data(),
+                                                  lhs_height,
+                                                  lhs_width,
+                                                  rhs.data(),
+                                                  rhs_height,
+                                                  rhs_width,
+                                                  result.data(),
+                                                  std::minus<>());
+
+                EXPECT_EQ(computation_broadcast_reference(lhs, lhs_height, lhs_width, rhs, rhs_height, rhs_width),
+                          result);
+            }
+        }
+    }
+
+    TEST(ComputationBroadcast, InPlace)
+    {
+        std::vector<long> lhs = computation_broadcast_iota(4 * 9, 3);
+        const auto& rhs = computation_broadcast_iota(9, 2);
+        const auto& expected = computation_broadcast_reference(lhs, 4, 9, rhs, 1, 9);
+
+        ml::computation::broadcast::apply(lhs.data(), 4, 9, rhs.data(), 1, 9, lhs.data(), std::minus<>());
+
+        EXPECT_EQ(expected, lhs);
+    }
+} // namespace tests::unit_tests
@@ -0,0 +1,202 @@
+/**
+ ** @file tests/unit_tests/computation/gemm.cc
+ ** @brief Tests for the ml::computation::gemm functions
+ */
+
+#include <vector>
+
+#include "computation/gemm.hh"
+#include "gtest/gtest.h"
+#include "parallel/thread_pool.hh"
+
+namespace tests::unit_tests
+{
+    /// Small blocking sizes so that every edge of the blocked loops is crossed on small matrices
+    struct ComputationGemmSmallBlocking
+    {
+        static constexpr size_t MR = 3;
+        static constexpr size_t NR = 4;
+        static constexpr size_t MC = 2 * MR;
+        static constexpr size_t KC = 5;
+        static constexpr size_t NC = 2 * NR;
+        static constexpr size_t VECTOR_SIZE = 16;
+    };
+
+    static std::vector<long> computation_gemm_iota(size_t size, long start)
+    {
+        std::vector<long> data(size);
+        for (size_t i = 0; i < size; i++)
+            data[i] = (start + static_cast<long>(i) * 7) % 23 - 11;
+
+        return data;
+    }
+
+    static std::vector<long>
+    computation_gemm_reference(size_t m, size_t n, size_t p, const std::vector<long>& lhs, const std::vector<long>& rhs)
+    {
+        std::vector<long> result(m * p, 0);
+        for (size_t i = 0; i < m; i++)
+        {
+            for (size_t j = 0; j < p; j++)
+            {
+                for (size_t k = 0; k < n; k++)
+                    result[i * p + j] += lhs[i * n + k] * rhs[k * p + j];
+            }
+        }
+
+        return result;
+    }
+
+    TEST(ComputationGemm, BlockedEdges)
+    {
+        for (size_t m : {1, 5, 6, 7, 13})
+        {
+            for (size_t n : {1, 4, 5, 11})
+            {
+                for (size_t p : {1, 3, 8, 9, 17})
+                {
+                    const auto& lhs = computation_gemm_iota(m * n, 1);
+                    const auto& rhs = computation_gemm_iota(n * p, 5);
+                    std::vector<long> result(m * p, -1);
+
+                    ml::computation::gemm::multiply_blocked<long, ComputationGemmSmallBlocking>(
+                        m, n, p, lhs.data(), n, 1, rhs.data(), p, 1, result.data(), p);
+
+                    EXPECT_EQ(computation_gemm_reference(m, n, p, lhs, rhs), result);
+                }
+            }
+        }
+    }
+
+    TEST(ComputationGemm, BlockedDefault)
+    {
+        const size_t m = 131;
+        const size_t n = 300;
+        const size_t p = 67;
+
+        const auto& lhs = computation_gemm_iota(m * n, 3);
+        const auto& rhs = computation_gemm_iota(n * p, 2);
+        std::vector<long> result(m * p);
+
+        ml::computation::gemm::multiply_blocked(m, n, p, lhs.data(), n, 1, rhs.data(), p, 1, result.data(), p);
+
+        EXPECT_EQ(computation_gemm_reference(m, n, p, lhs, rhs), result);
+    }
+
+    TEST(ComputationGemm, SimpleSameAsBlocked)
+    {
+        const size_t m = 9;
+        const size_t n = 10;
+        const size_t p = 11;
+
+        const auto& lhs = computation_gemm_iota(m * n, 4);
+        const auto& rhs = computation_gemm_iota(n * p, 6);
+        std::vector<long> result(m * p);
+
+        ml::computation::gemm::multiply_simple(m, n, p, lhs.data(), n, 1, rhs.data(), p, 1, result.data(), p);
+
+        EXPECT_EQ(computation_gemm_reference(m, n, p, lhs, rhs), result);
+    }
+
+    TEST(ComputationGemm, SimpleMatrixVector)
+    {
+        const size_t m = 12;
+        const size_t n = 7;
+
+        const auto& lhs = computation_gemm_iota(m * n, 3);
+        const auto& rhs = computation_gemm_iota(n, 1);
+        std::vector<long> result(m);
+
+        ml::computation::gemm::multiply_simple(m, n, 1, lhs.data(), n, 1, rhs.data(), 1, 1, result.data(), 1);
+
+        EXPECT_EQ(computation_gemm_reference(m, n, 1, lhs, rhs), result);
+    }
+
+    TEST(ComputationGemm, TransposedOperands)
+    {
+        const size_t m = 7;
+        const size_t n = 6;
+        const size_t p = 9;
+
+        // lhs is stored as its n x m transpose and rhs as its p x n transpose
+        const auto& lhs = computation_gemm_iota(m * n, 8);
+        const auto& rhs = computation_gemm_iota(n * p, 9);
+        std::vector<long> lhs_transposed(n * m);
+        std::vector<long> rhs_transposed(p * n);
+        for (size_t i = 0; i < m; i++)
+        {
+            for (size_t k = 0; k < n; k++)
+                lhs_transposed[k * m + i] = lhs[i * n + k];
+        }
+        for (size_t k = 0; k < n; k++)
+        {
+            for (size_t j = 0; j < p; j++)
+                rhs_transposed[j * n + k] = rhs[k * p + j];
+        }
+
+        std::vector<long> result_blocked(m * p);
+        std::vector<long> result_simple(m * p);
+        ml::computation::gemm::multiply_blocked<long, ComputationGemmSmallBlocking>(
+            m, n, p, lhs_transposed.data(), 1, m, rhs_transposed.data(), 1, n, result_blocked.data(), p);
+        ml::computation::gemm::multiply_simple(
+            m, n, p, lhs_transposed.data(), 1, m, rhs_transposed.data(), 1, n, result_simple.data(), p);
+
+        const auto& expected = computation_gemm_reference(m, n, p, lhs, rhs);
+        EXPECT_EQ(expected, result_blocked);
+        EXPECT_EQ(expected, result_simple);
+    }
+
+    TEST(ComputationGemm, ResultRowStride)
+    {
+        const size_t m = 5;
+        const size_t n = 4;
+        const size_t p = 6;
+        const size_t result_row_stride = 10;
+
+        const auto& lhs = computation_gemm_iota(m * n, 1);
+        const auto& rhs = computation_gemm_iota(n * p, 2);
+        std::vector<long> result(m * result_row_stride, 42);
+
+        ml::computation::gemm::multiply_blocked<long, ComputationGemmSmallBlocking>(
+            m, n, p, lhs.data(), n, 1, rhs.data(), p, 1, result.data(), result_row_stride);
+
+        const auto& expected = computation_gemm_reference(m, n, p, lhs, rhs);
+        for (size_t i = 0; i < m; i++)
+        {
+            for (size_t j = 0; j < result_row_stride; j++)
+                EXPECT_EQ(j < p ? expected[i * p + j] : 42, result[i * result_row_stride + j]);
+        }
+    }
+
+    TEST(ComputationGemm, Parallel)
+    {
+        const size_t thread_count = ml::parallel::get_thread_count();
+        ml::parallel::set_thread_count(4);
+
+        // Tall result split in row panels, then wide result split in column panels
+        for (const auto& [m, p] : {std::pair<size_t, size_t>{29, 11}, std::pair<size_t, size_t>{7, 41}})
+        {
+            const size_t n = 13;
+
+            const auto& lhs = computation_gemm_iota(m * n, 2);
+            const auto& rhs = computation_gemm_iota(n * p, 7);
+            std::vector<long> result(m * p);
+
+            ml::computation::gemm::multiply_parallel<long, ComputationGemmSmallBlocking>(
+                m, n, p, lhs.data(), n, 1, rhs.data(), p, 1, result.data(), p);
+
+            EXPECT_EQ(computation_gemm_reference(m, n, p, lhs, rhs), result);
+        }
+
+        ml::parallel::set_thread_count(thread_count);
+    }
+
+    TEST(ComputationGemm, EmptyInner)
+    {
+        std::vector<float> result(6, 1.0f);
+
+        ml::computation::gemm::multiply<float>(2, 0, 3, nullptr, 0, 1, nullptr, 3, 1, result.data(), 3);
+
+        EXPECT_EQ(std::vector<float>(6, 0.0f), result);
+    }
+} // namespace tests::unit_tests
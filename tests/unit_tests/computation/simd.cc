@@ -0,0 +1,151 @@
+/**
+ ** @file tests/unit_tests/computation/simd.cc
+ ** @brief Tests for the ml::computation::simd functions
+ */
+
+#include <stdexcept>
+#include <vector>
+
+#include "computation/simd.hh"
+#include "gtest/gtest.h"
+
+namespace tests::unit_tests
+{
+    template <typename DATA_TYPE>
+    class ComputationSimd : public testing::Test
+    {
+    protected:
+        void TearDown() override
+        {
+            ml::computation::simd::set_instruction_set(ml::computation::simd::get_supported_instruction_set());
+        }
+
+        /// Instruction sets the tests can run with on this CPU
+        static std::vector<ml::computation::simd::InstructionSet> instruction_sets()
+        {
+            std::vector<ml::computation::simd::InstructionSet> instruction_sets;
+            for (auto instruction_set : {ml::computation::simd::InstructionSet::SCALAR,
+                                         ml::computation::simd::InstructionSet::SSE2,
+                                         ml::computation::simd::InstructionSet::AVX2,
+                                         ml::computation::simd::InstructionSet::AVX512})
+            {
+                if (instruction_set <= ml::computation::simd::get_supported_instruction_set())
+                    instruction_sets.push_back(instruction_set);
+            }
+
+            return instruction_sets;
+        }
+
+        static DATA_TYPE compute(ml::computation::simd::Operation operation, DATA_TYPE lhs, DATA_TYPE rhs)
+        {
+            switch (operation)
+            {
+                case ml::computation::simd::Operation::PLUS:
+                    return lhs + rhs;
+                case ml::computation::simd::Operation::MINUS:
+                    return lhs - rhs;
+                case ml::computation::simd::Operation::MULTIPLIES:
+                    return lhs * rhs;
+                default:
+                    return lhs / rhs;
+            }
+        }
+    };
+
+    using ComputationSimdTypes = testing::Types<float, double>;
+    TYPED_TEST_SUITE(ComputationSimd, ComputationSimdTypes, );
+
+    static constexpr ml::computation::simd::Operation COMPUTATION_SIMD_OPERATIONS[] = {
+        ml::computation::simd::Operation::PLUS,
+        ml::computation::simd::Operation::MINUS,
+        ml::computation::simd::Operation::MULTIPLIES,
+        ml::computation::simd::Operation::DIVIDES};
+
+    TYPED_TEST(ComputationSimd, EveryInstructionSet)
+    {
+        // Sizes around the widths of the vectors so that every remainder loop runs
+        for (auto instruction_set : TestFixture::instruction_sets())
+        {
+            ml::computation::simd::set_instruction_set(instruction_set);
+
+            for (auto operation : COMPUTATION_SIMD_OPERATIONS)
+            {
+                for (size_t size : {0, 1, 3, 7, 8, 15, 16, 17, 33, 100})
+                {
+                    std::vector<TypeParam> lhs(size);
+                    std::vector<TypeParam> rhs(size);
+                    for (size_t i = 0; i < size; i++)
+                    {
+                        lhs[i] = static_cast<TypeParam>(i % 11) - TypeParam(4.5);
+                        rhs[i] = static_cast<TypeParam>(i % 7) + TypeParam(0.25);
+                    }
+
+                    std::vector<TypeParam> result(size);
+                    std::vector<TypeParam> result_scalar_rhs(size);
+                    std::vector<TypeParam> result_scalar_lhs(size);
+                    ml::computation::simd::apply(operation, lhs.data(), rhs.data(), result.data(), size);
+                    ml::computation::simd::apply(
+                        operation, lhs.data(), TypeParam(1.5), result_scalar_rhs.data(), size);
+                    ml::computation::simd::apply(
+                        operation, TypeParam(-2.5), rhs.data(), result_scalar_lhs.data(), size);
+
+                    for (size_t i = 0; i < size; i++)
+                    {
+                        EXPECT_FLOAT_EQ(TestFixture::compute(operation, lhs[i], rhs[i]), result[i]);
+                        EXPECT_FLOAT_EQ(TestFixture::compute(operation, lhs[i], TypeParam(1.5)),
+                                        result_scalar_rhs[i]);
+                        EXPECT_FLOAT_EQ(TestFixture::compute(operation, TypeParam(-2.5), rhs[i]),
+                                        result_scalar_lhs[i]);
+                    }
+                }
+            }
+        }
+    }
+
+    TYPED_TEST(ComputationSimd, InPlace)
+    {
+        for (auto instruction_set : TestFixture::instruction_sets())
+        {
+            ml::computation::simd::set_instruction_set(instruction_set);
+
+            std::vector<TypeParam> data(37, TypeParam(2));
+            ml::computation::simd::apply(
+                ml::computation::simd::Operation::MULTIPLIES, data.data(), data.data(), data.data(), data.size());
+            ml::computation::simd::apply(
+                ml::computation::simd::Operation::MINUS, data.data(), TypeParam(1), data.data(), data.size());
+
+            EXPECT_EQ(std::vector<TypeParam>(37, TypeParam(3)), data);
+        }
+    }
+
+    TYPED_TEST(ComputationSimd, Dispatch)
+    {
+        for (auto instruction_set : TestFixture::instruction_sets())
+        {
+            ml::computation::simd::set_instruction_set(instruction_set);
+
+            std::vector<TypeParam> data(29);
+            ml::computation::simd::dispatch([&data]() {
+                for (size_t i = 0; i < data.size(); i++)
+                    data[i] = static_cast<TypeParam>(i) * 2;
+            });
+
+            for (size_t i = 0; i < data.size(); i++)
+                EXPECT_EQ(static_cast<TypeParam>(i) * 2, data[i]);
+        }
+    }
+
+    TEST(ComputationSimd, UnsupportedInstructionSet)
+    {
+        ml::computation::simd::set_instruction_set(ml::computation::simd::InstructionSet::SCALAR);
+        EXPECT_EQ(ml::computation::simd::InstructionSet::SCALAR, ml::computation::simd::get_instruction_set());
+
+        if (ml::computation::simd::get_supported_instruction_set() != ml::computation::simd::InstructionSet::AVX512)
+        {
+            EXPECT_THROW(ml::computation::simd::set_instruction_set(ml::computation::simd::InstructionSet::AVX512),
+                         std::invalid_argument);
+        }
+
+        ml::computation::simd::set_instruction_set(ml::computation::simd::get_supported_instruction_set());
+    }
+} // namespace tests::unit_tests
@@ -0,0 +1,228 @@
+/**
+ ** @file tests/unit_tests/computation/sort.cc
+ ** @brief Tests for the ml::computation::sort functions
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "computation/sort.hh"
+#include "gtest/gtest.h"
+#include "parallel/thread_pool.hh"
+
+namespace tests::unit_tests
+{
+    template <typename DATA_TYPE>
+    class ComputationSort : public testing::Test
+    {
+    protected:
+        /// A height x row_stride matrix of pseudo random values with duplicates
+        static std::vector<DATA_TYPE> generate(size_t height, size_t row_stride)
+        {
+            std::vector<DATA_TYPE> data(height * row_stride);
+            for (size_t i = 0; i < data.size(); i++)
+                data[i] = static_cast<DATA_TYPE>((i * 7919) % 211);
+
+            return data;
+        }
+
+        /// Pseudo random values with duplicates, negative ones for the signed types
+        static std::vector<DATA_TYPE> generate_signed(size_t size)
+        {
+            std::vector<DATA_TYPE> data(size);
+            for (size_t i = 0; i < size; i++)
+            {
+                const auto value = static_cast<long>((i * 7919) % 4093) - 2000;
+                data[i] = static_cast<DATA_TYPE>(value) / static_cast<DATA_TYPE>(3);
+            }
+
+            return data;
+        }
+
+        /// Sort the height x width columns one by one in a copy, the elements after width on each row are untouched
+        template <class Compare>
+        static std::vector<DATA_TYPE> expected(std::vector<DATA_TYPE> data,
+                                               size_t height,
+                                               size_t width,
+                                               size_t row_stride,
+                                               const Compare& compare)
+        {
+            std::vector<DATA_TYPE> column(height);
+            for (size_t j = 0; j < width; j++)
+            {
+                for (size_t i = 0; i < height; i++)
+                    column[i] = data[i * row_stride + j];
+
+                std::sort(column.begin(), column.end(), compare);
+
+                for (size_t i = 0; i < height; i++)
+                    data[i * row_stride + j] = column[i];
+            }
+
+            return data;
+        }
+    };
+
+    using ComputationSortTypes = testing::Types<int, float, double>;
+    TYPED_TEST_SUITE(ComputationSort, ComputationSortTypes, );
+
+    TYPED_TEST(ComputationSort, SortColumns)
+    {
+        // Widths on both sides of the in place cutover, split in several gathered blocks for the higher columns
+        for (size_t height : {0, 1, 5, 64, 65, 300, 2000})
+        {
+            for (size_t width : {1, 2, 3, 40})
+            {
+                const size_t row_stride = width + 2;
+                const auto data = TestFixture::generate(height, row_stride);
+                const auto expected = TestFixture::expected(data, height, width, row_stride, std::less<TypeParam>());
+
+                auto strided = data;
+                ml::computation::sort::sort_columns_strided(
+                    height, width, strided.data(), row_stride, std::less<TypeParam>());
+                EXPECT_EQ(expected, strided) << height << "x" << width;
+
+                auto gathered = data;
+                ml::computation::sort::sort_columns_gathered(
+                    height, width, gathered.data(), row_stride, std::less<TypeParam>());
+                EXPECT_EQ(expected, gathered) << height << "x" << width;
+
+                auto sorted = data;
+                ml::computation::sort::sort_columns(height, width, sorted.data(), row_stride, std::less<TypeParam>());
+                EXPECT_EQ(expected, sorted) << height << "x" << width;
+            }
+        }
+    }
+
+    TYPED_TEST(ComputationSort, SortColumnsParallel)
+    {
+        const size_t thread_count = ml::parallel::get_thread_count();
+        ml::parallel::set_thread_count(3);
+
+        // Large enough to be split between the threads, in blocks of GATHER_SIZE / height columns
+        for (size_t height : {16, 1500})
+        {
+            const size_t width = ml::computation::sort::PARALLEL_SORT_SIZE / height + 97;
+            const auto data = TestFixture::generate(height, width);
+            const auto expected = TestFixture::expected(data, height, width, width, std::greater<TypeParam>());
+
+            auto strided = data;
+            ml::computation::sort::sort_columns_strided(
+                height, width, strided.data(), width, std::greater<TypeParam>());
+            EXPECT_EQ(expected, strided) << height;
+
+            auto gathered = data;
+            ml::computation::sort::sort_columns_gathered(
+                height, width, gathered.data(), width, std::greater<TypeParam>());
+            EXPECT_EQ(expected, gathered) << height;
+        }
+
+        ml::parallel::set_thread_count(thread_count);
+    }
+
+    TYPED_TEST(ComputationSort, RadixSort)
+    {
+        for (size_t size : {0, 1, 2, 100, 5000})
+        {
+            auto data = TestFixture::generate_signed(size);
+
+            auto ascending = data;
+            std::sort(ascending.begin(), ascending.end(), std::less<TypeParam>());
+            auto radix_ascending = data;
+            ml::computation::sort::radix_sort(
+                radix_ascending.data(), radix_ascending.data() + size, std::less<TypeParam>());
+            EXPECT_EQ(ascending, radix_ascending) << size;
+
+            auto descending = data;
+            std::sort(descending.begin(), descending.end(), std::greater<>());
+            auto radix_descending = data;
+            ml::computation::sort::radix_sort(
+                radix_descending.data(), radix_descending.data() + size, std::greater<>());
+            EXPECT_EQ(descending, radix_descending) << size;
+        }
+    }
+
+    TYPED_TEST(ComputationSort, MergeSort)
+    {
+        const size_t thread_count = ml::parallel::get_thread_count();
+
+        // Comparison by absolute value, equivalent elements are not equal so only std::sort's order is checked
+        const auto compare = [](const TypeParam& lhs, const TypeParam& rhs) {
+            return (lhs < 0 ? -lhs : lhs) < (rhs < 0 ? -rhs : rhs);
+        };
+        const auto data = TestFixture::generate_signed(ml::computation::sort::PARALLEL_SORT_SIZE + 1234);
+
+        for (size_t count : {1, 2, 3, 4, 7})
+        {
+            ml::parallel::set_thread_count(count);
+
+            auto merged = data;
+            ml::computation::sort::merge_sort(merged.data(), merged.data() + merged.size(), compare);
+            EXPECT_TRUE(std::is_sorted(merged.begin(), merged.end(), compare)) << count;
+            EXPECT_TRUE(std::is_permutation(merged.begin(), merged.end(), data.begin())) << count;
+
+            auto sorted = data;
+            ml::computation::sort::sort(sorted.data(), sorted.data() + sorted.size(), std::less<TypeParam>());
+            EXPECT_TRUE(std::is_sorted(sorted.begin(), sorted.end())) << count;
+            EXPECT_TRUE(std::is_permutation(sorted.begin(), sorted.end(), data.begin())) << count;
+        }
+
+        ml::parallel::set_thread_count(thread_count);
+    }
+
+    TYPED_TEST(ComputationSort, SortRows)
+    {
+        const size_t thread_count = ml::parallel::get_thread_count();
+
+        // Few long rows sorted one after the other, many short rows split between the threads
+        for (size_t count : {1, 4})
+        {
+            ml::parallel::set_thread_count(count);
+
+            for (size_t height : {2, 100})
+            {
+                const size_t width = ml::computation::sort::PARALLEL_SORT_SIZE / height + 31;
+                const size_t row_stride = width + 3;
+                const auto data = TestFixture::generate_signed(height * row_stride);
+
+                auto expected = data;
+                for (size_t i = 0; i < height; i++)
+                    std::sort(expected.begin() + i * row_stride, expected.begin() + i * row_stride + width);
+
+                auto sorted = data;
+                ml::computation::sort::sort_rows(height, width, sorted.data(), row_stride, std::less<TypeParam>());
+                EXPECT_EQ(expected, sorted) << count << " " << height;
+            }
+        }
+
+        ml::parallel::set_thread_count(thread_count);
+    }
+
+    TEST(ComputationSortRadix, Types)
+    {
+        EXPECT_TRUE((ml::computation::sort::is_radix_sortable_v<float, std::less<float>>));
+        EXPECT_TRUE((ml::computation::sort::is_radix_sortable_v<int8_t, std::greater<>>));
+        EXPECT_FALSE((ml::computation::sort::is_radix_sortable_v<bool, std::less<bool>>));
+        EXPECT_FALSE((ml::computation::sort::is_radix_sortable_v<long double, std::less<long double>>));
+        EXPECT_FALSE((ml::computation::sort::is_radix_sortable_v<int, std::less_equal<int>>));
+
+        std::vector<int8_t> small({5, -128, 127, 0, -1, 1, -128});
+        ml::computation::sort::radix_sort(small.data(), small.data() + small.size(), std::less<int8_t>());
+        EXPECT_EQ(std::vector<int8_t>({-128, -128, -1, 0, 1, 5, 127}), small);
+
+        std::vector<uint16_t> unsigned_data({65535, 0, 256, 255, 1, 256});
+        ml::computation::sort::radix_sort(
+            unsigned_data.data(), unsigned_data.data() + unsigned_data.size(), std::greater<uint16_t>());
+        EXPECT_EQ(std::vector<uint16_t>({65535, 256, 256, 255, 1, 0}), unsigned_data);
+
+        std::vector<int64_t> large({INT64_MAX, INT64_MIN, -1, 0, 1LL << 40, -(1LL << 40)});
+        ml::computation::sort::radix_sort(large.data(), large.data() + large.size(), std::less<>());
+        EXPECT_EQ(std::vector<int64_t>({INT64_MIN, -(1LL << 40), -1, 0, 1LL << 40, INT64_MAX}), large);
+
+        std::vector<double> special({0.5, -0.0, -1e300, 1e-300, -2.5, 3.0});
+        ml::computation::sort::radix_sort(special.data(), special.data() + special.size(), std::less<double>());
+        EXPECT_EQ(std::vector<double>({-1e300, -2.5, 0.0, 1e-300, 0.5, 3.0}), special);
+    }
+} // namespace tests::unit_tests
@@ -5,6 +5,12 @@
 
 #include "unit_tests/computation/statistic.hh"
 
+#include <algorithm>
+#include <cmath>
+
+#include "computation/statistic.hh"
+#include "parallel/thread_pool.hh"
+
 namespace tests::unit_tests
 {
     TYPED_TEST_SUITE(ComputationStatistic, ComputationStatisticTypes, );
@@ -40,4 +46,185 @@ namespace tests::unit_tests
 
         EXPECT_FLOAT_EQ(TypeParam::test_function({1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f}), result);
     }
+
+    TEST(ComputationStatisticMedian, InPlace)
+    {
+        std::vector<float> data({5.0f, 1.0f, 4.0f, 2.0f, 6.0f, 3.0f});
+        auto result = ml::computation::statistic::median_in_place(data.begin(), data.end());
+
+        EXPECT_FLOAT_EQ(3.5f, result);
+        EXPECT_TRUE(std::is_permutation(data.cbegin(), data.cend(), std::vector<float>({1, 2, 3, 4, 5, 6}).cbegin()));
+    }
+
+    TEST(ComputationStatisticMedian, BufferReused)
+    {
+        std::vector<float> buffer;
+        std::vector<float> data_even({4.0f, 1.0f, 3.0f, 2.0f});
+        std::vector<float> data_odd({7.0f, 5.0f, 9.0f});
+
+        EXPECT_FLOAT_EQ(2.5f, ml::computation::statistic::median(data_even.cbegin(), data_even.cend(), buffer));
+        EXPECT_FLOAT_EQ(7.0f, ml::computation::statistic::median(data_odd.cbegin(), data_odd.cend(), buffer));
+        EXPECT_FLOAT_EQ(3.0f, ml::computation::statistic::median(data_even.cbegin(), data_even.cend() - 1, buffer));
+        EXPECT_EQ(std::vector<float>({4.0f, 1.0f, 3.0f, 2.0f}), data_even);
+    }
+
+    TEST(ComputationStatisticDescribe, Describe)
+    {
+        std::vector<double> data(5000);
+        for (size_t i = 0; i < data.size(); i++)
+            data[i] = static_cast<double>((i * 7919) % 1013) / 10.0 - 20.0;
+
+        const auto description = ml::computation::statistic::describe(data.cbegin(), data.cend(), 1);
+
+        EXPECT_DOUBLE_EQ(ml::computation::statistic::sum(data.cbegin(), data.cend()), description.sum);
+        EXPECT_DOUBLE_EQ(*std::min_element(data.cbegin(), data.cend()), description.min);
+        EXPECT_DOUBLE_EQ(*std::max_element(data.cbegin(), data.cend()), description.max);
+        EXPECT_DOUBLE_EQ(ml::computation::statistic::mean(data.cbegin(), data.cend()), description.mean);
+        EXPECT_NEAR(ml::computation::statistic::variance(data.cbegin(), data.cend(), 1), description.variance, 1e-9);
+        EXPECT_NEAR(std::sqrt(description.variance), description.standard_deviation, 1e-12);
+        EXPECT_DOUBLE_EQ(description.max - description.min, description.peak_to_peak);
+    }
+
+    TEST(ComputationStatisticDescribe, DescribeColumnsRows)
+    {
+        std::vector<float> data({1.0f, 9.0f, 6.0f, 4.0f, 8.0f, 5.0f, 3.0f, 2.0f, 7.0f, 0.0f, 1.0f, 9.0f});
+        std::vector<float> columns(7 * 3);
+        std::vector<float> rows(7 * 4);
+
+        const auto pointers = [](std::vector<float>& values, size_t size) {
+            return ml::computation::statistic::Description<float*>{&values[0 * size],
+                                                                   &values[1 * size],
+                                                                   &values[2 * size],
+                                                                   &values[3 * size],
+                                                                   &values[4 * size],
+                                                                   &values[5 * size],
+                                                                   &values[6 * size]};
+        };
+        ml::computation::statistic::describe_columns(4, 3, data.data(), 3, pointers(columns, 3));
+        ml::computation::statistic::describe_rows(4, 3, data.data(), 3, pointers(rows, 4));
+
+        EXPECT_FLOAT_EQ(20.0f, columns[1]);
+        EXPECT_FLOAT_EQ(1.0f, columns[3 + 1]);
+        EXPECT_FLOAT_EQ(9.0f, columns[6 + 1]);
+        EXPECT_FLOAT_EQ(5.0f, columns[9 + 1]);
+        EXPECT_FLOAT_EQ(12.5f, columns[12 + 1]);
+        EXPECT_FLOAT_EQ(8.0f, columns[18 + 1]);
+        EXPECT_FLOAT_EQ(17.0f, rows[1]);
+        EXPECT_FLOAT_EQ(ml::computation::statistic::variance(data.cbegin() + 9, data.cend()), rows[16 + 3]);
+        EXPECT_FLOAT_EQ(std::sqrt(rows[16 + 3]), rows[20 + 3]);
+    }
+
+    TEST(ComputationStatisticDescribe, Empty)
+    {
+        const std::vector<float> data;
+        const auto description = ml::computation::statistic::describe(data.cbegin(), data.cend());
+
+        EXPECT_EQ(0.0f, description.sum);
+        EXPECT_EQ(0.0f, description.min);
+        EXPECT_EQ(0.0f, description.max);
+        EXPECT_EQ(0.0f, description.mean);
+        EXPECT_EQ(0.0f, description.variance);
+        EXPECT_EQ(0.0f, description.peak_to_peak);
+
+        // The rows of a matrix of width 0 are empty containers
+        std::vector<float> rows(7 * 2, -1.0f);
+        const ml::computation::statistic::Description<float*> pointers{
+            &rows[0], &rows[2], &rows[4], &rows[6], &rows[8], &rows[10], &rows[12]};
+        ml::computation::statistic::describe_rows(2, 0, data.data(), 0, pointers);
+        EXPECT_EQ(std::vector<float>(7 * 2, 0.0f), rows);
+    }
+
+    TEST(ComputationStatisticColumns, RowStride)
+    {
+        // Two columns of padding at the end of each row must not be read
+        std::vector<int> data({3, -1, 4, 99, 99, 1, 5, -9, 99, 99, 2, 6, 5, 99, 99});
+        std::vector<int> result(3);
+
+        ml::computation::statistic::sum_columns(3, 3, data.data(), 5, result.data());
+        EXPECT_EQ(std::vector<int>({6, 10, 0}), result);
+        ml::computation::statistic::min_columns(3, 3, data.data(), 5, result.data());
+        EXPECT_EQ(std::vector<int>({1, -1, -9}), result);
+        ml::computation::statistic::max_columns(3, 3, data.data(), 5, result.data());
+        EXPECT_EQ(std::vector<int>({3, 6, 5}), result);
+        ml::computation::statistic::mean_columns(3, 3, data.data(), 5, result.data());
+        EXPECT_EQ(std::vector<int>({2, 3, 0}), result);
+        ml::computation::statistic::sum_product_columns(3, 3, data.data(), 5, result.data());
+        EXPECT_EQ(std::vector<int>({6, -30, -180}), result);
+    }
+
+    TEST(ComputationStatisticColumns, AccumulateBlocks)
+    {
+        std::vector<double> data({1.0, 9.0, 6.0, 4.0, 8.0, 5.0, 3.0, 2.0, 7.0, 0.0, 1.0, 9.0, 4.0, 4.0, 2.0});
+        std::vector<double> variances(3);
+        ml::computation::statistic::variance_columns(5, 3, data.data(), 3, variances.data(), 1);
+
+        // The rows given in two blocks give the variances of the whole matrix
+        std::vector<ml::computation::statistic::VarianceAccumulator<double>> accumulators(3);
+        ml::computation::statistic::accumulate_columns(2, 3, data.data(), 3, accumulators.data());
+        ml::computation::statistic::accumulate_columns(0, 3, data.data() + 6, 3, accumulators.data());
+        ml::computation::statistic::accumulate_columns(3, 3, data.data() + 6, 3, accumulators.data());
+
+        for (size_t j = 0; j < 3; j++)
+        {
+            EXPECT_EQ(5, accumulators[j].get_count());
+            EXPECT_DOUBLE_EQ(variances[j], accumulators[j].get_variance(1));
+        }
+        EXPECT_DOUBLE_EQ(2.4, accumulators[0].get_mean());
+    }
+
+    TEST(ComputationStatisticParallel, SameAsSequential)
+    {
+        const size_t thread_count = ml::parallel::get_thread_count();
+        ml::parallel::set_thread_count(4);
+
+        std::vector<long> data(ml::computation::statistic::PARALLEL_REDUCTION_SIZE * 3 + 17);
+        for (size_t i = 0; i < data.size(); i++)
+            data[i] = static_cast<long>((i * 7919) % 1013) - 500;
+
+        std::vector<double> data_double(data.cbegin(), data.cend());
+        const double variance = ml::computation::statistic::variance(data_double.cbegin(), data_double.cend(), 1);
+
+        for (const auto execution :
+             {ml::computation::statistic::Execution::PARALLEL, ml::computation::statistic::Execution::DETERMINISTIC})
+        {
+            EXPECT_EQ(ml::computation::statistic::sum(data.cbegin(), data.cend()),
+                      ml::computation::statistic::sum(data.cbegin(), data.cend(), execution));
+            EXPECT_EQ(ml::computation::statistic::mean(data.cbegin(), data.cend()),
+                      ml::computation::statistic::mean(data.cbegin(), data.cend(), execution));
+            EXPECT_NEAR(
+                variance,
+                ml::computation::statistic::variance(data_double.cbegin(), data_double.cend(), 1, execution),
+                1e-9 * variance);
+            EXPECT_NEAR(std::sqrt(variance),
+                        ml::computation::statistic::standard_deviation(
+                            data_double.cbegin(), data_double.cend(), 1, execution),
+                        1e-9 * variance);
+        }
+
+        ml::parallel::set_thread_count(thread_count);
+    }
+
+    TEST(ComputationStatisticParallel, Deterministic)
+    {
+        const size_t thread_count = ml::parallel::get_thread_count();
+
+        std::vector<float> data(ml::computation::statistic::REDUCTION_CHUNK_SIZE * 9 + 5);
+        for (size_t i = 0; i < data.size(); i++)
+            data[i] = static_cast<float>((i * 7919) % 1013) / 7.0f;
+
+        const auto execution = ml::computation::statistic::Execution::DETERMINISTIC;
+        ml::parallel::set_thread_count(1);
+        const float sum = ml::computation::statistic::sum(data.cbegin(), data.cend(), execution);
+        const float variance = ml::computation::statistic::variance(data.cbegin(), data.cend(), 0, execution);
+
+        // Bitwise the same results, whatever the number of threads reducing the chunks
+        for (size_t count : {2, 3, 4, 7})
+        {
+            ml::parallel::set_thread_count(count);
+            EXPECT_EQ(sum, ml::computation::statistic::sum(data.cbegin(), data.cend(), execution));
+            EXPECT_EQ(variance, ml::computation::statistic::variance(data.cbegin(), data.cend(), 0, execution));
+        }
+
+        ml::parallel::set_thread_count(thread_count);
+    }
 } // namespace tests::unit_tests
@@ -0,0 +1,94 @@
+/**
+ ** @file tests/unit_tests/computation/transpose.cc
+ ** @brief Tests for the ml::computation::transpose functions
+ */
+
+#include <functional>
+#include <vector>
+
+#include "computation/simd.hh"
+#include "computation/transpose.hh"
+#include "gtest/gtest.h"
+
+namespace tests::unit_tests
+{
+    template <typename DATA_TYPE>
+    class ComputationTranspose : public testing::Test
+    {
+    protected:
+        void TearDown() override
+        {
+            ml::computation::simd::set_instruction_set(ml::computation::simd::get_supported_instruction_set());
+        }
+
+        static std::vector<DATA_TYPE> iota(size_t size)
+        {
+            std::vector<DATA_TYPE> data(size);
+            for (size_t i = 0; i < size; i++)
+                data[i] = static_cast<DATA_TYPE>(i);
+
+            return data;
+        }
+
+        /// Every instruction set supported by the CPU, to check each tile kernel
+        static void for_each_instruction_set(const std::function<void()>& function)
+        {
+            for (auto instruction_set : {ml::computation::simd::InstructionSet::SCALAR,
+                                         ml::computation::simd::InstructionSet::SSE2,
+                                         ml::computation::simd::InstructionSet::AVX2,
+                                         ml::computation::simd::InstructionSet::AVX512})
+            {
+                if (instruction_set > ml::computation::simd::get_supported_instruction_set())
+                    continue;
+
+                ml::computation::simd::set_instruction_set(instruction_set);
+                function();
+            }
+        }
+    };
+
+    using ComputationTransposeTypes = testing::Types<int, float, double>;
+    TYPED_TEST_SUITE(ComputationTranspose, ComputationTransposeTypes, );
+
+    TYPED_TEST(ComputationTranspose, Copy)
+    {
+        // Shapes below, at and above the tiles and blocks, with edges left on both sides
+        TestFixture::for_each_instruction_set([]() {
+            for (size_t height : {1, 3, 8, 17, 32, 33, 100})
+            {
+                for (size_t width : {1, 4, 9, 31, 64, 75})
+                {
+                    const auto& source = TestFixture::iota(height * width);
+                    std::vector<TypeParam> destination(height * width);
+
+                    ml::computation::transpose::copy(height, width, source.data(), destination.data());
+
+                    for (size_t i = 0; i < height; i++)
+                    {
+                        for (size_t j = 0; j < width; j++)
+                            ASSERT_EQ(source[i * width + j], destination[j * height + i]);
+                    }
+                }
+            }
+        });
+    }
+
+    TYPED_TEST(ComputationTranspose, InPlace)
+    {
+        TestFixture::for_each_instruction_set([]() {
+            for (size_t size : {0, 1, 2, 5, 8, 32, 33, 47, 64, 130})
+            {
+                const auto& source = TestFixture::iota(size * size);
+                auto data = source;
+
+                ml::computation::transpose::in_place(size, data.data());
+
+                for (size_t i = 0; i < size; i++)
+                {
+                    for (size_t j = 0; j < size; j++)
+                        ASSERT_EQ(source[i * size + j], data[j * size + i]);
+                }
+            }
+        });
+    }
+} // namespace tests::unit_tests
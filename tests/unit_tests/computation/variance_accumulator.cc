@@ -0,0 +1,185 @@
+/**
+ ** @file tests/unit_tests/computation/variance_accumulator.cc
+ ** @brief Tests for ml::computation::statistic::VarianceAccumulator and the one-sweep column variance
+ */
+
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "computation/statistic.hh"
+#include "gtest/gtest.h"
+
+namespace tests::unit_tests
+{
+    template <typename DATA_TYPE>
+    class ComputationVarianceAccumulator : public testing::Test
+    {
+    protected:
+        /// Values around a large offset, where the sum of squares formula loses every significant digit
+        static std::vector<DATA_TYPE> offset_data(size_t size)
+        {
+            std::vector<DATA_TYPE> data(size);
+            for (size_t i = 0; i < size; i++)
+                data[i] = static_cast<DATA_TYPE>(10000 + static_cast<int>(i % 7) - 3);
+
+            return data;
+        }
+
+        /// Two-pass variance in long double
+        template <class Iterator>
+        static double reference_variance(const Iterator& begin, const Iterator& end, size_t ddof)
+        {
+            long double mean = 0;
+            for (auto it = begin; it != end; ++it)
+                mean += *it;
+            mean /= static_cast<long double>(end - begin);
+
+            long double squared_error = 0;
+            for (auto it = begin; it != end; ++it)
+                squared_error += (*it - mean) * (*it - mean);
+
+            return static_cast<double>(squared_error / static_cast<long double>((end - begin) - ddof));
+        }
+    };
+
+    using ComputationVarianceAccumulatorTypes = testing::Types<float, double>;
+    TYPED_TEST_SUITE(ComputationVarianceAccumulator, ComputationVarianceAccumulatorTypes, );
+
+    TYPED_TEST(ComputationVarianceAccumulator, AddRange)
+    {
+        // Sizes below, at and above the block size
+        for (size_t size : {1, 5, 2048, 2049, 10000})
+        {
+            const auto data = TestFixture::offset_data(size);
+            const auto variance = ml::computation::statistic::variance(data.cbegin(), data.cend());
+
+            EXPECT_NEAR(TestFixture::reference_variance(data.cbegin(), data.cend(), 0), variance, 1e-3);
+        }
+    }
+
+    TYPED_TEST(ComputationVarianceAccumulator, AddValue)
+    {
+        const auto data = TestFixture::offset_data(1000);
+
+        ml::computation::statistic::VarianceAccumulator<TypeParam> accumulator;
+        for (const auto& value : data)
+            accumulator.add(value);
+
+        EXPECT_EQ(1000, accumulator.get_count());
+        EXPECT_NEAR(TestFixture::reference_variance(data.cbegin(), data.cend(), 1), accumulator.get_variance(1), 1e-3);
+    }
+
+    TYPED_TEST(ComputationVarianceAccumulator, Merge)
+    {
+        const auto data = TestFixture::offset_data(5000);
+
+        ml::computation::statistic::VarianceAccumulator<TypeParam> accumulator;
+        ml::computation::statistic::VarianceAccumulator<TypeParam> other;
+        accumulator.add(data.cbegin(), data.cbegin() + 1234);
+        other.add(data.cbegin() + 1234, data.cend());
+        accumulator.merge(other).merge(ml::computation::statistic::VarianceAccumulator<TypeParam>());
+
+        EXPECT_EQ(5000, accumulator.get_count());
+        EXPECT_NEAR(std::accumulate(data.cbegin(), data.cend(), 0.0) / 5000, accumulator.get_mean(), 1e-3);
+        EXPECT_NEAR(TestFixture::reference_variance(data.cbegin(), data.cend(), 0), accumulator.get_variance(), 1e-3);
+    }
+
+    TYPED_TEST(ComputationVarianceAccumulator, TooFewElements)
+    {
+        ml::computation::statistic::VarianceAccumulator<TypeParam> accumulator;
+        EXPECT_THROW(accumulator.get_variance(), std::invalid_argument);
+
+        accumulator.add(TypeParam(3)).add(TypeParam(5));
+        EXPECT_EQ(TypeParam(2), accumulator.get_variance(1));
+        EXPECT_THROW(accumulator.get_variance(2), std::invalid_argument);
+
+        const std::vector<TypeParam> data({TypeParam(1)});
+        EXPECT_THROW(ml::computation::statistic::variance(data.cbegin(), data.cend(), 1), std::invalid_argument);
+
+        // One row of three columns, for the kernels of the columns
+        const std::vector<TypeParam> row({TypeParam(1), TypeParam(2), TypeParam(3)});
+        std::vector<TypeParam> result(3 * 7);
+        EXPECT_THROW(ml::computation::statistic::variance_columns(1, 3, row.data(), 3, result.data(), 1),
+                     std::invalid_argument);
+
+        const ml::computation::statistic::Description<TypeParam*> description{&result[0],
+                                                                                &result[3],
+                                                                                &result[6],
+                                                                                &result[9],
+                                                                                &result[12],
+                                                                                &result[15],
+                                                                                &result[18]};
+        EXPECT_THROW(ml::computation::statistic::describe_columns(1, 3, row.data(), 3, description, 1),
+                     std::invalid_argument);
+
+        ml::computation::statistic::variance_columns(1, 3, row.data(), 3, result.data());
+        result.resize(3);
+        EXPECT_EQ(std::vector<TypeParam>(3, TypeParam(0)), result);
+    }
+
+    TEST(ComputationVarianceAccumulatorInteger, SameOnEveryPath)
+    {
+        // The digits from 0 to 9 equally often, with a mean of 4.5 and a variance of 8.25
+        std::vector<int> data(5000);
+        for (size_t i = 0; i < data.size(); i++)
+            data[i] = static_cast<int>((i * 7919) % 10);
+
+        ml::computation::statistic::VarianceAccumulator<int> by_value;
+        for (const auto& value : data)
+            by_value.add(value);
+
+        ml::computation::statistic::VarianceAccumulator<int> by_range;
+        by_range.add(data.cbegin(), data.cend());
+
+        ml::computation::statistic::VarianceAccumulator<int> merged;
+        ml::computation::statistic::VarianceAccumulator<int> other;
+        merged.add(data.cbegin(), data.cbegin() + 1234);
+        for (auto it = data.cbegin() + 1234; it != data.cend(); ++it)
+            other.add(*it);
+        merged.merge(other);
+
+        for (const auto& accumulator : {by_value, by_range, merged})
+        {
+            EXPECT_NEAR(4.5, accumulator.get_mean(), 1e-9);
+            EXPECT_NEAR(8.25 * 5000, accumulator.get_squared_error(), 1e-6);
+            EXPECT_EQ(8, accumulator.get_variance());
+        }
+
+        // The data as one column, swept by blocks of rows
+        int column_variance = 0;
+        ml::computation::statistic::variance_columns(data.size(), 1, data.data(), 1, &column_variance);
+
+        EXPECT_EQ(8, ml::computation::statistic::variance(data.cbegin(), data.cend()));
+        EXPECT_EQ(8, ml::computation::statistic::describe(data.cbegin(), data.cend()).variance);
+        EXPECT_EQ(8, column_variance);
+    }
+
+    TYPED_TEST(ComputationVarianceAccumulator, VarianceColumns)
+    {
+        // Heights below and above one block of rows, and widths wider than a block, with padded rows
+        for (size_t height : {1, 3, 300})
+        {
+            for (size_t width : {1, 7, 3000})
+            {
+                const size_t row_stride = width + 3;
+                std::vector<TypeParam> data(height * row_stride);
+                for (size_t i = 0; i < data.size(); i++)
+                    data[i] = static_cast<TypeParam>(10000 + static_cast<int>((i * 7919) % 11) - 5);
+
+                std::vector<TypeParam> result(width);
+                ml::computation::statistic::variance_columns(
+                    height, width, data.data(), static_cast<ptrdiff_t>(row_stride), result.data());
+
+                for (size_t j = 0; j < width; j++)
+                {
+                    std::vector<TypeParam> column(height);
+                    for (size_t i = 0; i < height; i++)
+                        column[i] = data[i * row_stride + j];
+
+                    EXPECT_NEAR(TestFixture::reference_variance(column.cbegin(), column.cend(), 0), result[j], 1e-3);
+                }
+            }
+        }
+    }
+} // namespace tests::unit_tests
@@ -0,0 +1,104 @@
+/**
+ ** @file tests/unit_tests/data_structure/iterator/strided_iterator.cc
+ ** @brief Tests for the ml::data_structure::iterator::StridedIterator functions
+ */
+
+#include "data_structure/iterator/strided_iterator.hh"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace tests::unit_tests
+{
+    /// Iterator over the columns of a matrix stored in a vector, whatever its width
+    using StridedColumnIterator = ml::data_structure::iterator::StridedIterator<std::vector<int>::iterator>;
+
+    TEST(DataStructureIteratorStridedIterator, Requirements)
+    {
+        std::vector<int> data({1, 2, 3});
+
+        EXPECT_EQ(typeid(std::random_access_iterator_tag), typeid(StridedColumnIterator::iterator_category));
+        EXPECT_EQ(typeid(int), typeid(StridedColumnIterator::value_type));
+        EXPECT_EQ(typeid(int&), typeid(StridedColumnIterator::reference));
+        EXPECT_EQ(3, StridedColumnIterator(data.begin(), 3).get_stride());
+    }
+
+    TEST(DataStructureIteratorStridedIterator, Access)
+    {
+        std::vector<int> data({1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+        StridedColumnIterator iterator(data.begin() + 1, 3);
+
+        EXPECT_EQ(2, *iterator);
+        EXPECT_EQ(8, iterator[2]);
+        EXPECT_EQ(11, *(iterator + 3));
+        EXPECT_EQ(11, *(3 + iterator));
+
+        *++iterator = 42;
+        EXPECT_EQ(42, data[4]);
+    }
+
+    TEST(DataStructureIteratorStridedIterator, Arithmetic)
+    {
+        std::vector<int> data({1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+        const StridedColumnIterator begin(data.begin() + 2, 3);
+        const StridedColumnIterator end(data.begin() + 2, 3, 4);
+
+        auto iterator = begin;
+        EXPECT_EQ(begin, iterator++);
+        EXPECT_EQ(6, *iterator);
+        iterator += 2;
+        EXPECT_EQ(12, *iterator);
+        EXPECT_EQ(end, ++iterator);
+        EXPECT_EQ(12, *--iterator);
+        EXPECT_EQ(12, *iterator--);
+        iterator -= 1;
+        EXPECT_EQ(6, *iterator);
+
+        EXPECT_EQ(4, end - begin);
+        EXPECT_EQ(-3, (begin + 1) - end);
+        EXPECT_EQ(9, *(end - 2));
+    }
+
+    TEST(DataStructureIteratorStridedIterator, Comparators)
+    {
+        std::vector<int> data({1, 2, 3, 4, 5, 6});
+        const StridedColumnIterator first(data.begin(), 3);
+        const StridedColumnIterator second(data.begin(), 3, 1);
+
+        EXPECT_TRUE(first < second);
+        EXPECT_TRUE(second > first);
+        EXPECT_TRUE(first <= first);
+        EXPECT_TRUE(second >= first);
+        EXPECT_TRUE(first != second);
+        EXPECT_FALSE(first == second);
+        EXPECT_FALSE(second <= first);
+    }
+
+    TEST(DataStructureIteratorStridedIterator, Stride)
+    {
+        std::vector<int> data(12);
+        std::iota(data.begin(), data.end(), 0);
+
+        // The same type iterates over any stride, including a reversed one
+        const StridedColumnIterator even(data.begin(), 2);
+        const StridedColumnIterator fourth(data.begin() + 1, 4);
+        const StridedColumnIterator reversed(data.begin() + 11, -1);
+
+        EXPECT_EQ(std::vector<int>({0, 2, 4, 6, 8, 10}), std::vector<int>(even, even + 6));
+        EXPECT_EQ(std::vector<int>({1, 5, 9}), std::vector<int>(fourth, fourth + 3));
+        EXPECT_EQ(std::vector<int>({11, 10, 9, 8}), std::vector<int>(reversed, reversed + 4));
+        EXPECT_EQ(-1, reversed.get_stride());
+    }
+
+    TEST(DataStructureIteratorStridedIterator, Sort)
+    {
+        std::vector<int> data({9, 1, 8, 2, 7, 3, 6, 4, 5, 5, 4, 6, 3, 7, 2, 8, 1, 9});
+
+        std::sort(StridedColumnIterator(data.begin() + 1, 3), StridedColumnIterator(data.begin() + 1, 3, 6));
+
+        EXPECT_EQ(std::vector<int>({9, 1, 8, 2, 1, 3, 6, 4, 5, 5, 4, 6, 3, 7, 2, 8, 7, 9}), data);
+    }
+} // namespace tests::unit_tests
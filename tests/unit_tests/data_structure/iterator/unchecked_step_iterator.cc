@@ -0,0 +1,85 @@
+/**
+ ** @file tests/unit_tests/data_structure/iterator/unchecked_step_iterator.cc
+ ** @brief Tests for the ml::data_structure::iterator::UncheckedStepIterator functions
+ */
+
+#include "data_structure/iterator/unchecked_step_iterator.hh"
+
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace tests::unit_tests
+{
+    /// Iterator over the columns of a matrix of width 3 stored in a vector
+    using UncheckedColumnIterator = ml::data_structure::iterator::UncheckedStepIterator<std::vector<int>::iterator, 3>;
+
+    TEST(DataStructureIteratorUncheckedStepIterator, Requirements)
+    {
+        EXPECT_EQ(typeid(std::random_access_iterator_tag), typeid(UncheckedColumnIterator::iterator_category));
+        EXPECT_EQ(typeid(int), typeid(UncheckedColumnIterator::value_type));
+        EXPECT_EQ(typeid(int&), typeid(UncheckedColumnIterator::reference));
+        EXPECT_EQ(3, UncheckedColumnIterator::get_step());
+    }
+
+    TEST(DataStructureIteratorUncheckedStepIterator, Access)
+    {
+        std::vector<int> data({1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+        UncheckedColumnIterator iterator(data.begin() + 1);
+
+        EXPECT_EQ(2, *iterator);
+        EXPECT_EQ(8, iterator[2]);
+        EXPECT_EQ(11, *(iterator + 3));
+        EXPECT_EQ(11, *(3 + iterator));
+
+        *++iterator = 42;
+        EXPECT_EQ(42, data[4]);
+    }
+
+    TEST(DataStructureIteratorUncheckedStepIterator, Arithmetic)
+    {
+        std::vector<int> data({1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+        const UncheckedColumnIterator begin(data.begin() + 2);
+        const UncheckedColumnIterator end(data.begin() + 2, 4);
+
+        auto iterator = begin;
+        EXPECT_EQ(begin, iterator++);
+        EXPECT_EQ(6, *iterator);
+        iterator += 2;
+        EXPECT_EQ(12, *iterator);
+        EXPECT_EQ(end, ++iterator);
+        EXPECT_EQ(12, *--iterator);
+        EXPECT_EQ(12, *iterator--);
+        iterator -= 1;
+        EXPECT_EQ(6, *iterator);
+
+        EXPECT_EQ(4, end - begin);
+        EXPECT_EQ(-3, (begin + 1) - end);
+        EXPECT_EQ(9, *(end - 2));
+    }
+
+    TEST(DataStructureIteratorUncheckedStepIterator, Comparators)
+    {
+        std::vector<int> data({1, 2, 3, 4, 5, 6});
+        const UncheckedColumnIterator first(data.begin());
+        const UncheckedColumnIterator second(data.begin(), 1);
+
+        EXPECT_TRUE(first < second);
+        EXPECT_TRUE(second > first);
+        EXPECT_TRUE(first <= first);
+        EXPECT_TRUE(second >= first);
+        EXPECT_TRUE(first != second);
+        EXPECT_FALSE(first == second);
+        EXPECT_FALSE(second <= first);
+    }
+
+    TEST(DataStructureIteratorUncheckedStepIterator, Sort)
+    {
+        std::vector<int> data({9, 1, 8, 2, 7, 3, 6, 4, 5, 5, 4, 6, 3, 7, 2, 8, 1, 9});
+
+        std::sort(UncheckedColumnIterator(data.begin() + 1), UncheckedColumnIterator(data.begin() + 1, 6));
+
+        EXPECT_EQ(std::vector<int>({9, 1, 8, 2, 1, 3, 6, 4, 5, 5, 4, 6, 3, 7, 2, 8, 7, 9}), data);
+    }
+} // namespace tests::unit_tests
@@ -0,0 +1,151 @@
+/**
+ ** @file tests/unit_tests/data_structure/matrix/dynamic_matrix_arithmetic_operations.cc
+ ** @brief Tests for arithmetic operation functions of ml::data_structure::matrix::DynamicMatrix
+ */
+
+#include "data_structure/matrix/dynamic_matrix.hh"
+#include "gtest/gtest.h"
+#include "unit_tests/data_structure/matrix/matrix_arithmetic_operations.hh"
+
+namespace tests::unit_tests
+{
+    TYPED_TEST_SUITE(DataStructureDynamicMatrixArithmeticOperation, ArithmeticOperations, );
+    TYPED_TEST_SUITE(DataStructureDynamicMatrixArithmeticScalarOperation, ArithmeticScalarOperations, );
+
+    TEST(DataStructureDynamicMatrix, Negate)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(3, 2, {1, 2, 3, 4, 5, 6});
+        const ml::data_structure::matrix::DynamicMatrix<int> matrix_result = -matrix;
+
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(3, 2, {-1, -2, -3, -4, -5, -6}), matrix_result);
+    }
+
+    TYPED_TEST(DataStructureDynamicMatrixArithmeticOperation, SameSizeInPlace)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_1(3, 2, {1, 2, 3, 4, 5, 6});
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_2(3, 2, {1, 2, 3, 4, 5, 6});
+
+        TypeParam::function_in_place(matrix_1, matrix_2);
+
+        EXPECT_EQ(TypeParam::operation_function(1, 1), matrix_1(0, 0));
+        EXPECT_EQ(TypeParam::operation_function(2, 2), matrix_1(0, 1));
+        EXPECT_EQ(TypeParam::operation_function(3, 3), matrix_1(1, 0));
+        EXPECT_EQ(TypeParam::operation_function(4, 4), matrix_1(1, 1));
+        EXPECT_EQ(TypeParam::operation_function(5, 5), matrix_1(2, 0));
+        EXPECT_EQ(TypeParam::operation_function(6, 6), matrix_1(2, 1));
+    }
+
+    TYPED_TEST(DataStructureDynamicMatrixArithmeticOperation, WrongSizeInPlace)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_1(3, 2, {1, 2, 3, 4, 5, 6});
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_2(1, 2, {1, 2});
+
+        EXPECT_THROW(TypeParam::function_in_place(matrix_1, matrix_2), std::invalid_argument);
+    }
+
+    TYPED_TEST(DataStructureDynamicMatrixArithmeticOperation, SameSize)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_1(3, 2, {1, 2, 3, 4, 5, 6});
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_2(3, 2, {1, 2, 3, 4, 5, 6});
+
+        const auto& matrix_result = TypeParam::function(matrix_1, matrix_2);
+
+        EXPECT_EQ(TypeParam::operation_function(1, 1), matrix_result(0, 0));
+        EXPECT_EQ(TypeParam::operation_function(2, 2), matrix_result(0, 1));
+        EXPECT_EQ(TypeParam::operation_function(3, 3), matrix_result(1, 0));
+        EXPECT_EQ(TypeParam::operation_function(4, 4), matrix_result(1, 1));
+        EXPECT_EQ(TypeParam::operation_function(5, 5), matrix_result(2, 0));
+        EXPECT_EQ(TypeParam::operation_function(6, 6), matrix_result(2, 1));
+    }
+
+    TYPED_TEST(DataStructureDynamicMatrixArithmeticOperation, RightRow)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_1(3, 2, {1, 2, 3, 4, 5, 6});
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_2(1, 2, {1, 2});
+
+        const auto& matrix_result = TypeParam::function(matrix_1, matrix_2);
+
+        EXPECT_EQ(TypeParam::operation_function(1, 1), matrix_result(0, 0));
+        EXPECT_EQ(TypeParam::operation_function(2, 2), matrix_result(0, 1));
+        EXPECT_EQ(TypeParam::operation_function(3, 1), matrix_result(1, 0));
+        EXPECT_EQ(TypeParam::operation_function(4, 2), matrix_result(1, 1));
+        EXPECT_EQ(TypeParam::operation_function(5, 1), matrix_result(2, 0));
+        EXPECT_EQ(TypeParam::operation_function(6, 2), matrix_result(2, 1));
+    }
+
+    TYPED_TEST(DataStructureDynamicMatrixArithmeticOperation, LeftColumn)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_1(3, 1, {1, 2, 3});
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_2(3, 2, {1, 2, 3, 4, 5, 6});
+
+        const auto& matrix_result = TypeParam::function(matrix_1, matrix_2);
+
+        EXPECT_EQ(TypeParam::operation_function(1, 1), matrix_result(0, 0));
+        EXPECT_EQ(TypeParam::operation_function(1, 2), matrix_result(0, 1));
+        EXPECT_EQ(TypeParam::operation_function(2, 3), matrix_result(1, 0));
+        EXPECT_EQ(TypeParam::operation_function(2, 4), matrix_result(1, 1));
+        EXPECT_EQ(TypeParam::operation_function(3, 5), matrix_result(2, 0));
+        EXPECT_EQ(TypeParam::operation_function(3, 6), matrix_result(2, 1));
+    }
+
+    TYPED_TEST(DataStructureDynamicMatrixArithmeticOperation, LeftRowRightColumn)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_1(1, 2, {1, 2});
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_2(3, 1, {1, 2, 3});
+
+        const auto& matrix_result = TypeParam::function(matrix_1, matrix_2);
+
+        EXPECT_EQ(3, matrix_result.get_height());
+        EXPECT_EQ(2, matrix_result.get_width());
+        EXPECT_EQ(TypeParam::operation_function(1, 1), matrix_result(0, 0));
+        EXPECT_EQ(TypeParam::operation_function(2, 1), matrix_result(0, 1));
+        EXPECT_EQ(TypeParam::operation_function(1, 2), matrix_result(1, 0));
+        EXPECT_EQ(TypeParam::operation_function(2, 2), matrix_result(1, 1));
+        EXPECT_EQ(TypeParam::operation_function(1, 3), matrix_result(2, 0));
+        EXPECT_EQ(TypeParam::operation_function(2, 3), matrix_result(2, 1));
+    }
+
+    TYPED_TEST(DataStructureDynamicMatrixArithmeticOperation, WrongLeftRow)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_1(2, 2, {1, 2, 3, 4});
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_2(3, 2, {1, 2, 3, 4, 5, 6});
+
+        EXPECT_THROW(TypeParam::function(matrix_1, matrix_2), std::invalid_argument);
+    }
+
+    TYPED_TEST(DataStructureDynamicMatrixArithmeticOperation, WrongRight)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_1(3, 2, {1, 2, 3, 4, 5, 6});
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_2(2, 3, {1, 2, 3, 4, 5, 6});
+
+        EXPECT_THROW(TypeParam::function(matrix_1, matrix_2), std::invalid_argument);
+    }
+
+    TYPED_TEST(DataStructureDynamicMatrixArithmeticScalarOperation, ScalarInPlace)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(3, 2, {1, 2, 3, 4, 5, 6});
+
+        TypeParam::function_in_place(matrix, 2);
+
+        EXPECT_EQ(TypeParam::operation_function(1, 2), matrix(0, 0));
+        EXPECT_EQ(TypeParam::operation_function(2, 2), matrix(0, 1));
+        EXPECT_EQ(TypeParam::operation_function(3, 2), matrix(1, 0));
+        EXPECT_EQ(TypeParam::operation_function(4, 2), matrix(1, 1));
+        EXPECT_EQ(TypeParam::operation_function(5, 2), matrix(2, 0));
+        EXPECT_EQ(TypeParam::operation_function(6, 2), matrix(2, 1));
+    }
+
+    TYPED_TEST(DataStructureDynamicMatrixArithmeticScalarOperation, Scalar)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(3, 2, {1, 2, 3, 4, 5, 6});
+
+        const auto& matrix_result = TypeParam::function(matrix, 2);
+
+        EXPECT_EQ(TypeParam::operation_function(1, 2), matrix_result(0, 0));
+        EXPECT_EQ(TypeParam::operation_function(2, 2), matrix_result(0, 1));
+        EXPECT_EQ(TypeParam::operation_function(3, 2), matrix_result(1, 0));
+        EXPECT_EQ(TypeParam::operation_function(4, 2), matrix_result(1, 1));
+        EXPECT_EQ(TypeParam::operation_function(5, 2), matrix_result(2, 0));
+        EXPECT_EQ(TypeParam::operation_function(6, 2), matrix_result(2, 1));
+    }
+} // namespace tests::unit_tests
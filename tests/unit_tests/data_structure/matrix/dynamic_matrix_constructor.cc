@@ -0,0 +1,158 @@
+/**
+ ** @file tests/unit_tests/data_structure/matrix/dynamic_matrix_constructor.cc
+ ** @brief Tests for Constructor and accessor functions of ml::data_structure::matrix::DynamicMatrix
+ */
+
+#include <cstdint>
+
+#include "data_structure/matrix/dynamic_matrix.hh"
+#include "gtest/gtest.h"
+
+namespace tests::unit_tests
+{
+    TEST(DataStructureDynamicMatrix, EmptyConstructorSize)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix;
+
+        EXPECT_EQ(0, matrix.get_height());
+        EXPECT_EQ(0, matrix.get_width());
+        EXPECT_EQ(0, matrix.data().size());
+    }
+
+    TEST(DataStructureDynamicMatrix, ShapeConstructorValues)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(3, 2);
+
+        EXPECT_EQ(3, matrix.get_height());
+        EXPECT_EQ(2, matrix.get_width());
+        EXPECT_EQ(6, matrix.data().size());
+
+        for (size_t i = 0; i < 3; i++)
+        {
+            for (size_t j = 0; j < 2; j++)
+                EXPECT_EQ(0, matrix(i, j));
+        }
+    }
+
+    TEST(DataStructureDynamicMatrix, ValueConstructorValues)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(3, 2, 7);
+
+        for (size_t i = 0; i < 3; i++)
+        {
+            for (size_t j = 0; j < 2; j++)
+                EXPECT_EQ(7, matrix(i, j));
+        }
+    }
+
+    TEST(DataStructureDynamicMatrix, ArrayConstructorValues)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(3, 2, {1, 2, 3, 4, 5, 6});
+
+        EXPECT_EQ(1, matrix(0, 0));
+        EXPECT_EQ(2, matrix(0, 1));
+        EXPECT_EQ(3, matrix(1, 0));
+        EXPECT_EQ(4, matrix(1, 1));
+        EXPECT_EQ(5, matrix(2, 0));
+        EXPECT_EQ(6, matrix(2, 1));
+    }
+
+    TEST(DataStructureDynamicMatrix, ArrayConstructorWrongSize)
+    {
+        EXPECT_THROW(ml::data_structure::matrix::DynamicMatrix<int>(3, 2, {1, 2, 3, 4, 5}), std::invalid_argument);
+    }
+
+    TEST(DataStructureDynamicMatrix, MatrixConstructorValues)
+    {
+        ml::data_structure::matrix::Matrix<int, 3, 2> static_matrix({1, 2, 3, 4, 5, 6});
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(static_matrix);
+
+        EXPECT_EQ(3, matrix.get_height());
+        EXPECT_EQ(2, matrix.get_width());
+
+        for (size_t i = 0; i < 3; i++)
+        {
+            for (size_t j = 0; j < 2; j++)
+                EXPECT_EQ(static_matrix(i, j), matrix(i, j));
+        }
+    }
+
+    TEST(DataStructureDynamicMatrix, LargeAlignedStorage)
+    {
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(2000, 2000, 1.0f);
+
+        EXPECT_EQ(4000000, matrix.data().size());
+        EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(matrix.data().data()) % 64);
+        EXPECT_FLOAT_EQ(1.0f, matrix(1999, 1999));
+    }
+
+    TEST(DataStructureDynamicMatrix, At)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(1, 1, 1);
+        int& value = matrix.at(0, 0);
+
+        EXPECT_EQ(1, value);
+    }
+
+    TEST(DataStructureDynamicMatrix, AtWrongHeight)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(1, 1, 1);
+
+        EXPECT_THROW(([&] {
+                         int& value = matrix.at(1, 0);
+                         return value;
+                     }()),
+                     std::out_of_range);
+    }
+
+    TEST(DataStructureDynamicMatrix, AtWrongWidth)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(1, 1, 1);
+
+        EXPECT_THROW(([&] {
+                         int& value = matrix.at(0, 1);
+                         return value;
+                     }()),
+                     std::out_of_range);
+    }
+
+    TEST(DataStructureDynamicMatrix, GetBroadcastValue)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> row_matrix(1, 2, {1, 2});
+        ml::data_structure::matrix::DynamicMatrix<int> column_matrix(3, 1, {1, 2, 3});
+
+        EXPECT_EQ(2, row_matrix.get_broadcast_value(2, 1));
+        EXPECT_EQ(3, column_matrix.get_broadcast_value(2, 1));
+    }
+
+    TEST(DataStructureDynamicMatrix, Compare)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_1(3, 2, {1, 2, 3, 4, 5, 6});
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_2(3, 2, {1, 2, 3, 4, 5, 6});
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_3(2, 3, {1, 2, 3, 4, 5, 6});
+
+        EXPECT_TRUE(matrix_1 == matrix_2);
+        EXPECT_FALSE(matrix_1 != matrix_2);
+        EXPECT_FALSE(matrix_1 == matrix_3);
+    }
+
+    TEST(DataStructureDynamicMatrix, Apply)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(3, 2, {1, 2, 3, 4, 5, 6});
+        const auto& matrix_result = ml::data_structure::matrix::apply(matrix, [](const auto& value) {
+            return value * 2;
+        });
+
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(3, 2, {2, 4, 6, 8, 10, 12}), matrix_result);
+    }
+
+    TEST(DataStructureDynamicMatrix, Print)
+    {
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(3, 2, {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f});
+
+        std::stringstream string_stream;
+        string_stream << matrix << 1;
+
+        EXPECT_EQ("|  1.0000  2.0000 |\n|  3.0000  4.0000 |\n|  5.0000  6.0000 |\n1", string_stream.str());
+    }
+} // namespace tests::unit_tests
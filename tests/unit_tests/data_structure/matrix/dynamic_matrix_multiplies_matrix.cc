@@ -0,0 +1,102 @@
+/**
+ ** @file tests/unit_tests/data_structure/matrix/dynamic_matrix_multiplies_matrix.cc
+ ** @brief Tests for Multiplies Matrix and Transpose functions of ml::data_structure::matrix::DynamicMatrix
+ */
+
+#include "data_structure/matrix/dynamic_matrix.hh"
+#include "gtest/gtest.h"
+
+namespace tests::unit_tests
+{
+    TEST(DataStructureDynamicMatrix, Transpose)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(3, 2, {1, 2, 3, 4, 5, 6});
+        const auto& matrix_result = matrix.transpose();
+
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(2, 3, {1, 3, 5, 2, 4, 6}), matrix_result);
+    }
+
+    TEST(DataStructureDynamicMatrix, TransposeInPlace)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(3, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9});
+        matrix.transpose_in_place();
+
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(3, 3, {1, 4, 7, 2, 5, 8, 3, 6, 9}), matrix);
+    }
+
+    TEST(DataStructureDynamicMatrix, TransposeInPlaceNotSquare)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(3, 2, {1, 2, 3, 4, 5, 6});
+        matrix.transpose_in_place();
+
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(2, 3, {1, 3, 5, 2, 4, 6}), matrix);
+    }
+
+    TEST(DataStructureDynamicMatrix, MultiplyMatrix)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_1(3, 2, {1, 2, 3, 4, 5, 6});
+        const auto& matrix_2 = matrix_1.transpose();
+
+        const auto& matrix_result = ml::data_structure::matrix::multiplies_matrix(matrix_1, matrix_2);
+
+        EXPECT_EQ(3, matrix_result.get_height());
+        EXPECT_EQ(3, matrix_result.get_width());
+        EXPECT_EQ(1 * 1 + 2 * 2, matrix_result(0, 0));
+        EXPECT_EQ(1 * 3 + 2 * 4, matrix_result(0, 1));
+        EXPECT_EQ(1 * 5 + 2 * 6, matrix_result(0, 2));
+        EXPECT_EQ(3 * 1 + 4 * 2, matrix_result(1, 0));
+        EXPECT_EQ(3 * 3 + 4 * 4, matrix_result(1, 1));
+        EXPECT_EQ(3 * 5 + 4 * 6, matrix_result(1, 2));
+        EXPECT_EQ(5 * 1 + 6 * 2, matrix_result(2, 0));
+        EXPECT_EQ(5 * 3 + 6 * 4, matrix_result(2, 1));
+        EXPECT_EQ(5 * 5 + 6 * 6, matrix_result(2, 2));
+    }
+
+    TEST(DataStructureDynamicMatrix, MultiplyMatrixSameAsStatic)
+    {
+        ml::data_structure::matrix::Matrix<int, 4, 3> matrix_1({1, -2, 3, 4, 5, -6, 7, 8, 9, -1, 0, 2});
+        ml::data_structure::matrix::Matrix<int, 3, 5> matrix_2({3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8, 9, 7, 9});
+
+        const auto& expected = ml::data_structure::matrix::multiplies_matrix(matrix_1, matrix_2);
+        const auto& matrix_result = ml::data_structure::matrix::multiplies_matrix(
+            ml::data_structure::matrix::DynamicMatrix<int>(matrix_1),
+            ml::data_structure::matrix::DynamicMatrix<int>(matrix_2));
+
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(expected), matrix_result);
+    }
+
+    TEST(DataStructureDynamicMatrix, MultiplyMatrixBlocked)
+    {
+        const size_t m = 100;
+        const size_t n = 270;
+        const size_t p = 150;
+
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_1(m, n);
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_2(n, p);
+        for (size_t i = 0; i < m * n; i++)
+            matrix_1.data()[i] = static_cast<int>(i % 17) - 8;
+        for (size_t i = 0; i < n * p; i++)
+            matrix_2.data()[i] = static_cast<int>(i % 13) - 6;
+
+        const auto& matrix_result = ml::data_structure::matrix::multiplies_matrix(matrix_1, matrix_2);
+
+        for (size_t i = 0; i < m; i++)
+        {
+            for (size_t j = 0; j < p; j++)
+            {
+                int expected = 0;
+                for (size_t k = 0; k < n; k++)
+                    expected += matrix_1(i, k) * matrix_2(k, j);
+
+                EXPECT_EQ(expected, matrix_result(i, j));
+            }
+        }
+    }
+
+    TEST(DataStructureDynamicMatrix, MultiplyMatrixWrongShape)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_1(3, 2, {1, 2, 3, 4, 5, 6});
+
+        EXPECT_THROW(ml::data_structure::matrix::multiplies_matrix(matrix_1, matrix_1), std::invalid_argument);
+    }
+} // namespace tests::unit_tests
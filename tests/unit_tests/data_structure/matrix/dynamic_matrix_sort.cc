@@ -0,0 +1,123 @@
+/**
+ ** @file tests/unit_tests/data_structure/matrix/dynamic_matrix_sort.cc
+ ** @brief Tests for Sort functions of ml::data_structure::matrix::DynamicMatrix
+ */
+
+#include "data_structure/matrix/dynamic_matrix.hh"
+#include "gtest/gtest.h"
+
+namespace tests::unit_tests
+{
+    TEST(DataStructureDynamicMatrix, SortInPlace)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(3, 2, {1, 6, 4, 5, 3, 2});
+        matrix.sort();
+
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(3, 2, {1, 2, 3, 4, 5, 6}), matrix);
+    }
+
+    TEST(DataStructureDynamicMatrix, Sort)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(3, 2, {1, 6, 4, 5, 3, 2});
+        const auto& matrix_result = ml::data_structure::matrix::sort(matrix, std::greater<>{});
+
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(3, 2, {6, 5, 4, 3, 2, 1}), matrix_result);
+        EXPECT_EQ(1, matrix(0, 0));
+    }
+
+    TEST(DataStructureDynamicMatrix, SortRowsInPlace)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(3, 2, {1, 6, 5, 4, 3, 2});
+        matrix.sort_rows();
+
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(3, 2, {1, 6, 4, 5, 2, 3}), matrix);
+    }
+
+    TEST(DataStructureDynamicMatrix, SortRows)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(3, 2, {1, 6, 5, 4, 3, 2});
+        const auto& matrix_result = ml::data_structure::matrix::sort_rows(matrix, std::greater<>{});
+
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(3, 2, {6, 1, 5, 4, 3, 2}), matrix_result);
+    }
+
+    TEST(DataStructureDynamicMatrix, SortColumnsInPlace)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(3, 2, {1, 6, 4, 5, 3, 2});
+        matrix.sort_columns();
+
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(3, 2, {1, 2, 3, 5, 4, 6}), matrix);
+    }
+
+    TEST(DataStructureDynamicMatrix, SortColumns)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(3, 2, {1, 6, 4, 5, 3, 2});
+        const auto& matrix_result = ml::data_structure::matrix::sort_columns(matrix, std::greater<>{});
+
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(3, 2, {4, 6, 3, 5, 1, 2}), matrix_result);
+    }
+
+    TEST(DataStructureDynamicMatrix, SortRowsByColumnInPlace)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(4, 3, {3, 0, 1, 1, 1, 2, 2, 2, 3, 1, 3, 4});
+        matrix.sort_rows_by_column(0);
+
+        // The rows with the same key keep their order
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(4, 3, {1, 1, 2, 1, 3, 4, 2, 2, 3, 3, 0, 1}), matrix);
+        EXPECT_THROW(matrix.sort_rows_by_column(3), std::out_of_range);
+    }
+
+    TEST(DataStructureDynamicMatrix, SortRowsByColumn)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(3, 2, {1, 6, 4, 5, 3, 2});
+        const auto& matrix_result = ml::data_structure::matrix::sort_rows_by_column(matrix, 1, std::greater<>{});
+
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(3, 2, {1, 6, 4, 5, 3, 2}), matrix_result);
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(3, 2, {3, 2, 4, 5, 1, 6}),
+                  matrix.sort_rows_by_column(1));
+    }
+
+    TEST(DataStructureDynamicMatrix, Argsort)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(3, 2, {4, 6, 1, 5, 4, 2});
+
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<size_t>(3, 2, {2, 5, 0, 4, 3, 1}), matrix.argsort());
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<size_t>(3, 2, {1, 3, 0, 4, 5, 2}),
+                  ml::data_structure::matrix::argsort(matrix, std::greater<>{}));
+    }
+
+    TEST(DataStructureDynamicMatrix, ArgsortRows)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(2, 3, {3, 1, 2, 5, 5, 4});
+
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<size_t>(2, 3, {1, 2, 0, 2, 0, 1}), matrix.argsort_rows());
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<size_t>(2, 3, {0, 2, 1, 0, 1, 2}),
+                  ml::data_structure::matrix::argsort_rows(matrix, std::greater<>{}));
+    }
+
+    TEST(DataStructureDynamicMatrix, ArgsortColumns)
+    {
+        // Tall enough for the radix backend, which must stay stable as std::stable_sort
+        const size_t height = ml::computation::sort::RADIX_SORT_SIZE + 5;
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(height, 2);
+        for (size_t i = 0; i < height; i++)
+        {
+            matrix(i, 0) = static_cast<float>((i * 37) % 11);
+            matrix(i, 1) = -static_cast<float>(i);
+        }
+
+        const auto indexes = matrix.argsort_columns();
+        for (size_t i = 1; i < height; i++)
+        {
+            const size_t previous = indexes(i - 1, 0);
+            const size_t current = indexes(i, 0);
+            EXPECT_TRUE(matrix(previous, 0) < matrix(current, 0)
+                        || (matrix(previous, 0) == matrix(current, 0) && previous < current));
+            EXPECT_EQ(height - i - 1, indexes(i, 1));
+        }
+
+        const auto sorted = ml::data_structure::matrix::sort_rows_by_column(matrix, 0);
+        for (size_t i = 0; i < height; i++)
+            EXPECT_EQ(-static_cast<float>(indexes(i, 0)), sorted(i, 1));
+    }
+} // namespace tests::unit_tests
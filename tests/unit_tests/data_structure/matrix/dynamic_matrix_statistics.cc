@@ -0,0 +1,182 @@
+/**
+ ** @file tests/unit_tests/data_structure/matrix/dynamic_matrix_statistics.cc
+ ** @brief Tests for statistic operation functions of ml::data_structure::matrix::DynamicMatrix
+ */
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "data_structure/matrix/dynamic_matrix.hh"
+#include "gtest/gtest.h"
+#include "parallel/thread_pool.hh"
+#include "unit_tests/data_structure/matrix/matrix_statistics.hh"
+
+namespace tests::unit_tests
+{
+    TYPED_TEST_SUITE(DataStructureDynamicMatrixStatistic, MatrixStatisticTypes, );
+
+    TYPED_TEST(DataStructureDynamicMatrixStatistic, SimpleEven)
+    {
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(3, 2, {1.0f, 6.0f, 4.0f, 5.0f, 3.0f, 2.0f});
+        auto result = TypeParam::function(matrix);
+
+        EXPECT_FLOAT_EQ(TypeParam::test_function({1.0f, 6.0f, 4.0f, 5.0f, 3.0f, 2.0f}), result);
+    }
+
+    TYPED_TEST(DataStructureDynamicMatrixStatistic, ColumnsEven)
+    {
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(3, 2, {1.0f, 6.0f, 4.0f, 5.0f, 3.0f, 2.0f});
+        const auto& matrix_result = TypeParam::function_columns(matrix);
+
+        EXPECT_EQ(1, matrix_result.get_height());
+        EXPECT_EQ(2, matrix_result.get_width());
+        EXPECT_FLOAT_EQ(TypeParam::test_function({1.0f, 4.0f, 3.0f}), matrix_result(0, 0));
+        EXPECT_FLOAT_EQ(TypeParam::test_function({6.0f, 5.0f, 2.0f}), matrix_result(0, 1));
+    }
+
+    TYPED_TEST(DataStructureDynamicMatrixStatistic, RowsEven)
+    {
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(3, 2, {1.0f, 6.0f, 4.0f, 5.0f, 3.0f, 2.0f});
+        const auto& matrix_result = TypeParam::function_rows(matrix);
+
+        EXPECT_EQ(3, matrix_result.get_height());
+        EXPECT_EQ(1, matrix_result.get_width());
+        EXPECT_FLOAT_EQ(TypeParam::test_function({1.0f, 6.0f}), matrix_result(0, 0));
+        EXPECT_FLOAT_EQ(TypeParam::test_function({4.0f, 5.0f}), matrix_result(1, 0));
+        EXPECT_FLOAT_EQ(TypeParam::test_function({3.0f, 2.0f}), matrix_result(2, 0));
+    }
+
+    TYPED_TEST(DataStructureDynamicMatrixStatistic, SimpleOdd)
+    {
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(
+            3, 3, {1.0f, 9.0f, 6.0f, 4.0f, 8.0f, 5.0f, 3.0f, 2.0f, 7.0f});
+        auto result = TypeParam::function(matrix);
+
+        EXPECT_FLOAT_EQ(TypeParam::test_function({1.0f, 9.0f, 6.0f, 4.0f, 8.0f, 5.0f, 3.0f, 2.0f, 7.0f}), result);
+    }
+
+    TYPED_TEST(DataStructureDynamicMatrixStatistic, ColumnsOdd)
+    {
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(
+            3, 3, {1.0f, 9.0f, 6.0f, 4.0f, 8.0f, 5.0f, 3.0f, 2.0f, 7.0f});
+        const auto& matrix_result = TypeParam::function_columns(matrix);
+
+        EXPECT_FLOAT_EQ(TypeParam::test_function({1.0f, 4.0f, 3.0f}), matrix_result(0, 0));
+        EXPECT_FLOAT_EQ(TypeParam::test_function({9.0f, 8.0f, 2.0f}), matrix_result(0, 1));
+        EXPECT_FLOAT_EQ(TypeParam::test_function({6.0f, 5.0f, 7.0f}), matrix_result(0, 2));
+    }
+
+    TYPED_TEST(DataStructureDynamicMatrixStatistic, RowsOdd)
+    {
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(
+            3, 3, {1.0f, 9.0f, 6.0f, 4.0f, 8.0f, 5.0f, 3.0f, 2.0f, 7.0f});
+        const auto& matrix_result = TypeParam::function_rows(matrix);
+
+        EXPECT_FLOAT_EQ(TypeParam::test_function({1.0f, 9.0f, 6.0f}), matrix_result(0, 0));
+        EXPECT_FLOAT_EQ(TypeParam::test_function({4.0f, 8.0f, 5.0f}), matrix_result(1, 0));
+        EXPECT_FLOAT_EQ(TypeParam::test_function({3.0f, 2.0f, 7.0f}), matrix_result(2, 0));
+    }
+
+    TEST(DataStructureDynamicMatrixDescribe, DescribeColumnsRows)
+    {
+        ml::data_structure::matrix::DynamicMatrix<double> matrix(37, 21);
+        for (size_t i = 0; i < matrix.get_height() * matrix.get_width(); i++)
+            matrix.data()[i] = static_cast<double>((i * 131) % 97) - 40.0;
+
+        const auto description = matrix.describe();
+        const auto columns = matrix.describe_columns(1);
+        const auto rows = ml::data_structure::matrix::describe_rows(matrix);
+
+        EXPECT_DOUBLE_EQ(matrix.sum(), description.sum);
+        EXPECT_DOUBLE_EQ(matrix.variance(), description.variance);
+        EXPECT_EQ(matrix.sum_columns(), columns.sum);
+        EXPECT_EQ(matrix.min_columns(), columns.min);
+        EXPECT_EQ(matrix.max_columns(), columns.max);
+        EXPECT_EQ(matrix.peak_to_peak_columns(), columns.peak_to_peak);
+        for (size_t j = 0; j < matrix.get_width(); j++)
+        {
+            EXPECT_DOUBLE_EQ(matrix.mean_columns()(0, j), columns.mean(0, j));
+            EXPECT_NEAR(matrix.variance_columns(1)(0, j), columns.variance(0, j), 1e-9);
+        }
+
+        EXPECT_EQ(matrix.min_rows(), rows.min);
+        EXPECT_EQ(matrix.max_rows(), rows.max);
+        for (size_t i = 0; i < matrix.get_height(); i++)
+        {
+            EXPECT_DOUBLE_EQ(matrix.mean_rows()(i, 0), rows.mean(i, 0));
+            EXPECT_NEAR(matrix.standard_deviation_rows()(i, 0), rows.standard_deviation(i, 0), 1e-9);
+        }
+    }
+
+    TEST(DataStructureDynamicMatrixDescribe, TooFewRows)
+    {
+        const ml::data_structure::matrix::DynamicMatrix<double> matrix(1, 3);
+        EXPECT_THROW(matrix.variance_columns(1), std::invalid_argument);
+        EXPECT_THROW(matrix.standard_deviation_columns(1), std::invalid_argument);
+        EXPECT_THROW(matrix.describe_columns(1), std::invalid_argument);
+
+        const ml::data_structure::matrix::DynamicMatrix<int> integers(2, 3, {1, 2, 3, 4, 5, 6});
+        EXPECT_THROW(integers.variance_columns(2), std::invalid_argument);
+        EXPECT_THROW(integers.describe_columns(3), std::invalid_argument);
+    }
+
+    TEST(DataStructureDynamicMatrixReduceColumns, SameAsColumns)
+    {
+        ml::data_structure::matrix::DynamicMatrix<double> matrix(53, 37);
+        for (size_t i = 0; i < matrix.get_height() * matrix.get_width(); i++)
+            matrix.data()[i] = static_cast<double>((i * 131) % 97) / 8.0 - 6.0;
+
+        const auto& sum_columns = matrix.sum_columns();
+        const auto& min_columns = matrix.min_columns();
+        const auto& max_columns = matrix.max_columns();
+        const auto& mean_columns = matrix.mean_columns();
+        const auto& sum_product_columns = ml::data_structure::matrix::sum_product_columns(matrix);
+        const auto& view_sum_columns = ml::data_structure::matrix::sum_columns(matrix.view().block(3, 2, 40, 30));
+
+        for (size_t j = 0; j < matrix.get_width(); j++)
+        {
+            std::vector<double> column(matrix.get_height());
+            for (size_t i = 0; i < matrix.get_height(); i++)
+                column[i] = matrix(i, j);
+
+            EXPECT_NEAR(std::accumulate(column.cbegin(), column.cend(), 0.0), sum_columns(0, j), 1e-9);
+            EXPECT_DOUBLE_EQ(*std::min_element(column.cbegin(), column.cend()), min_columns(0, j));
+            EXPECT_DOUBLE_EQ(*std::max_element(column.cbegin(), column.cend()), max_columns(0, j));
+            EXPECT_NEAR(std::accumulate(column.cbegin(), column.cend(), 0.0) / 53, mean_columns(0, j), 1e-9);
+            EXPECT_DOUBLE_EQ(std::accumulate(column.cbegin(), column.cend(), 1.0, std::multiplies<double>()),
+                             sum_product_columns(0, j));
+            if (j >= 2 && j < 32)
+            {
+                EXPECT_NEAR(std::accumulate(column.cbegin() + 3, column.cbegin() + 43, 0.0),
+                            view_sum_columns(0, j - 2),
+                            1e-9);
+            }
+        }
+    }
+
+    TEST(DataStructureDynamicMatrixParallel, Statistics)
+    {
+        const size_t thread_count = ml::parallel::get_thread_count();
+        ml::parallel::set_thread_count(3);
+
+        ml::data_structure::matrix::DynamicMatrix<double> matrix(1031, 517);
+        for (size_t i = 0; i < matrix.get_height() * matrix.get_width(); i++)
+            matrix.data()[i] = static_cast<double>((i * 131) % 97) / 8.0 - 6.0;
+
+        for (const auto execution :
+             {ml::computation::statistic::Execution::PARALLEL, ml::computation::statistic::Execution::DETERMINISTIC})
+        {
+            EXPECT_NEAR(matrix.sum(), ml::data_structure::matrix::sum(matrix, execution), 1e-6);
+            EXPECT_NEAR(matrix.mean(), ml::data_structure::matrix::mean(matrix, execution), 1e-12);
+            EXPECT_NEAR(matrix.variance(1), ml::data_structure::matrix::variance(matrix, 1, execution), 1e-9);
+            EXPECT_NEAR(matrix.standard_deviation(),
+                        ml::data_structure::matrix::standard_deviation(matrix, 0, execution),
+                        1e-9);
+        }
+
+        ml::parallel::set_thread_count(thread_count);
+    }
+} // namespace tests::unit_tests
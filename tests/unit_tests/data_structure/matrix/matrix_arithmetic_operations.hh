@@ -600,6 +600,16 @@ namespace tests::unit_tests
     class DataStructureMatrixArithmeticScalarOperation : public testing::Test
     {};
 
+    /// Dynamic Matrix Arithmetic Operation fixture class
+    template <class ArithmeticOperation>
+    class DataStructureDynamicMatrixArithmeticOperation : public testing::Test
+    {};
+
+    /// Dynamic Matrix Arithmetic Scalar Operation fixture class
+    template <class ArithmeticScalarOperation>
+    class DataStructureDynamicMatrixArithmeticScalarOperation : public testing::Test
+    {};
+
     /// Functor-class list to use for the arithmetic operation tests
     using ArithmeticOperations = ::testing::Types<PlusArithmeticOperation,
                                                   PlusArithmeticOperationShortcut,
@@ -0,0 +1,166 @@
+/**
+ ** @file tests/unit_tests/data_structure/matrix/matrix_expression.cc
+ ** @brief Tests for the lazy element-wise expressions of ml::data_structure::matrix
+ */
+
+#include "data_structure/matrix/dynamic_matrix.hh"
+
+#include <utility>
+
+#include "gtest/gtest.h"
+
+namespace tests::unit_tests
+{
+    TEST(DataStructureMatrixExpression, Chain)
+    {
+        ml::data_structure::matrix::Matrix<int, 2, 3> matrix_1({1, 2, 3, 4, 5, 6});
+        ml::data_structure::matrix::Matrix<int, 2, 3> matrix_2({6, 5, 4, 3, 2, 1});
+        ml::data_structure::matrix::Matrix<int, 2, 3> matrix_3({1, 1, 2, 2, 3, 3});
+        ml::data_structure::matrix::Matrix<int, 2, 3> matrix_4({7, 8, 9, 10, 11, 12});
+
+        const ml::data_structure::matrix::Matrix<int, 2, 3> matrix_result =
+            -(matrix_1 * matrix_2 + matrix_3 - matrix_4) * 2 % 5;
+
+        ml::data_structure::matrix::Matrix<int, 2, 3> expected = matrix_1;
+        expected.multiplies(matrix_2).plus(matrix_3).minus(matrix_4).negate().multiplies_scalar(2).modulus_scalar(5);
+        EXPECT_EQ(expected, matrix_result);
+    }
+
+    TEST(DataStructureMatrixExpression, ChainBroadcast)
+    {
+        ml::data_structure::matrix::Matrix<int, 3, 2> matrix({1, 2, 3, 4, 5, 6});
+        ml::data_structure::matrix::Matrix<int, 1, 2> row({10, 20});
+        ml::data_structure::matrix::Matrix<int, 3, 1> column({1, 2, 3});
+
+        const auto& expression = (row + column) * matrix - row;
+
+        EXPECT_EQ(3, expression.get_height());
+        EXPECT_EQ(2, expression.get_width());
+        EXPECT_EQ((ml::data_structure::matrix::Matrix<int, 3, 2>({1, 22, 26, 68, 55, 118})),
+                  (ml::data_structure::matrix::Matrix<int, 3, 2>(expression)));
+    }
+
+    TEST(DataStructureMatrixExpression, BroadcastNestedOperand)
+    {
+        ml::data_structure::matrix::Matrix<int, 1, 2> row_1({1, 2});
+        ml::data_structure::matrix::Matrix<int, 1, 2> row_2({3, 4});
+        ml::data_structure::matrix::Matrix<int, 2, 2> matrix({1, 1, 2, 2});
+
+        const ml::data_structure::matrix::Matrix<int, 2, 2> matrix_result = (row_1 + row_2) * matrix;
+
+        EXPECT_EQ((ml::data_structure::matrix::Matrix<int, 2, 2>({4, 6, 8, 12})), matrix_result);
+    }
+
+    TEST(DataStructureMatrixExpression, DeepBroadcast)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(2, 2, {1, 2, 3, 4});
+        ml::data_structure::matrix::DynamicMatrix<int> row(1, 2, {10, 20});
+
+        // Both operands of the root have its shape, the broadcast row is one level below
+        const auto& expression = (matrix + row) * matrix;
+
+        EXPECT_TRUE(expression.is_broadcasting());
+        EXPECT_FALSE((matrix * matrix + matrix).is_broadcasting());
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(2, 2, {11, 44, 39, 96}), expression.evaluate());
+    }
+
+    TEST(DataStructureMatrixExpression, OutliveTemporaryNodes)
+    {
+        ml::data_structure::matrix::Matrix<int, 2, 2> matrix_1({1, 2, 3, 4});
+        ml::data_structure::matrix::Matrix<int, 2, 2> matrix_2({4, 3, 2, 1});
+
+        // The intermediate nodes are copied into the expression, only the matrices are referenced
+        const auto expression = [&matrix_1, &matrix_2]() {
+            const int scalar = 3;
+            return (matrix_1 + matrix_2) * scalar - matrix_1;
+        }();
+
+        EXPECT_EQ((ml::data_structure::matrix::Matrix<int, 2, 2>({14, 13, 12, 11})), expression.evaluate());
+    }
+
+    TEST(DataStructureMatrixExpression, OwnTemporaryMatrices)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(2, 2, {1, 2, 3, 4});
+
+        // The temporary matrices are moved into the nodes, the expressions outlive their full-expressions
+        const auto expression = ml::data_structure::matrix::DynamicMatrix<int>(2, 2, {4, 3, 2, 1}) + matrix;
+        const auto negated = -ml::data_structure::matrix::DynamicMatrix<int>(1, 2, {1, 2});
+        const auto scaled = []() {
+            ml::data_structure::matrix::Matrix<int, 2, 2> local({1, 2, 3, 4});
+            return std::move(local) * 2 - ml::data_structure::matrix::Matrix<int, 1, 2>({1, 1});
+        }();
+
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(2, 2, {5, 5, 5, 5}), expression.evaluate());
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(1, 2, {-1, -2}), negated.evaluate());
+        EXPECT_EQ((ml::data_structure::matrix::Matrix<int, 2, 2>({1, 3, 5, 7})), scaled.evaluate());
+
+        // The lvalue matrices are still referenced, not copied
+        matrix(0, 0) = 10;
+        EXPECT_EQ(14, expression.evaluate()(0, 0));
+    }
+
+    TEST(DataStructureMatrixExpression, WrongShapeInChain)
+    {
+        ml::data_structure::matrix::Matrix<int, 3, 2> matrix_1({1, 2, 3, 4, 5, 6});
+        ml::data_structure::matrix::Matrix<int, 2, 2> matrix_2({1, 2, 3, 4});
+
+        EXPECT_THROW((matrix_1 * 2) + matrix_2, std::invalid_argument);
+    }
+
+    TEST(DataStructureMatrixExpression, AssignAliasing)
+    {
+        ml::data_structure::matrix::Matrix<int, 2, 2> matrix_1({1, 2, 3, 4});
+        ml::data_structure::matrix::Matrix<int, 2, 2> matrix_2({4, 3, 2, 1});
+
+        matrix_1 = matrix_1 * matrix_2 + matrix_1;
+
+        EXPECT_EQ((ml::data_structure::matrix::Matrix<int, 2, 2>({5, 8, 9, 8})), matrix_1);
+    }
+
+    TEST(DataStructureMatrixExpression, SameAsNamedFunctions)
+    {
+        ml::data_structure::matrix::Matrix<float, 2, 3> matrix_1({1.5f, 2.0f, -3.0f, 4.0f, 5.5f, 6.0f});
+        ml::data_structure::matrix::Matrix<float, 1, 3> matrix_2({2.0f, 4.0f, 8.0f});
+
+        const ml::data_structure::matrix::Matrix<float, 2, 3> matrix_result = matrix_1 / matrix_2 - 1.0f;
+
+        // -Ofast lets the vectorised fused division round differently from the hand-vectorised one
+        const auto& expected =
+            ml::data_structure::matrix::minus_scalar(ml::data_structure::matrix::divides(matrix_1, matrix_2), 1.0f);
+        for (size_t i = 0; i < expected.data().size(); i++)
+            EXPECT_FLOAT_EQ(expected.data()[i], matrix_result.data()[i]);
+    }
+
+    TEST(DataStructureMatrixExpression, DynamicChain)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_1(2, 3, {1, 2, 3, 4, 5, 6});
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_2(2, 3, {6, 5, 4, 3, 2, 1});
+        ml::data_structure::matrix::DynamicMatrix<int> column(2, 1, {10, 20});
+
+        const ml::data_structure::matrix::DynamicMatrix<int> matrix_result = matrix_1 * matrix_2 + column - 1;
+
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(2, 3, {15, 19, 21, 31, 29, 25}), matrix_result);
+    }
+
+    TEST(DataStructureMatrixExpression, DynamicAssignReshape)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> row(1, 2, {1, 2});
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(3, 2, {1, 2, 3, 4, 5, 6});
+
+        // row is a broadcast operand of the expression it receives
+        row = row + matrix;
+
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(3, 2, {2, 4, 4, 6, 6, 8}), row);
+
+        matrix = -matrix;
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(3, 2, {-1, -2, -3, -4, -5, -6}), matrix);
+    }
+
+    TEST(DataStructureMatrixExpression, DynamicWrongShape)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_1(3, 2, {1, 2, 3, 4, 5, 6});
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_2(2, 3, {1, 2, 3, 4, 5, 6});
+
+        EXPECT_THROW(-matrix_1 + matrix_2, std::invalid_argument);
+    }
+} // namespace tests::unit_tests
@@ -319,4 +319,50 @@ namespace tests::unit_tests
         EXPECT_EQ(1, matrix_result(2, 0));
         EXPECT_EQ(2, matrix_result(2, 1));
     }
+
+    TEST(DataStructureMatrix, SortRowsByColumnInPlace)
+    {
+        ml::data_structure::matrix::Matrix<int, 4, 3> matrix({3, 0, 1, 1, 1, 2, 2, 2, 3, 1, 3, 4});
+        matrix.sort_rows_by_column(0);
+
+        // The rows with the same key keep their order
+        EXPECT_EQ((ml::data_structure::matrix::Matrix<int, 4, 3>({1, 1, 2, 1, 3, 4, 2, 2, 3, 3, 0, 1})), matrix);
+        EXPECT_THROW(matrix.sort_rows_by_column(3), std::out_of_range);
+    }
+
+    TEST(DataStructureMatrix, SortRowsByColumn)
+    {
+        ml::data_structure::matrix::Matrix<int, 3, 2> matrix({1, 6, 4, 5, 3, 2});
+        const auto& matrix_result = ml::data_structure::matrix::sort_rows_by_column(matrix, 1, std::greater());
+
+        EXPECT_EQ((ml::data_structure::matrix::Matrix<int, 3, 2>({1, 6, 4, 5, 3, 2})), matrix_result);
+        EXPECT_EQ((ml::data_structure::matrix::Matrix<int, 3, 2>({3, 2, 4, 5, 1, 6})), matrix.sort_rows_by_column(1));
+    }
+
+    TEST(DataStructureMatrix, Argsort)
+    {
+        ml::data_structure::matrix::Matrix<int, 3, 2> matrix({4, 6, 1, 5, 4, 2});
+
+        EXPECT_EQ((ml::data_structure::matrix::Matrix<size_t, 3, 2>({2, 5, 0, 4, 3, 1})), matrix.argsort());
+        EXPECT_EQ((ml::data_structure::matrix::Matrix<size_t, 3, 2>({1, 3, 0, 4, 5, 2})),
+                  ml::data_structure::matrix::argsort(matrix, std::greater()));
+    }
+
+    TEST(DataStructureMatrix, ArgsortRows)
+    {
+        ml::data_structure::matrix::Matrix<int, 2, 3> matrix({3, 1, 2, 5, 5, 4});
+
+        EXPECT_EQ((ml::data_structure::matrix::Matrix<size_t, 2, 3>({1, 2, 0, 2, 0, 1})), matrix.argsort_rows());
+        EXPECT_EQ((ml::data_structure::matrix::Matrix<size_t, 2, 3>({0, 2, 1, 0, 1, 2})),
+                  ml::data_structure::matrix::argsort_rows(matrix, std::greater()));
+    }
+
+    TEST(DataStructureMatrix, ArgsortColumns)
+    {
+        ml::data_structure::matrix::Matrix<float, 3, 2> matrix({1.5f, 6.0f, -4.0f, 5.0f, 3.0f, 6.0f});
+
+        EXPECT_EQ((ml::data_structure::matrix::Matrix<size_t, 3, 2>({1, 1, 0, 0, 2, 2})), matrix.argsort_columns());
+        EXPECT_EQ((ml::data_structure::matrix::Matrix<size_t, 3, 2>({2, 0, 0, 2, 1, 1})),
+                  ml::data_structure::matrix::argsort_columns(matrix, std::greater()));
+    }
 } // namespace tests::unit_tests
@@ -120,4 +120,54 @@ namespace tests::unit_tests
         EXPECT_FLOAT_EQ(TypeParam::test_function({4.0f, 5.0f, 6.0f}), matrix_result(1, 0));
         EXPECT_FLOAT_EQ(TypeParam::test_function({7.0f, 8.0f, 9.0f}), matrix_result(2, 0));
     }
+
+    TEST(DataStructureMatrixDescribe, Describe)
+    {
+        ml::data_structure::matrix::Matrix<float, 3, 3> matrix({1.0f, 9.0f, 6.0f, 4.0f, 8.0f, 5.0f, 3.0f, 2.0f, 7.0f});
+        const auto description = matrix.describe(1);
+
+        EXPECT_FLOAT_EQ(matrix.sum(), description.sum);
+        EXPECT_FLOAT_EQ(matrix.min(), description.min);
+        EXPECT_FLOAT_EQ(matrix.max(), description.max);
+        EXPECT_FLOAT_EQ(matrix.mean(), description.mean);
+        EXPECT_FLOAT_EQ(matrix.variance(1), description.variance);
+        EXPECT_FLOAT_EQ(matrix.standard_deviation(1), description.standard_deviation);
+        EXPECT_FLOAT_EQ(matrix.peak_to_peak(), description.peak_to_peak);
+    }
+
+    TEST(DataStructureMatrixDescribe, DescribeColumnsRows)
+    {
+        ml::data_structure::matrix::Matrix<float, 4, 3> matrix(
+            {1.0f, 9.0f, 6.0f, 4.0f, 8.0f, 5.0f, 3.0f, 2.0f, 7.0f, 0.0f, 1.0f, 9.0f});
+        const auto columns = matrix.describe_columns();
+        const auto rows = ml::data_structure::matrix::describe_rows(matrix, 1);
+
+        EXPECT_EQ(matrix.sum_columns(), columns.sum);
+        EXPECT_EQ(matrix.min_columns(), columns.min);
+        EXPECT_EQ(matrix.max_columns(), columns.max);
+        EXPECT_EQ(matrix.peak_to_peak_columns(), columns.peak_to_peak);
+        for (size_t j = 0; j < 3; j++)
+        {
+            EXPECT_FLOAT_EQ(matrix.mean_columns()(0, j), columns.mean(0, j));
+            EXPECT_FLOAT_EQ(matrix.variance_columns()(0, j), columns.variance(0, j));
+            EXPECT_FLOAT_EQ(matrix.standard_deviation_columns()(0, j), columns.standard_deviation(0, j));
+        }
+
+        EXPECT_EQ(matrix.sum_rows(), rows.sum);
+        EXPECT_EQ(matrix.peak_to_peak_rows(), rows.peak_to_peak);
+        for (size_t i = 0; i < 4; i++)
+            EXPECT_FLOAT_EQ(matrix.variance_rows(1)(i, 0), rows.variance(i, 0));
+    }
+
+    TEST(DataStructureMatrixParallel, Statistics)
+    {
+        ml::data_structure::matrix::Matrix<float, 3, 3> matrix({1.0f, 9.0f, 6.0f, 4.0f, 8.0f, 5.0f, 3.0f, 2.0f, 7.0f});
+        const auto execution = ml::computation::statistic::Execution::DETERMINISTIC;
+
+        EXPECT_FLOAT_EQ(matrix.sum(), ml::data_structure::matrix::sum(matrix, execution));
+        EXPECT_FLOAT_EQ(matrix.mean(), ml::data_structure::matrix::mean(matrix, execution));
+        EXPECT_FLOAT_EQ(matrix.variance(1), ml::data_structure::matrix::variance(matrix, 1, execution));
+        EXPECT_FLOAT_EQ(matrix.standard_deviation(1),
+                        ml::data_structure::matrix::standard_deviation(matrix, 1, execution));
+    }
 } // namespace tests::unit_tests
@@ -595,6 +595,11 @@ namespace tests::unit_tests
     class DataStructureMatrixStatistic : public testing::Test
     {};
 
+    /// Dynamic Matrix Statistic fixture class
+    template <class Statistic>
+    class DataStructureDynamicMatrixStatistic : public testing::Test
+    {};
+
     /// Functor-class list to use for matrix statistics tests
     using MatrixStatisticTypes = ::testing::Types<MatrixSumStatistic,
                                                   MatrixSumStatisticShortcut,
@@ -33,4 +33,27 @@ namespace tests::unit_tests
         EXPECT_EQ(5, matrix_result(0, 2));
         EXPECT_EQ(6, matrix_result(1, 2));
     }
+
+    TEST(DataStructureMatrix, TransposeInPlace)
+    {
+        ml::data_structure::matrix::Matrix<int, 3, 3> matrix({1, 2, 3, 4, 5, 6, 7, 8, 9});
+        matrix.transpose_in_place();
+
+        EXPECT_EQ((ml::data_structure::matrix::Matrix<int, 3, 3>({1, 4, 7, 2, 5, 8, 3, 6, 9})), matrix);
+    }
+
+    TEST(DataStructureMatrix, TransposeBlocked)
+    {
+        ml::data_structure::matrix::Matrix<float, 45, 70> matrix;
+        for (size_t i = 0; i < matrix.data().size(); i++)
+            matrix.data()[i] = static_cast<float>(i);
+
+        const auto& matrix_result = matrix.transpose();
+
+        for (size_t i = 0; i < 45; i++)
+        {
+            for (size_t j = 0; j < 70; j++)
+                EXPECT_EQ(matrix(i, j), matrix_result(j, i));
+        }
+    }
 } // namespace tests::unit_tests
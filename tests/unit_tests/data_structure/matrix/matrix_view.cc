@@ -0,0 +1,156 @@
+/**
+ ** @file tests/unit_tests/data_structure/matrix/matrix_view.cc
+ ** @brief Tests for ml::data_structure::matrix::MatrixView
+ */
+
+#include "data_structure/matrix/dynamic_matrix.hh"
+#include "gtest/gtest.h"
+
+namespace tests::unit_tests
+{
+    TEST(DataStructureMatrixView, View)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(2, 3, {1, 2, 3, 4, 5, 6});
+        const auto view = matrix.view();
+
+        EXPECT_EQ(2, view.get_height());
+        EXPECT_EQ(3, view.get_width());
+        EXPECT_TRUE(view.is_contiguous());
+        EXPECT_EQ(6, view(1, 2));
+
+        view(1, 2) = 7;
+        EXPECT_EQ(7, matrix(1, 2));
+    }
+
+    TEST(DataStructureMatrixView, Transpose)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(3, 2, {1, 2, 3, 4, 5, 6});
+        const auto view = matrix.view().transpose();
+
+        EXPECT_EQ(2, view.get_height());
+        EXPECT_EQ(3, view.get_width());
+        EXPECT_FALSE(view.is_contiguous());
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(2, 3, {1, 3, 5, 2, 4, 6}),
+                  ml::data_structure::matrix::DynamicMatrix<int>(view));
+    }
+
+    TEST(DataStructureMatrixView, Block)
+    {
+        ml::data_structure::matrix::Matrix<int, 3, 4> matrix({1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+        const auto view = matrix.view().block(1, 1, 2, 2);
+
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(2, 2, {6, 7, 10, 11}), view.evaluate());
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(2, 2, {6, 10, 7, 11}), view.transpose().evaluate());
+        EXPECT_THROW(matrix.view().block(2, 0, 2, 1), std::out_of_range);
+        EXPECT_THROW(matrix.view().block(0, 3, 1, 2), std::out_of_range);
+    }
+
+    TEST(DataStructureMatrixView, RowColumn)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(3, 2, {1, 2, 3, 4, 5, 6});
+
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(1, 2, {3, 4}), matrix.view().row(1).evaluate());
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(3, 1, {2, 4, 6}), matrix.view().column(1).evaluate());
+        EXPECT_TRUE(matrix.view().row(1).is_contiguous());
+        EXPECT_FALSE(matrix.view().column(1).is_contiguous());
+        EXPECT_FALSE(matrix.view().transpose().row(1).is_contiguous());
+    }
+
+    TEST(DataStructureMatrixView, At)
+    {
+        const ml::data_structure::matrix::DynamicMatrix<int> matrix(3, 2, {1, 2, 3, 4, 5, 6});
+        const auto view = matrix.view().transpose();
+
+        EXPECT_EQ(5, view.at(0, 2));
+        EXPECT_THROW(view.at(2, 0), std::out_of_range);
+        EXPECT_THROW(view.at(0, 3), std::out_of_range);
+    }
+
+    TEST(DataStructureMatrixView, MultiplyTransposed)
+    {
+        const size_t m = 100;
+        const size_t n = 70;
+        const size_t p = 90;
+
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_1(n, m);
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_2(n, p);
+        for (size_t i = 0; i < n * m; i++)
+            matrix_1.data()[i] = static_cast<int>(i % 17) - 8;
+        for (size_t i = 0; i < n * p; i++)
+            matrix_2.data()[i] = static_cast<int>(i % 13) - 6;
+
+        const auto& expected = ml::data_structure::matrix::multiplies_matrix(matrix_1.transpose(), matrix_2);
+        const auto& matrix_result =
+            ml::data_structure::matrix::multiplies_matrix(matrix_1.view().transpose(), matrix_2.view());
+
+        EXPECT_EQ(expected, matrix_result);
+    }
+
+    TEST(DataStructureMatrixView, MultiplyBlock)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(3, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9});
+
+        const auto& matrix_result = ml::data_structure::matrix::multiplies_matrix(
+            matrix.view().block(0, 1, 2, 2), matrix.view().block(2, 1, 1, 2).transpose());
+
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(2, 1, {2 * 8 + 3 * 9, 5 * 8 + 6 * 9}), matrix_result);
+        EXPECT_THROW(ml::data_structure::matrix::multiplies_matrix(matrix.view().row(0), matrix.view().row(0)),
+                     std::invalid_argument);
+    }
+
+    TEST(DataStructureMatrixView, Arithmetic)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_1(2, 3, {1, 2, 3, 4, 5, 6});
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_2(3, 2, {10, 20, 30, 40, 50, 60});
+
+        ml::data_structure::matrix::DynamicMatrix<int> matrix_result =
+            matrix_1 + matrix_2.view().transpose() * 2 - matrix_1.view().row(0);
+
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(2, 3, {20, 60, 100, 43, 83, 123}), matrix_result);
+    }
+
+    TEST(DataStructureMatrixView, ArithmeticAliasing)
+    {
+        ml::data_structure::matrix::DynamicMatrix<int> matrix(2, 2, {1, 2, 3, 4});
+        matrix = matrix + matrix.view().transpose();
+
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<int>(2, 2, {2, 5, 5, 8}), matrix);
+    }
+
+    TEST(DataStructureMatrixView, Statistics)
+    {
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(3, 2, {1.0f, 6.0f, 3.0f, 2.0f, 5.0f, 4.0f});
+        const auto& transposed = matrix.transpose();
+        const auto view = matrix.view().transpose();
+
+        EXPECT_FLOAT_EQ(transposed.sum(), ml::data_structure::matrix::sum(view));
+        EXPECT_FLOAT_EQ(transposed.median(), ml::data_structure::matrix::median(view));
+        EXPECT_FLOAT_EQ(transposed.variance(1), ml::data_structure::matrix::variance(view, 1));
+        EXPECT_EQ(transposed.sum_columns(), ml::data_structure::matrix::sum_columns(view));
+        EXPECT_EQ(transposed.min_rows(), ml::data_structure::matrix::min_rows(view));
+        EXPECT_EQ(transposed.max_columns(), ml::data_structure::matrix::max_columns(view));
+        EXPECT_EQ(transposed.peak_to_peak_rows(), ml::data_structure::matrix::peak_to_peak_rows(view));
+        EXPECT_EQ(matrix.mean_columns(), ml::data_structure::matrix::mean_columns(matrix.view()));
+        EXPECT_FLOAT_EQ(3.0f, ml::data_structure::matrix::median(matrix.view().column(0)));
+        EXPECT_FLOAT_EQ(matrix.variance_columns()(0, 1), ml::data_structure::matrix::variance(view.row(1)));
+    }
+
+    TEST(DataStructureMatrixView, Describe)
+    {
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(3, 4, {1, 6, 3, 2, 5, 4, 9, 0, 7, 8, 2, 1});
+        const auto& transposed = matrix.transpose();
+
+        const auto description = ml::data_structure::matrix::describe(matrix.view().transpose());
+        const auto columns = ml::data_structure::matrix::describe_columns(matrix.view().transpose());
+        const auto rows = ml::data_structure::matrix::describe_rows(matrix.view().transpose(), 1);
+        const auto block_columns = ml::data_structure::matrix::describe_columns(matrix.view().block(1, 1, 2, 3));
+
+        EXPECT_FLOAT_EQ(transposed.variance(), description.variance);
+        EXPECT_EQ(transposed.sum_columns(), columns.sum);
+        EXPECT_EQ(transposed.peak_to_peak_columns(), columns.peak_to_peak);
+        EXPECT_EQ(transposed.max_rows(), rows.max);
+        for (size_t i = 0; i < 4; i++)
+            EXPECT_FLOAT_EQ(transposed.variance_rows(1)(i, 0), rows.variance(i, 0));
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<float>(1, 3, {12, 11, 1}), block_columns.sum);
+    }
+} // namespace tests::unit_tests
@@ -0,0 +1,58 @@
+/**
+ ** @file tests/unit_tests/generator/random/bernoulli_random.cc
+ ** @brief Tests for the ml::generator::random::BernoulliRandom functions
+ */
+
+#include "generator/random/bernoulli_random.hh"
+
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace tests::unit_tests
+{
+    TEST(GeneratorRandomBernoulliRandom, Distribution)
+    {
+        auto generator = ml::generator::random::BernoulliRandom<float>(0.3, 42);
+
+        std::vector<float> data(200000);
+        generator.fill(data.data(), data.data() + data.size());
+
+        for (float value : data)
+            EXPECT_TRUE(value == 0.0f || value == 1.0f);
+
+        EXPECT_NEAR(0.3, std::accumulate(data.begin(), data.end(), 0.0) / data.size(), 0.005);
+    }
+
+    TEST(GeneratorRandomBernoulliRandom, Bounds)
+    {
+        std::vector<int> data(1000);
+
+        auto never = ml::generator::random::BernoulliRandom<int>(0.0);
+        never.fill(data.data(), data.data() + data.size());
+        EXPECT_EQ(std::vector<int>(data.size(), 0), data);
+
+        auto always = ml::generator::random::BernoulliRandom<int>(1.0);
+        always.fill(data.data(), data.data() + data.size());
+        EXPECT_EQ(std::vector<int>(data.size(), 1), data);
+
+        EXPECT_THROW(ml::generator::random::BernoulliRandom<int>(-0.1), std::invalid_argument);
+        EXPECT_THROW(ml::generator::random::BernoulliRandom<int>(1.1), std::invalid_argument);
+    }
+
+    TEST(GeneratorRandomBernoulliRandom, Fill)
+    {
+        auto generator = ml::generator::random::BernoulliRandom<double>(0.5, 7);
+        auto copy = generator;
+
+        std::vector<double> expected(1500);
+        for (auto& value : expected)
+            value = generator();
+
+        std::vector<double> data(expected.size());
+        copy.fill(data.data(), data.data() + data.size());
+        EXPECT_EQ(expected, data);
+    }
+} // namespace tests::unit_tests
@@ -0,0 +1,72 @@
+/**
+ ** @file tests/unit_tests/generator/random/normal_random.cc
+ ** @brief Tests for the ml::generator::random::NormalRandom functions
+ */
+
+#include "generator/random/normal_random.hh"
+
+#include <vector>
+
+#include "computation/statistic.hh"
+#include "gtest/gtest.h"
+
+namespace tests::unit_tests
+{
+    TEST(GeneratorRandomNormalRandom, Distribution)
+    {
+        auto generator = ml::generator::random::NormalRandom<double>(3.0, 2.0, 42);
+
+        std::vector<double> data(200000);
+        generator.fill(data.data(), data.data() + data.size());
+
+        EXPECT_NEAR(3.0, ml::computation::statistic::mean(data.begin(), data.end()), 0.02);
+        EXPECT_NEAR(2.0, ml::computation::statistic::standard_deviation(data.begin(), data.end()), 0.02);
+
+        // About 95.45% of the values within two standard deviations
+        const auto within_count = std::count_if(data.begin(), data.end(), [](double value) {
+            return std::abs(value - 3.0) < 4.0;
+        });
+        EXPECT_NEAR(0.9545, static_cast<double>(within_count) / data.size(), 0.002);
+    }
+
+    TEST(GeneratorRandomNormalRandom, Fill)
+    {
+        auto generator = ml::generator::random::NormalRandom<float>(0.0f, 1.0f, 7);
+        auto copy = generator;
+
+        std::vector<float> expected(2501);
+        for (auto& value : expected)
+            value = generator();
+
+        // The values in blocks, whatever the alignment on the pairs of the transform
+        std::vector<float> data(expected.size());
+        copy.fill(data.data(), data.data() + 1);
+        copy.fill(data.data() + 1, data.data() + 4);
+        copy.fill(data.data() + 4, data.data() + 2000);
+        copy.fill(data.data() + 2000, data.data() + data.size());
+
+        // The same values up to the last bits of the vectorised log, sin and cos
+        for (size_t i = 0; i < data.size(); i++)
+        {
+            EXPECT_NEAR(expected[i], data[i], 1e-5f) << i;
+            EXPECT_TRUE(std::isfinite(data[i]));
+        }
+    }
+
+    TEST(GeneratorRandomNormalRandom, Split)
+    {
+        const auto generator = ml::generator::random::NormalRandom<float>(0.0f, 1.0f, 42);
+        auto first = generator.split(1);
+        auto second = ml::generator::random::NormalRandom<float>(0.0f, 1.0f, 42, 1);
+
+        std::vector<float> first_data(1000);
+        std::vector<float> second_data(1000);
+        first.fill(first_data.data(), first_data.data() + first_data.size());
+        second.fill(second_data.data(), second_data.data() + second_data.size());
+        EXPECT_EQ(first_data, second_data);
+
+        auto other = generator;
+        other.fill(second_data.data(), second_data.data() + second_data.size());
+        EXPECT_NE(first_data, second_data);
+    }
+} // namespace tests::unit_tests
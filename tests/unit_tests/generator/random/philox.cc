@@ -0,0 +1,95 @@
+/**
+ ** @file tests/unit_tests/generator/random/philox.cc
+ ** @brief Tests for the ml::generator::random::Philox functions
+ */
+
+#include "generator/random/philox.hh"
+
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace tests::unit_tests
+{
+    TEST(GeneratorRandomPhilox, KnownAnswers)
+    {
+        // The counter is {block, stream} and the key the seed: the zero vector is the known answer of the reference
+        // implementation, the other ones its answers on the keys and streams of its known answers, with blocks a
+        // 64 bits position reaches
+        ml::generator::random::Philox zero(0);
+        EXPECT_EQ(std::vector<uint32_t>({0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}),
+                  std::vector<uint32_t>({zero(), zero(), zero(), zero()}));
+
+        std::vector<uint32_t> words(4);
+        ml::generator::random::Philox ones(0xffffffffffffffff, 0xffffffffffffffff);
+        ones.generate(0x3fffffffffffffffull * 4, words.data(), words.size());
+        EXPECT_EQ(std::vector<uint32_t>({0x8c5f4338, 0x4a57523d, 0x7e300cb1, 0x411fcefd}), words);
+
+        ml::generator::random::Philox pi(0x299f31d0a4093822, 0x0370734413198a2e);
+        pi.generate(0x05a308d3243f6a88ull * 4, words.data(), words.size());
+        EXPECT_EQ(std::vector<uint32_t>({0x2fe11a02, 0x572a2f27, 0x2f88763b, 0x78d5e325}), words);
+    }
+
+    TEST(GeneratorRandomPhilox, Generate)
+    {
+        ml::generator::random::Philox engine(42, 7);
+
+        std::vector<uint32_t> expected(103);
+        for (auto& word : expected)
+            word = engine();
+        EXPECT_EQ(103, engine.get_position());
+
+        // The same words in blocks, from any position, whatever the alignment on the blocks of the counter
+        for (size_t position : {0, 1, 3, 4, 5})
+        {
+            for (size_t count : {0, 1, 2, 7, 98})
+            {
+                std::vector<uint32_t> words(count);
+                engine.generate(position, words.data(), count);
+                EXPECT_EQ(std::vector<uint32_t>(expected.begin() + position, expected.begin() + position + count),
+                          words);
+            }
+        }
+
+        engine.set_position(2);
+        std::vector<uint32_t> words(50);
+        engine.generate(words.data(), words.size());
+        EXPECT_EQ(std::vector<uint32_t>(expected.begin() + 2, expected.begin() + 52), words);
+        EXPECT_EQ(52, engine.get_position());
+        EXPECT_EQ(expected[52], engine());
+
+        engine.discard(40);
+        EXPECT_EQ(93, engine.get_position());
+        EXPECT_EQ(expected[93], engine());
+    }
+
+    TEST(GeneratorRandomPhilox, Streams)
+    {
+        ml::generator::random::Philox first(42, 0);
+        ml::generator::random::Philox second(42, 1);
+        ml::generator::random::Philox other_key(43, 0);
+
+        size_t same_count = 0;
+        for (size_t i = 0; i < 1000; i++)
+        {
+            const uint32_t word = first();
+            same_count += word == second();
+            same_count += word == other_key();
+        }
+
+        EXPECT_EQ(0, same_count);
+
+        // A split engine is the engine of the other stream
+        const auto split = first.split(1);
+        EXPECT_EQ(42, split.get_key());
+        EXPECT_EQ(1, split.get_stream());
+        EXPECT_EQ(0, split.get_position());
+
+        // A standard distribution can draw from the engine
+        std::uniform_int_distribution<int> distribution(0, 9);
+        const int value = distribution(first);
+        EXPECT_LE(0, value);
+        EXPECT_GE(9, value);
+    }
+} // namespace tests::unit_tests
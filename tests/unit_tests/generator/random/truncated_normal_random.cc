@@ -0,0 +1,131 @@
+/**
+ ** @file tests/unit_tests/generator/random/truncated_normal_random.cc
+ ** @brief Tests for the ml::generator::random::TruncatedNormalRandom functions
+ */
+
+#include "generator/random/truncated_normal_random.hh"
+
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "computation/statistic.hh"
+#include "gtest/gtest.h"
+
+namespace tests::unit_tests
+{
+    TEST(GeneratorRandomTruncatedNormalRandom, Range)
+    {
+        auto generator = ml::generator::random::TruncatedNormalRandom<float>(1.0f, 0.5f, 0.0f, 2.0f, 42);
+
+        std::vector<float> data(200000);
+        generator.fill(data.data(), data.data() + data.size());
+
+        for (float value : data)
+        {
+            EXPECT_LE(0.0f, value);
+            EXPECT_GE(2.0f, value);
+        }
+
+        // A normal distribution truncated to two standard deviations keeps a standard deviation of 0.8796
+        EXPECT_NEAR(1.0f, ml::computation::statistic::mean(data.begin(), data.end()), 0.005f);
+        EXPECT_NEAR(0.5f * 0.8796f, ml::computation::statistic::standard_deviation(data.begin(), data.end()), 0.005f);
+    }
+
+    TEST(GeneratorRandomTruncatedNormalRandom, Distribution)
+    {
+        // Bounds far in the tails leave the normal distribution
+        auto generator = ml::generator::random::TruncatedNormalRandom<double>(-2.0, 3.0, -50.0, 50.0, 42);
+
+        std::vector<double> data(200000);
+        generator.fill(data.data(), data.data() + data.size());
+
+        EXPECT_NEAR(-2.0, ml::computation::statistic::mean(data.begin(), data.end()), 0.03);
+        EXPECT_NEAR(3.0, ml::computation::statistic::standard_deviation(data.begin(), data.end()), 0.03);
+
+        const auto below_count = std::count_if(data.begin(), data.end(), [](double value) { return value < 1.0; });
+        EXPECT_NEAR(0.8413, static_cast<double>(below_count) / data.size(), 0.003);
+
+        // One side only
+        auto half = ml::generator::random::TruncatedNormalRandom<double>(0.0, 1.0, 0.0, 10.0, 42);
+        half.fill(data.data(), data.data() + data.size());
+        EXPECT_NEAR(0.7979, ml::computation::statistic::mean(data.begin(), data.end()), 0.01);
+    }
+
+    template <typename T>
+    class GeneratorRandomTruncatedNormalRandomTail : public testing::Test
+    {};
+
+    using GeneratorRandomTruncatedNormalRandomTailTypes = testing::Types<float, double>;
+    TYPED_TEST_SUITE(GeneratorRandomTruncatedNormalRandomTail, GeneratorRandomTruncatedNormalRandomTailTypes, );
+
+    TYPED_TEST(GeneratorRandomTruncatedNormalRandomTail, OneSided)
+    {
+        // Ranges in one tail, where erf rounds both bounds to nearly or exactly the same image
+        const std::vector<std::array<double, 4>> ranges({{0.0, 1.0, 4.0, 6.0},
+                                                         {0.0, 1.0, 5.5, 8.0},
+                                                         {0.0, 1.0, -8.0, -6.0},
+                                                         {0.0, 1.0, 6.0, 8.0},
+                                                         {0.0, 1.0, 12.0, 13.0},
+                                                         {10.0, 2.0, 18.0, 22.0},
+                                                         {10.0, 2.0, -6.0, 0.0}});
+
+        for (const auto& [mean, standard_deviation, minimum, maximum] : ranges)
+        {
+            auto generator =
+                ml::generator::random::TruncatedNormalRandom<TypeParam>(static_cast<TypeParam>(mean),
+                                                                        static_cast<TypeParam>(standard_deviation),
+                                                                        static_cast<TypeParam>(minimum),
+                                                                        static_cast<TypeParam>(maximum),
+                                                                        7);
+
+            std::vector<TypeParam> data(1 << 16);
+            generator.fill(data.data(), data.data() + data.size());
+
+            for (TypeParam value : data)
+            {
+                ASSERT_FALSE(std::isnan(value)) << minimum << " " << maximum;
+                ASSERT_LE(static_cast<TypeParam>(minimum), value);
+                ASSERT_GE(static_cast<TypeParam>(maximum), value);
+            }
+
+            // The mean of the standard normal distribution truncated to [a, b] is (pdf(a) - pdf(b)) / (cdf(b) - cdf(a))
+            const auto density = [](long double x) { return std::exp(-x * x / 2) / std::sqrt(2 * std::acos(-1.0L)); };
+            const auto upper_tail = [](long double x) { return std::erfc(x / std::sqrt(2.0L)) / 2; };
+            const long double low = (minimum - mean) / standard_deviation;
+            const long double high = (maximum - mean) / standard_deviation;
+            const long double expected =
+                mean + standard_deviation * (density(low) - density(high)) / (upper_tail(low) - upper_tail(high));
+
+            EXPECT_NEAR(static_cast<double>(expected),
+                        static_cast<double>(ml::computation::statistic::mean(data.begin(), data.end())),
+                        0.005 * standard_deviation)
+                << minimum << " " << maximum;
+        }
+    }
+
+    TEST(GeneratorRandomTruncatedNormalRandom, Fill)
+    {
+        auto generator = ml::generator::random::TruncatedNormalRandom<double>(0.0, 1.0, -2.0, 2.0, 7);
+        auto copy = generator;
+
+        std::vector<double> expected(1500);
+        for (auto& value : expected)
+            value = generator();
+
+        // The same values up to the last bits of the vectorised erf and exp
+        std::vector<double> data(expected.size());
+        copy.fill(data.data(), data.data() + data.size());
+        for (size_t i = 0; i < data.size(); i++)
+            EXPECT_NEAR(expected[i], data[i], 1e-12) << i;
+    }
+
+    TEST(GeneratorRandomTruncatedNormalRandom, Invalid)
+    {
+        EXPECT_THROW(ml::generator::random::TruncatedNormalRandom<float>(0.0f, 1.0f, 1.0f, 1.0f),
+                     std::invalid_argument);
+        EXPECT_THROW(ml::generator::random::TruncatedNormalRandom<float>(0.0f, 1.0f, 2.0f, -2.0f),
+                     std::invalid_argument);
+    }
+} // namespace tests::unit_tests
@@ -5,8 +5,11 @@
 
 #include "generator/random/uniform_random.hh"
 
+#include <vector>
+
 #include "computation/statistic.hh"
 #include "gtest/gtest.h"
+#include "parallel/thread_pool.hh"
 
 namespace tests::unit_tests
 {
@@ -34,4 +37,117 @@ namespace tests::unit_tests
 
         EXPECT_EQ(5, rounded_mean);
     }
-} // namespace tests::unit_tests
\ No newline at end of file
+
+    TEST(GeneratorRandomUniformRandom, Fill)
+    {
+        auto generator = ml::generator::random::UniformRandom<double>(-2.0, 3.0);
+        auto copy = generator;
+
+        std::vector<double> expected(2500);
+        for (auto& value : expected)
+            value = generator();
+
+        // The same values in blocks, and the generator goes on after them
+        std::vector<double> data(2000);
+        copy.fill(data.data(), data.data() + data.size());
+        EXPECT_EQ(std::vector<double>(expected.begin(), expected.begin() + 2000), data);
+        EXPECT_EQ(expected[2000], copy());
+
+        for (double value : data)
+        {
+            EXPECT_LE(-2.0, value);
+            EXPECT_GT(3.0, value);
+        }
+    }
+
+    TEST(GeneratorRandomUniformRandom, FillParallel)
+    {
+        const size_t thread_count = ml::parallel::get_thread_count();
+        const auto generator = ml::generator::random::UniformRandom<float>(0.0f, 1.0f);
+
+        std::vector<float> expected(ml::generator::random::PARALLEL_GENERATION_SIZE * 2 + 17);
+        ml::parallel::set_thread_count(1);
+        auto sequential = generator;
+        sequential.fill(expected.data(), expected.data() + expected.size());
+
+        // The same values whatever the number of threads
+        for (size_t count : {2, 3, 4})
+        {
+            ml::parallel::set_thread_count(count);
+
+            std::vector<float> data(expected.size());
+            auto parallel = generator;
+            parallel.fill(data.data(), data.data() + data.size());
+            EXPECT_EQ(expected, data) << count;
+        }
+
+        ml::parallel::set_thread_count(thread_count);
+    }
+
+    TEST(GeneratorRandomUniformRandom, Seed)
+    {
+        auto generator = ml::generator::random::UniformRandom<float>(0.0f, 1.0f, 42);
+        auto same_seed = ml::generator::random::UniformRandom<float>(0.0f, 1.0f, 42);
+        auto other_seed = ml::generator::random::UniformRandom<float>(0.0f, 1.0f, 43);
+
+        EXPECT_EQ(42, generator.get_seed());
+        EXPECT_EQ(0, generator.get_stream());
+
+        std::vector<float> data(1000);
+        std::vector<float> same_data(data.size());
+        std::vector<float> other_data(data.size());
+        generator.fill(data.data(), data.data() + data.size());
+        same_seed.fill(same_data.data(), same_data.data() + same_data.size());
+        other_seed.fill(other_data.data(), other_data.data() + other_data.size());
+
+        EXPECT_EQ(data, same_data);
+        EXPECT_NE(data, other_data);
+
+        // The generators seeded by random_seed are all different
+        auto first = ml::generator::random::UniformRandom<float>(0.0f, 1.0f);
+        auto second = ml::generator::random::UniformRandom<float>(0.0f, 1.0f);
+        EXPECT_NE(first.get_seed(), second.get_seed());
+    }
+
+    TEST(GeneratorRandomUniformRandom, Discard)
+    {
+        auto generator = ml::generator::random::UniformRandom<double>(-1.0, 1.0, 7);
+        auto copy = generator;
+
+        std::vector<double> expected(100);
+        generator.fill(expected.data(), expected.data() + expected.size());
+
+        copy.discard(60);
+        EXPECT_EQ(expected[60], copy());
+    }
+
+    TEST(GeneratorRandomUniformRandom, Split)
+    {
+        const auto generator = ml::generator::random::UniformRandom<float>(-3.0f, 5.0f, 42);
+
+        // Every worker draws its own stream, the same one at every run and with the same range
+        std::vector<std::vector<float>> streams(4, std::vector<float>(1000));
+        for (size_t stream = 0; stream < streams.size(); stream++)
+        {
+            auto worker = generator.split(stream);
+            EXPECT_EQ(42, worker.get_seed());
+            EXPECT_EQ(stream, worker.get_stream());
+
+            worker.fill(streams[stream].data(), streams[stream].data() + streams[stream].size());
+            for (float value : streams[stream])
+            {
+                EXPECT_LE(-3.0f, value);
+                EXPECT_GT(5.0f, value);
+            }
+        }
+
+        auto seeded = ml::generator::random::UniformRandom<float>(-3.0f, 5.0f, 42, 2);
+        std::vector<float> data(1000);
+        seeded.fill(data.data(), data.data() + data.size());
+        EXPECT_EQ(streams[2], data);
+
+        for (size_t i = 0; i < streams.size(); i++)
+            for (size_t j = i + 1; j < streams.size(); j++)
+                EXPECT_NE(streams[i], streams[j]);
+    }
+} // namespace tests::unit_tests
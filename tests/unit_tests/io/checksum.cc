@@ -0,0 +1,47 @@
+/**
+ ** @file tests/unit_tests/io/checksum.cc
+ ** @brief Tests for the ml::io checksums
+ */
+
+#include "io/checksum.hh"
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace tests::unit_tests
+{
+    TEST(IoChecksum, KnownAnswers)
+    {
+        // The empty input, a tail of 8 and 4 bytes, then stripes of 32 bytes and every kind of tail
+        EXPECT_EQ(0xEF46DB3751D8E999, ml::io::xxhash64("", 0));
+
+        const std::string hello = "hello, world";
+        EXPECT_EQ(0xB33A384E6D1B1242, ml::io::xxhash64(hello.data(), hello.size()));
+
+        const std::string alphabet = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789$";
+        EXPECT_EQ(0x1032D841E824F998, ml::io::xxhash64(alphabet.data(), alphabet.size()));
+    }
+
+    TEST(IoChecksum, Changes)
+    {
+        std::vector<unsigned char> data(1000);
+        for (size_t i = 0; i < data.size(); i++)
+            data[i] = static_cast<unsigned char>(i * 7);
+
+        const uint64_t hash = ml::io::xxhash64(data.data(), data.size());
+        EXPECT_NE(hash, ml::io::xxhash64(data.data(), data.size(), 1));
+        EXPECT_NE(hash, ml::io::xxhash64(data.data(), data.size() - 1));
+
+        // A single bit anywhere changes the hash, whatever its alignment
+        for (size_t i : {0, 1, 31, 500, 999})
+        {
+            data[i] ^= 1;
+            EXPECT_NE(hash, ml::io::xxhash64(data.data(), data.size())) << i;
+            data[i] ^= 1;
+        }
+
+        EXPECT_EQ(hash, ml::io::xxhash64(data.data(), data.size()));
+    }
+} // namespace tests::unit_tests
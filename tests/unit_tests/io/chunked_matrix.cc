@@ -0,0 +1,116 @@
+/**
+ ** @file tests/unit_tests/io/chunked_matrix.cc
+ ** @brief Tests for ml::io::ChunkedMatrix
+ */
+
+#include "io/chunked_matrix.hh"
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include "generator/random/uniform_random.hh"
+#include "gtest/gtest.h"
+#include "io/matrix_file.hh"
+
+namespace tests::unit_tests
+{
+    /// Save a random matrix in the temporary directory of the tests, the file is removed with the object
+    struct ChunkedMatrixFile
+    {
+        ChunkedMatrixFile(const std::string& name, size_t height, size_t width)
+            : path(::testing::TempDir() + name)
+            , matrix(height, width)
+        {
+            matrix.fill_generator(ml::generator::random::UniformRandom<double>(-10.0, 10.0, 42));
+            ml::io::save(path, matrix);
+        }
+
+        ~ChunkedMatrixFile()
+        {
+            std::remove(path.c_str());
+        }
+
+        std::string path;
+        ml::data_structure::matrix::DynamicMatrix<double> matrix;
+    };
+
+    TEST(IoChunkedMatrix, Chunks)
+    {
+        const ChunkedMatrixFile file("ml_io_chunked_chunks.mat", 1000, 7);
+        const ml::io::ChunkedMatrix<double> chunked(file.path, 64);
+
+        EXPECT_EQ(1000, chunked.get_height());
+        EXPECT_EQ(7, chunked.get_width());
+        EXPECT_EQ(64, chunked.get_chunk_height());
+        EXPECT_EQ(16, chunked.get_chunk_count());
+
+        // The chunks come in order, the last one with the remaining rows
+        size_t next_row = 0;
+        chunked.for_each_chunk([&](size_t first_row, const auto& chunk) {
+            EXPECT_EQ(next_row, first_row);
+            EXPECT_EQ(first_row + 64 <= 1000 ? 64 : 1000 % 64, chunk.get_height());
+            EXPECT_EQ(file.matrix.view().block(first_row, 0, chunk.get_height(), 7).evaluate(), chunk.evaluate());
+            next_row += chunk.get_height();
+        });
+        EXPECT_EQ(1000, next_row);
+
+        EXPECT_EQ(file.matrix.view().block(100, 0, 50, 7).evaluate(), chunked.read_rows(100, 50));
+        EXPECT_EQ(0, chunked.read_rows(1000, 0).get_height());
+        EXPECT_THROW(chunked.read_rows(990, 11), std::out_of_range);
+
+        // The default chunks of about CHUNKED_MATRIX_CHUNK_SIZE bytes hold the whole matrix
+        EXPECT_EQ(1, ml::io::ChunkedMatrix<double>(file.path).get_chunk_count());
+    }
+
+    TEST(IoChunkedMatrix, Reductions)
+    {
+        const ChunkedMatrixFile file("ml_io_chunked_reductions.mat", 1000, 7);
+        const auto& matrix = file.matrix;
+
+        for (size_t chunk_height : {1, 37, 1000, 4096})
+        {
+            const ml::io::ChunkedMatrix<double> chunked(file.path, chunk_height);
+
+            EXPECT_EQ(matrix.min_columns(), chunked.min_columns());
+            EXPECT_EQ(matrix.max_columns(), chunked.max_columns());
+
+            // The chunks are summed apart, the rounding differs from the one of a single sweep
+            const auto sum = chunked.sum_columns();
+            const auto mean = chunked.mean_columns();
+            const auto variance = chunked.variance_columns(1);
+            const auto description = chunked.describe_columns(1);
+
+            // Both merge the same moments of the chunks
+            EXPECT_EQ(variance, description.variance);
+            for (size_t j = 0; j < 7; j++)
+            {
+                EXPECT_NEAR(matrix.sum_columns()(0, j), sum(0, j), 1e-9);
+                EXPECT_NEAR(matrix.mean_columns()(0, j), mean(0, j), 1e-12);
+                EXPECT_NEAR(matrix.variance_columns(1)(0, j), variance(0, j), 1e-12);
+                EXPECT_NEAR(matrix.sum_columns()(0, j), description.sum(0, j), 1e-9);
+                EXPECT_EQ(matrix.min_columns()(0, j), description.min(0, j));
+                EXPECT_EQ(matrix.max_columns()(0, j), description.max(0, j));
+                EXPECT_NEAR(matrix.mean_columns()(0, j), description.mean(0, j), 1e-12);
+                EXPECT_NEAR(matrix.variance_columns(1)(0, j), description.variance(0, j), 1e-12);
+                EXPECT_NEAR(matrix.standard_deviation_columns(1)(0, j), description.standard_deviation(0, j), 1e-12);
+                EXPECT_EQ(description.max(0, j) - description.min(0, j), description.peak_to_peak(0, j));
+            }
+        }
+    }
+
+    TEST(IoChunkedMatrix, Invalid)
+    {
+        const ChunkedMatrixFile file("ml_io_chunked_invalid.mat", 10, 3);
+
+        EXPECT_THROW(ml::io::ChunkedMatrix<float>(file.path), std::invalid_argument);
+        EXPECT_THROW(ml::io::ChunkedMatrix<double>(file.path + ".missing"), std::system_error);
+
+        const std::string text_path = ::testing::TempDir() + "ml_io_chunked_invalid.txt";
+        std::ofstream(text_path) << "not a matrix file";
+        EXPECT_THROW(ml::io::ChunkedMatrix<double>(text_path, 4), std::invalid_argument);
+        std::remove(text_path.c_str());
+    }
+} // namespace tests::unit_tests
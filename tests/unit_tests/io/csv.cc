@@ -0,0 +1,138 @@
+/**
+ ** @file tests/unit_tests/io/csv.cc
+ ** @brief Tests for the ml::io delimited text readers
+ */
+
+#include "io/csv.hh"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <system_error>
+
+#include "gtest/gtest.h"
+#include "parallel/thread_pool.hh"
+
+namespace tests::unit_tests
+{
+    static ml::io::CsvResult<double> parse_csv(const std::string& text, const ml::io::CsvOptions& options = {})
+    {
+        return ml::io::parse_csv<double>(text.data(), text.data() + text.size(), options);
+    }
+
+    TEST(IoCsv, Parse)
+    {
+        const auto result = parse_csv("1,2.5,-3\n4e2, +5 ,\"6\"\r\n\n7,8,9");
+
+        ASSERT_EQ(3, result.matrix.get_height());
+        ASSERT_EQ(3, result.matrix.get_width());
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<double>(3, 3, {1, 2.5, -3, 400, 5, 6, 7, 8, 9}),
+                  result.matrix);
+        EXPECT_TRUE(result.column_names.empty());
+        EXPECT_EQ(std::vector<size_t>({0, 0, 0}), result.column_error_counts);
+        EXPECT_TRUE(result.errors.empty());
+    }
+
+    TEST(IoCsv, Header)
+    {
+        ml::io::CsvOptions options;
+        options.header = true;
+        options.delimiter = '\t';
+
+        const auto result = parse_csv("width\t\"sepal, length\"\n1\t2\n3\t4\n", options);
+
+        EXPECT_EQ(std::vector<std::string>({"width", "sepal, length"}), result.column_names);
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<double>(2, 2, {1, 2, 3, 4}), result.matrix);
+
+        // A header without rows
+        const auto empty = parse_csv("a\tb\tc\n", options);
+        EXPECT_EQ(0, empty.matrix.get_height());
+        EXPECT_EQ(3, empty.matrix.get_width());
+
+        EXPECT_EQ(0, parse_csv("").matrix.get_height());
+    }
+
+    TEST(IoCsv, Errors)
+    {
+        const auto result = parse_csv("1,2,3\n4,x,6\n7,8\n9,10,11,12\n13,,1.5.2\n");
+
+        ASSERT_EQ(5, result.matrix.get_height());
+        EXPECT_EQ(std::vector<size_t>({0, 2, 2}), result.column_error_counts);
+        EXPECT_EQ(6, result.matrix(1, 2));
+        EXPECT_EQ(10, result.matrix(3, 1));
+
+        // In the order of the text: a value which is not a number, a missing field, a field after the last column
+        ASSERT_EQ(5, result.errors.size());
+        EXPECT_EQ(1, result.errors[0].row);
+        EXPECT_EQ(1, result.errors[0].column);
+        EXPECT_EQ("x", result.errors[0].field);
+        EXPECT_EQ(2, result.errors[1].row);
+        EXPECT_EQ(2, result.errors[1].column);
+        EXPECT_EQ("", result.errors[1].field);
+        EXPECT_EQ(3, result.errors[2].row);
+        EXPECT_EQ(3, result.errors[2].column);
+        EXPECT_EQ("12", result.errors[2].field);
+        EXPECT_EQ("1.5.2", result.errors[4].field);
+
+        ml::io::CsvOptions options;
+        options.max_errors = 2;
+        EXPECT_EQ(2, parse_csv("x,x,x\nx,x,x\n", options).errors.size());
+        EXPECT_EQ(std::vector<size_t>({2, 2, 2}), parse_csv("x,x,x\nx,x,x\n", options).column_error_counts);
+
+        const std::string text = "1,2\n3,4.5\n";
+        const auto integers = ml::io::parse_csv<int>(text.data(), text.data() + text.size());
+        EXPECT_EQ(0, integers.matrix(1, 1));
+        EXPECT_EQ(std::vector<size_t>({0, 1}), integers.column_error_counts);
+    }
+
+    TEST(IoCsv, Chunks)
+    {
+        // Enough rows for several chunks, parsed by several threads
+        std::string text;
+        const size_t height = 3 * ml::io::CSV_CHUNK_SIZE / 20;
+        for (size_t i = 0; i < height; i++)
+            text += std::to_string(i) + "," + std::to_string(i * 0.5) + "\n";
+
+        const auto chunks = ml::io::split_csv_chunks(text.data(), text.data() + text.size(), ml::io::CSV_CHUNK_SIZE);
+        EXPECT_LT(2, chunks.size());
+        for (size_t chunk = 1; chunk + 1 < chunks.size(); chunk++)
+            EXPECT_EQ('\n', chunks[chunk][-1]);
+
+        const size_t thread_count = ml::parallel::get_thread_count();
+        for (size_t count : {1, 3})
+        {
+            ml::parallel::set_thread_count(count);
+
+            const auto result = parse_csv(text);
+            ASSERT_EQ(height, result.matrix.get_height());
+            ASSERT_EQ(2, result.matrix.get_width());
+            EXPECT_TRUE(result.errors.empty());
+
+            for (size_t i = 0; i < height; i++)
+            {
+                EXPECT_EQ(i, result.matrix(i, 0));
+                EXPECT_EQ(i * 0.5, result.matrix(i, 1));
+            }
+        }
+
+        ml::parallel::set_thread_count(thread_count);
+    }
+
+    TEST(IoCsv, File)
+    {
+        const std::string path = ::testing::TempDir() + "ml_io_csv.csv";
+        EXPECT_THROW(ml::io::read_csv<float>(path), std::system_error);
+
+        {
+            std::ofstream file(path);
+            file << "a,b\n0.25,1\n";
+        }
+
+        ml::io::CsvOptions options;
+        options.header = true;
+        const auto result = ml::io::read_csv<float>(path, options);
+        EXPECT_EQ(ml::data_structure::matrix::DynamicMatrix<float>(1, 2, {0.25f, 1.0f}), result.matrix);
+
+        std::remove(path.c_str());
+    }
+} // namespace tests::unit_tests
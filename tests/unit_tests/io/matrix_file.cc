@@ -0,0 +1,127 @@
+/**
+ ** @file tests/unit_tests/io/matrix_file.cc
+ ** @brief Tests for the ml::io matrix files
+ */
+
+#include "io/matrix_file.hh"
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include "generator/random/uniform_random.hh"
+#include "gtest/gtest.h"
+
+namespace tests::unit_tests
+{
+    /// A path in the temporary directory of the tests, removed with the object
+    struct TemporaryPath
+    {
+        explicit TemporaryPath(const std::string& name)
+            : path(::testing::TempDir() + name)
+        {}
+
+        ~TemporaryPath()
+        {
+            std::remove(path.c_str());
+        }
+
+        std::string path;
+    };
+
+    TEST(IoMatrixFile, DynamicMatrix)
+    {
+        const TemporaryPath temporary("ml_io_dynamic_matrix.mat");
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(37, 53);
+        matrix.fill_generator(ml::generator::random::UniformRandom<float>(-1.0f, 1.0f, 42));
+        ml::io::save(temporary.path, matrix);
+
+        EXPECT_EQ(matrix, ml::io::load<float>(temporary.path));
+
+        // The view reads the elements in the mapping, aligned as the matrix buffers
+        const ml::io::MappedMatrix<float> mapped(temporary.path);
+        EXPECT_EQ(37, mapped.get_height());
+        EXPECT_EQ(53, mapped.get_width());
+        EXPECT_EQ(0, reinterpret_cast<uintptr_t>(mapped.view().data()) % ml::io::MATRIX_FILE_ALIGNMENT);
+        EXPECT_TRUE(mapped.view().is_contiguous());
+        EXPECT_EQ(matrix, mapped.view().evaluate());
+        EXPECT_EQ(matrix(36, 52), mapped.view()(36, 52));
+    }
+
+    TEST(IoMatrixFile, Matrix)
+    {
+        const TemporaryPath temporary("ml_io_matrix.mat");
+
+        ml::data_structure::matrix::Matrix<int32_t, 3, 4> matrix;
+        for (size_t i = 0; i < 3; i++)
+            for (size_t j = 0; j < 4; j++)
+                matrix(i, j) = static_cast<int32_t>(i * 10 - j);
+
+        ml::io::save(temporary.path, matrix);
+        const auto loaded = ml::io::load<int32_t>(temporary.path);
+
+        ASSERT_EQ(3, loaded.get_height());
+        ASSERT_EQ(4, loaded.get_width());
+        for (size_t i = 0; i < 3; i++)
+            for (size_t j = 0; j < 4; j++)
+                EXPECT_EQ(matrix(i, j), loaded(i, j));
+    }
+
+    TEST(IoMatrixFile, View)
+    {
+        const TemporaryPath temporary("ml_io_view.mat");
+
+        ml::data_structure::matrix::DynamicMatrix<double> matrix(8, 6);
+        matrix.fill_generator(ml::generator::random::UniformRandom<double>(-1.0, 1.0, 42));
+
+        // A view not contiguous is saved as its elements in the row-major order
+        const auto view = matrix.view().block(1, 2, 5, 3).transpose();
+        ml::io::save(temporary.path, view);
+        EXPECT_EQ(view.evaluate(), ml::io::load<double>(temporary.path));
+
+        // An empty matrix
+        ml::io::save(temporary.path, ml::data_structure::matrix::DynamicMatrix<double>(0, 0));
+        const auto empty = ml::io::load<double>(temporary.path);
+        EXPECT_EQ(0, empty.get_height());
+        EXPECT_EQ(0, empty.get_width());
+    }
+
+    TEST(IoMatrixFile, Invalid)
+    {
+        const TemporaryPath temporary("ml_io_invalid.mat");
+
+        EXPECT_THROW(ml::io::load<float>(temporary.path), std::system_error);
+
+        ml::data_structure::matrix::DynamicMatrix<float> matrix(16, 16, 1.0f);
+        ml::io::save(temporary.path, matrix);
+        EXPECT_THROW(ml::io::load<double>(temporary.path), std::invalid_argument);
+
+        // A modified element fails the checksum when it is verified, by default only on load
+        {
+            std::fstream file(temporary.path, std::ios::binary | std::ios::in | std::ios::out);
+            file.seekp(ml::io::MATRIX_FILE_ALIGNMENT + 100);
+            file.put(42);
+        }
+        EXPECT_THROW(ml::io::MappedMatrix<float>(temporary.path, true), std::invalid_argument);
+        EXPECT_NO_THROW(ml::io::MappedMatrix<float>(temporary.path));
+        EXPECT_THROW(ml::io::load<float>(temporary.path), std::invalid_argument);
+        EXPECT_NO_THROW(ml::io::load<float>(temporary.path, false));
+
+        // A truncated file
+        {
+            std::ofstream file(temporary.path, std::ios::binary | std::ios::trunc);
+            file << "MLMATRIX";
+        }
+        EXPECT_THROW(ml::io::load<float>(temporary.path), std::invalid_argument);
+
+        // Not a matrix file
+        {
+            std::ofstream file(temporary.path, std::ios::trunc);
+            file << std::string(200, 'a');
+        }
+        EXPECT_THROW(ml::io::load<float>(temporary.path), std::invalid_argument);
+    }
+} // namespace tests::unit_tests
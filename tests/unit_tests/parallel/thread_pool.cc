@@ -0,0 +1,108 @@
+/**
+ ** @file tests/unit_tests/parallel/thread_pool.cc
+ ** @brief Tests for ml::parallel::ThreadPool
+ */
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "parallel/thread_pool.hh"
+
+namespace tests::unit_tests
+{
+    TEST(ParallelThreadPool, ThreadCount)
+    {
+        ml::parallel::ThreadPool thread_pool(3);
+
+        EXPECT_EQ(3, thread_pool.get_thread_count());
+        EXPECT_LE(1, ml::parallel::ThreadPool(0).get_thread_count());
+    }
+
+    TEST(ParallelThreadPool, EveryIndexOnce)
+    {
+        ml::parallel::ThreadPool thread_pool(4);
+        std::vector<std::atomic<int>> counts(1000);
+
+        thread_pool.parallel_for(0, counts.size(), 1, [&counts](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++)
+                counts[i]++;
+        });
+
+        for (const auto& count : counts)
+            EXPECT_EQ(1, count);
+    }
+
+    TEST(ParallelThreadPool, Grain)
+    {
+        ml::parallel::ThreadPool thread_pool(4);
+        std::atomic<size_t> total(0);
+
+        thread_pool.parallel_for(10, 107, 8, [&total](size_t begin, size_t end) {
+            EXPECT_EQ(0, (begin - 10) % 8);
+            EXPECT_TRUE(end == 107 || (end - 10) % 8 == 0);
+            total += end - begin;
+        });
+
+        EXPECT_EQ(97, total);
+    }
+
+    TEST(ParallelThreadPool, Empty)
+    {
+        ml::parallel::ThreadPool thread_pool(2);
+        bool called = false;
+
+        thread_pool.parallel_for(5, 5, 1, [&called](size_t, size_t) { called = true; });
+
+        EXPECT_FALSE(called);
+    }
+
+    TEST(ParallelThreadPool, Nested)
+    {
+        ml::parallel::ThreadPool thread_pool(3);
+        std::atomic<size_t> total(0);
+
+        thread_pool.parallel_for(0, 6, 1, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++)
+            {
+                thread_pool.parallel_for(0, 100, 1, [&total](size_t inner_begin, size_t inner_end) {
+                    total += inner_end - inner_begin;
+                });
+            }
+        });
+
+        EXPECT_EQ(600, total);
+    }
+
+    TEST(ParallelThreadPool, Exception)
+    {
+        ml::parallel::ThreadPool thread_pool(4);
+
+        EXPECT_THROW(thread_pool.parallel_for(0,
+                                              100,
+                                              1,
+                                              [](size_t begin, size_t) {
+                                                  if (begin != 0)
+                                                      throw std::runtime_error("Chunk failed");
+                                              }),
+                     std::runtime_error);
+
+        // The pool is still usable after an exception
+        std::atomic<size_t> total(0);
+        thread_pool.parallel_for(0, 100, 1, [&total](size_t begin, size_t end) { total += end - begin; });
+        EXPECT_EQ(100, total);
+    }
+
+    TEST(ParallelThreadPool, SharedThreadCount)
+    {
+        const size_t thread_count = ml::parallel::get_thread_count();
+
+        ml::parallel::set_thread_count(2);
+        EXPECT_EQ(2, ml::parallel::get_thread_count());
+        EXPECT_EQ(2, ml::parallel::get_thread_pool().get_thread_count());
+
+        ml::parallel::set_thread_count(thread_count);
+        EXPECT_EQ(thread_count, ml::parallel::get_thread_count());
+    }
+} // namespace tests::unit_tests